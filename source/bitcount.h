@@ -0,0 +1,801 @@
+// Copyright Ivan Stanojevic 2025.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+
+
+
+#ifndef __BITCOUNT_H
+
+#define __BITCOUNT_H
+
+
+
+#include "cstddef.h"
+#include "cstdint.h"
+
+#include "numbase.h"
+#include "cpufeat.h"
+
+
+
+// *** WORD COMBINATIONS ***
+
+
+// A combination maps a pair of words (or a pair of SIMD vectors of words)
+// to the word whose 1 bits are counted.
+
+class __bit_count_first
+
+{
+public:
+
+  template < class Word >
+  static Word combine ( Word x, Word )
+    { return x ; }
+
+#ifdef __x86_simd__
+
+  __avx2_function__
+  static __m256i avx2_combine ( __m256i x, __m256i )
+    { return x ; }
+
+  __avx512_popcnt_function__
+  static __m512i avx512_combine ( __m512i x, __m512i )
+    { return x ; }
+
+#endif
+
+} ;
+
+
+//
+
+class __bit_count_xor
+
+{
+public:
+
+  template < class Word >
+  static Word combine ( Word x, Word y )
+    { return x ^ y ; }
+
+#ifdef __x86_simd__
+
+  __avx2_function__
+  static __m256i avx2_combine ( __m256i x, __m256i y )
+    { return _mm256_xor_si256 ( x, y ) ; }
+
+  __avx512_popcnt_function__
+  static __m512i avx512_combine ( __m512i x, __m512i y )
+    { return _mm512_xor_si512 ( x, y ) ; }
+
+#endif
+
+} ;
+
+
+//
+
+class __bit_count_and
+
+{
+public:
+
+  template < class Word >
+  static Word combine ( Word x, Word y )
+    { return x & y ; }
+
+#ifdef __x86_simd__
+
+  __avx2_function__
+  static __m256i avx2_combine ( __m256i x, __m256i y )
+    { return _mm256_and_si256 ( x, y ) ; }
+
+  __avx512_popcnt_function__
+  static __m512i avx512_combine ( __m512i x, __m512i y )
+    { return _mm512_and_si512 ( x, y ) ; }
+
+#endif
+
+} ;
+
+
+//
+
+class __bit_count_or
+
+{
+public:
+
+  template < class Word >
+  static Word combine ( Word x, Word y )
+    { return x | y ; }
+
+#ifdef __x86_simd__
+
+  __avx2_function__
+  static __m256i avx2_combine ( __m256i x, __m256i y )
+    { return _mm256_or_si256 ( x, y ) ; }
+
+  __avx512_popcnt_function__
+  static __m512i avx512_combine ( __m512i x, __m512i y )
+    { return _mm512_or_si512 ( x, y ) ; }
+
+#endif
+
+} ;
+
+
+
+// *** SCALAR KERNELS ***
+
+
+// returns: number of 1 bits in
+//          Combination :: combine ( a [ i ], b [ i ] ), 0 <= i < n
+
+template < class Combination, class Word >
+inline size_t generic_words_bit_count ( const Word * a,
+                                        const Word * b,
+                                        size_t n )
+
+{
+size_t r0 = 0, r1 = 0, r2 = 0, r3 = 0 ;
+
+size_t i = 0 ;
+
+for ( ; i + 4 <= n ; i += 4 )
+  {
+  r0 += hamming_weight ( Combination :: combine ( a [ i ], b [ i ] ) ) ;
+  r1 += hamming_weight ( Combination :: combine ( a [ i + 1 ],
+                                                  b [ i + 1 ] ) ) ;
+  r2 += hamming_weight ( Combination :: combine ( a [ i + 2 ],
+                                                  b [ i + 2 ] ) ) ;
+  r3 += hamming_weight ( Combination :: combine ( a [ i + 3 ],
+                                                  b [ i + 3 ] ) ) ;
+  }
+
+for ( ; i < n ; ++ i )
+  r0 += hamming_weight ( Combination :: combine ( a [ i ], b [ i ] ) ) ;
+
+return r0 + r1 + r2 + r3 ;
+}
+
+
+// post: and_weight = number of 1 bits in a [ i ] & b [ i ], 0 <= i < n,
+//       or_weight = number of 1 bits in a [ i ] | b [ i ], 0 <= i < n
+
+template < class Word >
+inline void generic_words_and_or_weight ( const Word * a,
+                                          const Word * b,
+                                          size_t n,
+                                          size_t & and_weight,
+                                          size_t & or_weight )
+
+{
+size_t r0 = 0, r1 = 0, s0 = 0, s1 = 0 ;
+
+size_t i = 0 ;
+
+for ( ; i + 2 <= n ; i += 2 )
+  {
+  r0 += hamming_weight ( Word ( a [ i ] & b [ i ] ) ) ;
+  s0 += hamming_weight ( Word ( a [ i ] | b [ i ] ) ) ;
+  r1 += hamming_weight ( Word ( a [ i + 1 ] & b [ i + 1 ] ) ) ;
+  s1 += hamming_weight ( Word ( a [ i + 1 ] | b [ i + 1 ] ) ) ;
+  }
+
+for ( ; i < n ; ++ i )
+  {
+  r0 += hamming_weight ( Word ( a [ i ] & b [ i ] ) ) ;
+  s0 += hamming_weight ( Word ( a [ i ] | b [ i ] ) ) ;
+  }
+
+and_weight = r0 + r1 ;
+or_weight = s0 + s1 ;
+}
+
+
+// returns: true iff a [ i ] & b [ i ] != 0 for some 0 <= i < n
+
+template < class Word >
+inline bool generic_words_and_nonzero ( const Word * a,
+                                        const Word * b,
+                                        size_t n )
+
+{
+for ( size_t i = 0 ; i < n ; ++ i )
+  if ( ( a [ i ] & b [ i ] ) != Word ( 0 ) )
+    return true ;
+
+return false ;
+}
+
+
+#ifdef __x86_simd__
+
+// The same, compiled to use the POPCNT instruction: the generic kernels
+// are inlined into these functions and so compiled with their target.
+
+template < class Combination, class Word >
+__popcnt_function__
+  size_t popcnt_words_bit_count ( const Word * a,
+                                  const Word * b,
+                                  size_t n )
+
+{
+return generic_words_bit_count < Combination > ( a, b, n ) ;
+}
+
+
+//
+
+template < class Word >
+__popcnt_function__
+  void popcnt_words_and_or_weight ( const Word * a,
+                                    const Word * b,
+                                    size_t n,
+                                    size_t & and_weight,
+                                    size_t & or_weight )
+
+{
+generic_words_and_or_weight ( a, b, n, and_weight, or_weight ) ;
+}
+
+#endif
+
+
+
+// *** AVX2 KERNELS ***
+
+
+#ifdef __x86_simd__
+
+// Harley-Seal population count (W. Mula, N. Kurz, D. Lemire, "Faster
+// Population Counts Using AVX2 Instructions"): blocks of 16 vectors are
+// reduced by a tree of carry save adders, so that only one vector in 16
+// is counted by the nibble lookup. The words after the last whole block
+// are counted by POPCNT, which is faster than the lookup alone.
+
+class __avx2_harley_seal_counter
+
+{
+public:
+
+  __avx2_function__
+  void reset ( )
+    { sixteens = eights = fours = twos = ones = _mm256_setzero_si256 ( ) ; }
+
+  // adds the 1 bits of v [ 0 ], ..., v [ 15 ]
+
+  __avx2_function__
+  void add_block ( const __m256i * v )
+    { __m256i twos_a, twos_b, fours_a, fours_b, eights_a, eights_b,
+              sixteens_a ;
+      carry_save_add ( twos_a, ones, ones, v [ 0 ], v [ 1 ] ) ;
+      carry_save_add ( twos_b, ones, ones, v [ 2 ], v [ 3 ] ) ;
+      carry_save_add ( fours_a, twos, twos, twos_a, twos_b ) ;
+      carry_save_add ( twos_a, ones, ones, v [ 4 ], v [ 5 ] ) ;
+      carry_save_add ( twos_b, ones, ones, v [ 6 ], v [ 7 ] ) ;
+      carry_save_add ( fours_b, twos, twos, twos_a, twos_b ) ;
+      carry_save_add ( eights_a, fours, fours, fours_a, fours_b ) ;
+      carry_save_add ( twos_a, ones, ones, v [ 8 ], v [ 9 ] ) ;
+      carry_save_add ( twos_b, ones, ones, v [ 10 ], v [ 11 ] ) ;
+      carry_save_add ( fours_a, twos, twos, twos_a, twos_b ) ;
+      carry_save_add ( twos_a, ones, ones, v [ 12 ], v [ 13 ] ) ;
+      carry_save_add ( twos_b, ones, ones, v [ 14 ], v [ 15 ] ) ;
+      carry_save_add ( fours_b, twos, twos, twos_a, twos_b ) ;
+      carry_save_add ( eights_b, fours, fours, fours_a, fours_b ) ;
+      carry_save_add ( sixteens_a, eights, eights, eights_a, eights_b ) ;
+      sixteens = _mm256_add_epi64 ( sixteens,
+                                    lane_hamming_weight ( sixteens_a ) ) ; }
+
+  __avx2_function__
+  size_t result ( ) const
+    { __m256i r
+        ( _mm256_add_epi64
+            ( _mm256_add_epi64
+                ( _mm256_slli_epi64 ( sixteens, 4 ),
+                  _mm256_slli_epi64 ( lane_hamming_weight ( eights ), 3 ) ),
+              _mm256_add_epi64
+                ( _mm256_slli_epi64 ( lane_hamming_weight ( fours ), 2 ),
+                  _mm256_slli_epi64 ( lane_hamming_weight ( twos ), 1 ) ) ) ) ;
+      r = _mm256_add_epi64 ( r, lane_hamming_weight ( ones ) ) ;
+      // the two lanes are stored and added, since _mm_cvtsi128_si64 and
+      // _mm_extract_epi64 exist on x86-64 only
+      alignas ( 16 ) uint64_t w [ 2 ] ;
+      _mm_store_si128 ( reinterpret_cast < __m128i * > ( w ),
+                        _mm_add_epi64 ( _mm256_castsi256_si128 ( r ),
+                                        _mm256_extracti128_si256 ( r, 1 ) ) ) ;
+      return size_t ( w [ 0 ] + w [ 1 ] ) ; }
+
+private:
+
+  // returns: number of 1 bits in each 64 bit lane of x
+
+  __avx2_function__
+  static __m256i lane_hamming_weight ( __m256i x )
+    { const __m256i lookup
+        ( _mm256_setr_epi8 ( 0, 1, 1, 2, 1, 2, 2, 3,
+                             1, 2, 2, 3, 2, 3, 3, 4,
+                             0, 1, 1, 2, 1, 2, 2, 3,
+                             1, 2, 2, 3, 2, 3, 3, 4 ) ) ;
+      const __m256i low_mask ( _mm256_set1_epi8 ( 0x0f ) ) ;
+      __m256i l ( _mm256_shuffle_epi8 ( lookup,
+                                        _mm256_and_si256 ( x, low_mask ) ) ),
+              h ( _mm256_shuffle_epi8
+                    ( lookup,
+                      _mm256_and_si256 ( _mm256_srli_epi16 ( x, 4 ),
+                                         low_mask ) ) ) ;
+      return _mm256_sad_epu8 ( _mm256_add_epi8 ( l, h ),
+                               _mm256_setzero_si256 ( ) ) ; }
+
+  // post: high, low = sum of the corresponding bits of a, b and c
+
+  __avx2_function__
+  static void carry_save_add ( __m256i & high, __m256i & low,
+                               __m256i a, __m256i b, __m256i c )
+    { __m256i u ( _mm256_xor_si256 ( a, b ) ) ;
+      high = _mm256_or_si256 ( _mm256_and_si256 ( a, b ),
+                               _mm256_and_si256 ( u, c ) ) ;
+      low = _mm256_xor_si256 ( u, c ) ; }
+
+  __m256i sixteens, eights, fours, twos, ones ;
+
+} ;
+
+
+// returns: number of 1 bits in
+//          Combination :: combine ( a [ i ], b [ i ] ), 0 <= i < n
+
+template < class Combination, class Word >
+__avx2_function__
+  size_t avx2_words_bit_count ( const Word * a,
+                                const Word * b,
+                                size_t n )
+
+{
+static_assert ( 32 % sizeof ( Word ) == 0,
+                "Word size must divide the vector size." ) ;
+
+const size_t vector_words = 32 / sizeof ( Word ),
+             vectors = n / vector_words ;
+
+if ( vectors < 16 )
+  return popcnt_words_bit_count < Combination > ( a, b, n ) ;
+
+const __m256i * pa = reinterpret_cast < const __m256i * > ( a ) ;
+const __m256i * pb = reinterpret_cast < const __m256i * > ( b ) ;
+
+__avx2_harley_seal_counter counter ;
+counter.reset ( ) ;
+
+size_t i = 0 ;
+
+for ( ; i + 16 <= vectors ; i += 16 )
+  {
+  __m256i v [ 16 ] ;
+
+  for ( sint j = 0 ; j < 16 ; ++ j )
+    v [ j ] = Combination :: avx2_combine
+                               ( _mm256_loadu_si256 ( pa + i + j ),
+                                 _mm256_loadu_si256 ( pb + i + j ) ) ;
+
+  counter.add_block ( v ) ;
+  }
+
+size_t k = i * vector_words ;
+
+return   counter.result ( )
+       + popcnt_words_bit_count < Combination >
+           ( a + k, b + k, n - k ) ;
+}
+
+
+//
+
+template < class Word >
+__avx2_function__
+  void avx2_words_and_or_weight ( const Word * a,
+                                  const Word * b,
+                                  size_t n,
+                                  size_t & and_weight,
+                                  size_t & or_weight )
+
+{
+static_assert ( 32 % sizeof ( Word ) == 0,
+                "Word size must divide the vector size." ) ;
+
+const size_t vector_words = 32 / sizeof ( Word ),
+             vectors = n / vector_words ;
+
+if ( vectors < 16 )
+  {
+  popcnt_words_and_or_weight ( a, b, n, and_weight, or_weight ) ;
+  return ;
+  }
+
+const __m256i * pa = reinterpret_cast < const __m256i * > ( a ) ;
+const __m256i * pb = reinterpret_cast < const __m256i * > ( b ) ;
+
+__avx2_harley_seal_counter and_counter, or_counter ;
+and_counter.reset ( ) ;
+or_counter.reset ( ) ;
+
+size_t i = 0 ;
+
+for ( ; i + 16 <= vectors ; i += 16 )
+  {
+  __m256i v [ 16 ], w [ 16 ] ;
+
+  for ( sint j = 0 ; j < 16 ; ++ j )
+    {
+    __m256i x = _mm256_loadu_si256 ( pa + i + j ),
+            y = _mm256_loadu_si256 ( pb + i + j ) ;
+
+    v [ j ] = _mm256_and_si256 ( x, y ) ;
+    w [ j ] = _mm256_or_si256 ( x, y ) ;
+    }
+
+  and_counter.add_block ( v ) ;
+  or_counter.add_block ( w ) ;
+  }
+
+size_t k = i * vector_words ;
+
+popcnt_words_and_or_weight ( a + k, b + k, n - k, and_weight, or_weight ) ;
+
+and_weight += and_counter.result ( ) ;
+or_weight += or_counter.result ( ) ;
+}
+
+
+// returns: true iff a [ i ] & b [ i ] != 0 for some 0 <= i < n
+
+template < class Word >
+__avx2_function__
+  bool avx2_words_and_nonzero ( const Word * a,
+                                const Word * b,
+                                size_t n )
+
+{
+static_assert ( 32 % sizeof ( Word ) == 0,
+                "Word size must divide the vector size." ) ;
+
+const size_t vector_words = 32 / sizeof ( Word ),
+             vectors = n / vector_words ;
+
+const __m256i * pa = reinterpret_cast < const __m256i * > ( a ) ;
+const __m256i * pb = reinterpret_cast < const __m256i * > ( b ) ;
+
+size_t i = 0 ;
+
+for ( ; i + 4 <= vectors ; i += 4 )
+  {
+  __m256i x
+    ( _mm256_or_si256
+        ( _mm256_or_si256
+            ( _mm256_and_si256 ( _mm256_loadu_si256 ( pa + i ),
+                                 _mm256_loadu_si256 ( pb + i ) ),
+              _mm256_and_si256 ( _mm256_loadu_si256 ( pa + i + 1 ),
+                                 _mm256_loadu_si256 ( pb + i + 1 ) ) ),
+          _mm256_or_si256
+            ( _mm256_and_si256 ( _mm256_loadu_si256 ( pa + i + 2 ),
+                                 _mm256_loadu_si256 ( pb + i + 2 ) ),
+              _mm256_and_si256 ( _mm256_loadu_si256 ( pa + i + 3 ),
+                                 _mm256_loadu_si256 ( pb + i + 3 ) ) ) ) ) ;
+
+  if ( ! _mm256_testz_si256 ( x, x ) )
+    return true ;
+  }
+
+for ( ; i < vectors ; ++ i )
+  if ( ! _mm256_testz_si256 ( _mm256_loadu_si256 ( pa + i ),
+                              _mm256_loadu_si256 ( pb + i ) ) )
+    return true ;
+
+size_t k = i * vector_words ;
+
+return generic_words_and_nonzero ( a + k, b + k, n - k ) ;
+}
+
+#endif
+
+
+
+// *** AVX-512 KERNELS ***
+
+
+#ifdef __x86_simd__
+
+// returns: sum of the 64 bit lanes of x
+//
+// The lanes are stored and added: with GCC 12, _mm512_reduce_add_epi64,
+// _mm512_castsi512_si256 and _mm512_extracti64x4_epi64 all expand to
+// builtins taking an undefined vector, which -Wall reports as used
+// uninitialized.
+
+__avx512_popcnt_function__
+  inline size_t __avx512_lane_sum ( __m512i x )
+
+{
+alignas ( 64 ) uint64_t w [ 8 ] ;
+
+_mm512_store_si512 ( w, x ) ;
+
+return size_t (   ( w [ 0 ] + w [ 1 ] ) + ( w [ 2 ] + w [ 3 ] )
+                + ( w [ 4 ] + w [ 5 ] ) + ( w [ 6 ] + w [ 7 ] ) ) ;
+}
+
+
+// VPOPCNTDQ counts the 1 bits of each 64 bit lane directly; four
+// independent accumulators hide its latency.
+
+template < class Combination, class Word >
+__avx512_popcnt_function__
+  size_t avx512_words_bit_count ( const Word * a,
+                                  const Word * b,
+                                  size_t n )
+
+{
+static_assert ( 64 % sizeof ( Word ) == 0,
+                "Word size must divide the vector size." ) ;
+
+const size_t vector_words = 64 / sizeof ( Word ),
+             vectors = n / vector_words ;
+
+const __m512i * pa = reinterpret_cast < const __m512i * > ( a ) ;
+const __m512i * pb = reinterpret_cast < const __m512i * > ( b ) ;
+
+__m512i s0 = _mm512_setzero_si512 ( ),
+        s1 = _mm512_setzero_si512 ( ),
+        s2 = _mm512_setzero_si512 ( ),
+        s3 = _mm512_setzero_si512 ( ) ;
+
+size_t i = 0 ;
+
+for ( ; i + 4 <= vectors ; i += 4 )
+  {
+  s0 = _mm512_add_epi64
+         ( s0,
+           _mm512_popcnt_epi64
+             ( Combination :: avx512_combine
+                                ( _mm512_loadu_si512 ( pa + i ),
+                                  _mm512_loadu_si512 ( pb + i ) ) ) ) ;
+  s1 = _mm512_add_epi64
+         ( s1,
+           _mm512_popcnt_epi64
+             ( Combination :: avx512_combine
+                                ( _mm512_loadu_si512 ( pa + i + 1 ),
+                                  _mm512_loadu_si512 ( pb + i + 1 ) ) ) ) ;
+  s2 = _mm512_add_epi64
+         ( s2,
+           _mm512_popcnt_epi64
+             ( Combination :: avx512_combine
+                                ( _mm512_loadu_si512 ( pa + i + 2 ),
+                                  _mm512_loadu_si512 ( pb + i + 2 ) ) ) ) ;
+  s3 = _mm512_add_epi64
+         ( s3,
+           _mm512_popcnt_epi64
+             ( Combination :: avx512_combine
+                                ( _mm512_loadu_si512 ( pa + i + 3 ),
+                                  _mm512_loadu_si512 ( pb + i + 3 ) ) ) ) ;
+  }
+
+for ( ; i < vectors ; ++ i )
+  s0 = _mm512_add_epi64
+         ( s0,
+           _mm512_popcnt_epi64
+             ( Combination :: avx512_combine
+                                ( _mm512_loadu_si512 ( pa + i ),
+                                  _mm512_loadu_si512 ( pb + i ) ) ) ) ;
+
+size_t k = i * vector_words ;
+
+return   __avx512_lane_sum
+           ( _mm512_add_epi64 ( _mm512_add_epi64 ( s0, s1 ),
+                                _mm512_add_epi64 ( s2, s3 ) ) )
+       + popcnt_words_bit_count < Combination >
+           ( a + k, b + k, n - k ) ;
+}
+
+
+//
+
+template < class Word >
+__avx512_popcnt_function__
+  void avx512_words_and_or_weight ( const Word * a,
+                                    const Word * b,
+                                    size_t n,
+                                    size_t & and_weight,
+                                    size_t & or_weight )
+
+{
+static_assert ( 64 % sizeof ( Word ) == 0,
+                "Word size must divide the vector size." ) ;
+
+const size_t vector_words = 64 / sizeof ( Word ),
+             vectors = n / vector_words ;
+
+const __m512i * pa = reinterpret_cast < const __m512i * > ( a ) ;
+const __m512i * pb = reinterpret_cast < const __m512i * > ( b ) ;
+
+__m512i r0 = _mm512_setzero_si512 ( ),
+        r1 = _mm512_setzero_si512 ( ),
+        s0 = _mm512_setzero_si512 ( ),
+        s1 = _mm512_setzero_si512 ( ) ;
+
+size_t i = 0 ;
+
+for ( ; i + 2 <= vectors ; i += 2 )
+  {
+  __m512i x0 = _mm512_loadu_si512 ( pa + i ),
+          y0 = _mm512_loadu_si512 ( pb + i ),
+          x1 = _mm512_loadu_si512 ( pa + i + 1 ),
+          y1 = _mm512_loadu_si512 ( pb + i + 1 ) ;
+
+  r0 = _mm512_add_epi64
+         ( r0, _mm512_popcnt_epi64 ( _mm512_and_si512 ( x0, y0 ) ) ) ;
+  s0 = _mm512_add_epi64
+         ( s0, _mm512_popcnt_epi64 ( _mm512_or_si512 ( x0, y0 ) ) ) ;
+  r1 = _mm512_add_epi64
+         ( r1, _mm512_popcnt_epi64 ( _mm512_and_si512 ( x1, y1 ) ) ) ;
+  s1 = _mm512_add_epi64
+         ( s1, _mm512_popcnt_epi64 ( _mm512_or_si512 ( x1, y1 ) ) ) ;
+  }
+
+for ( ; i < vectors ; ++ i )
+  {
+  __m512i x = _mm512_loadu_si512 ( pa + i ),
+          y = _mm512_loadu_si512 ( pb + i ) ;
+
+  r0 = _mm512_add_epi64
+         ( r0, _mm512_popcnt_epi64 ( _mm512_and_si512 ( x, y ) ) ) ;
+  s0 = _mm512_add_epi64
+         ( s0, _mm512_popcnt_epi64 ( _mm512_or_si512 ( x, y ) ) ) ;
+  }
+
+size_t k = i * vector_words ;
+
+popcnt_words_and_or_weight ( a + k, b + k, n - k, and_weight, or_weight ) ;
+
+and_weight += __avx512_lane_sum ( _mm512_add_epi64 ( r0, r1 ) ) ;
+or_weight += __avx512_lane_sum ( _mm512_add_epi64 ( s0, s1 ) ) ;
+}
+
+#endif
+
+
+
+// *** WORD ARRAY BIT COUNTS ***
+
+
+// Chooses the best kernel supported by the processor at run time.
+//
+// returns: number of 1 bits in
+//          Combination :: combine ( a [ i ], b [ i ] ), 0 <= i < n
+
+template < class Combination, class Word >
+inline size_t words_bit_count ( const Word * a, const Word * b, size_t n )
+
+{
+#ifdef __x86_simd__
+static const bool has_avx512_popcnt = cpu_has_avx512_popcnt ( ),
+                  has_avx2 = cpu_has_avx2 ( ),
+                  has_popcnt = cpu_has_popcnt ( ) ;
+
+if ( has_avx512_popcnt )
+  return avx512_words_bit_count < Combination > ( a, b, n ) ;
+
+if ( has_avx2 )
+  return avx2_words_bit_count < Combination > ( a, b, n ) ;
+
+if ( has_popcnt )
+  return popcnt_words_bit_count < Combination > ( a, b, n ) ;
+#endif
+
+return generic_words_bit_count < Combination > ( a, b, n ) ;
+}
+
+
+// returns: number of 1 bits in p [ 0 ], ..., p [ n - 1 ]
+
+template < class Word >
+inline size_t words_hamming_weight ( const Word * p, size_t n )
+
+{
+return words_bit_count < __bit_count_first > ( p, p, n ) ;
+}
+
+
+// returns: number of 1 bits in a [ i ] ^ b [ i ], 0 <= i < n
+
+template < class Word >
+inline size_t words_hamming_distance ( const Word * a,
+                                       const Word * b,
+                                       size_t n )
+
+{
+return words_bit_count < __bit_count_xor > ( a, b, n ) ;
+}
+
+
+// returns: number of 1 bits in a [ i ] & b [ i ], 0 <= i < n
+
+template < class Word >
+inline size_t words_and_weight ( const Word * a, const Word * b, size_t n )
+
+{
+return words_bit_count < __bit_count_and > ( a, b, n ) ;
+}
+
+
+// returns: number of 1 bits in a [ i ] | b [ i ], 0 <= i < n
+
+template < class Word >
+inline size_t words_or_weight ( const Word * a, const Word * b, size_t n )
+
+{
+return words_bit_count < __bit_count_or > ( a, b, n ) ;
+}
+
+
+// post: and_weight = words_and_weight ( a, b, n ),
+//       or_weight = words_or_weight ( a, b, n ),
+//       computed in a single pass
+
+template < class Word >
+inline void words_and_or_weight ( const Word * a,
+                                  const Word * b,
+                                  size_t n,
+                                  size_t & and_weight,
+                                  size_t & or_weight )
+
+{
+#ifdef __x86_simd__
+static const bool has_avx512_popcnt = cpu_has_avx512_popcnt ( ),
+                  has_avx2 = cpu_has_avx2 ( ),
+                  has_popcnt = cpu_has_popcnt ( ) ;
+
+if ( has_avx512_popcnt )
+  {
+  avx512_words_and_or_weight ( a, b, n, and_weight, or_weight ) ;
+  return ;
+  }
+
+if ( has_avx2 )
+  {
+  avx2_words_and_or_weight ( a, b, n, and_weight, or_weight ) ;
+  return ;
+  }
+
+if ( has_popcnt )
+  {
+  popcnt_words_and_or_weight ( a, b, n, and_weight, or_weight ) ;
+  return ;
+  }
+#endif
+
+generic_words_and_or_weight ( a, b, n, and_weight, or_weight ) ;
+}
+
+
+// returns: true iff a [ i ] & b [ i ] != 0 for some 0 <= i < n
+
+template < class Word >
+inline bool words_and_nonzero ( const Word * a, const Word * b, size_t n )
+
+{
+#ifdef __x86_simd__
+static const bool has_avx2 = cpu_has_avx2 ( ) ;
+
+if ( has_avx2 )
+  return avx2_words_and_nonzero ( a, b, n ) ;
+#endif
+
+return generic_words_and_nonzero ( a, b, n ) ;
+}
+
+
+
+#endif
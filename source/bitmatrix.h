@@ -0,0 +1,744 @@
+// Copyright Ivan Stanojevic 2025.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+
+
+
+#ifndef __BITMATRIX_H
+
+#define __BITMATRIX_H
+
+
+
+#include "memory.h"
+#include "cstddef.h"
+#include "vector.h"
+#include "algorithm.h"
+#include "utility.h"
+#include "stdexcept.h"
+#include "cassert.h"
+#include "future.h"
+
+#include "numbase.h"
+#include "bitref.h"
+#include "bitvector.h"
+#include "bitslice.h"
+#include "threadpool.h"
+
+
+
+// *** BASIC_BIT_MATRIX ***
+
+
+// Dense matrix over GF ( 2 ). The rows are stored contiguously, each one
+// in row_word_size ( ) words packed like the words of a basic_bit_vector,
+// and bits after the end of each row are 0.
+//
+// Gaussian elimination and multiplication use the Method of Four Russians
+// (G. V. Bard, "Accelerating Cryptanalysis with the Method of Four
+// Russians"; M. Albrecht, G. V. Bard, W. Hart, "Algorithm 898: Efficient
+// Multiplication of Dense Matrices over GF(2)"): the sums of all subsets
+// of k rows are tabulated in 2 ^ k row additions, after which each row is
+// reduced by one table row, selected by its k bits, instead of by up to k
+// rows. Row additions are word-parallel, and the rows to be reduced can be
+// split among the threads of a thread pool.
+
+template < class Word, class Allocator = allocator < Word > >
+class basic_bit_matrix
+
+{
+public:
+
+  typedef Word word_type ;
+
+  typedef basic_bit_vector < Word, Allocator > bit_vector_type ;
+
+  static constexpr size_t word_bit_size = numeric_traits < Word > :: bit_size ;
+
+private:
+
+  // maximal number of rows of a Four Russians table, and the minimal
+  // number of words of a task
+
+  static constexpr size_t max_table_bits = 8,
+                          task_words = 16384,
+                          tasks_per_thread = 4 ;
+
+  size_t size1_ ;
+  size_t size2_ ;
+  size_t row_word_size_ ;
+  vector < Word, Allocator > data_ ;
+
+  // returns: number of table bits for a matrix of dimension n
+
+  static size_t table_bits ( size_t n )
+    { return   n < 16
+             ? 1
+             : min ( size_t ( exponent ( n ) ) - 3, max_table_bits ) ; }
+
+  // returns: bits [ c, c + k ) of row i
+
+  size_t row_bits ( size_t i, size_t c, size_t k ) const noexcept
+    { const Word * p = row_data ( i ) + c / word_bit_size ;
+      size_t s = c % word_bit_size ;
+      size_t x = unsigned_shift_right ( p [ 0 ], s ) ;
+      if ( s + k > word_bit_size )
+        x |= size_t ( p [ 1 ] ) << ( word_bit_size - s ) ;
+      return x & ( ( size_t ( 1 ) << k ) - 1 ) ; }
+
+  static void add_words ( Word * a, const Word * b, size_t n ) noexcept
+    { for ( size_t i = 0 ; i < n ; ++ i )
+        a [ i ] ^= b [ i ] ; }
+
+  template < class F >
+  static void for_row_ranges ( size_t n,
+                               size_t row_words,
+                               F f,
+                               thread_pool * pool ) ;
+
+  size_t find_block_pivots ( size_t r, size_t c, size_t k,
+                             size_t * pivot_columns ) ;
+
+  basic_bit_matrix augmented ( size_t extra_columns ) const ;
+
+public:
+
+  basic_bit_matrix ( ) :
+    size1_ ( 0 ),
+    size2_ ( 0 ),
+    row_word_size_ ( 0 ),
+    data_ ( )
+    { }
+
+  basic_bit_matrix ( size_t i_size1, size_t i_size2 ) :
+    size1_ ( i_size1 ),
+    size2_ ( i_size2 ),
+    row_word_size_ ( ( i_size2 + word_bit_size - 1 ) / word_bit_size ),
+    data_ ( i_size1 * row_word_size_, Word ( 0 ) )
+    { }
+
+  static basic_bit_matrix identity ( size_t n )
+    { basic_bit_matrix x ( n, n ) ;
+      for ( size_t i = 0 ; i < n ; ++ i )
+        x.set ( i, i, true ) ;
+      return x ; }
+
+  // number of rows
+
+  size_t size1 ( ) const noexcept
+    { return size1_ ; }
+
+  // number of columns
+
+  size_t size2 ( ) const noexcept
+    { return size2_ ; }
+
+  size_t row_word_size ( ) const noexcept
+    { return row_word_size_ ; }
+
+  Word * row_data ( size_t i ) noexcept
+    { assert ( i < size1_ ) ;
+      return data_.data ( ) + i * row_word_size_ ; }
+
+  const Word * row_data ( size_t i ) const noexcept
+    { assert ( i < size1_ ) ;
+      return data_.data ( ) + i * row_word_size_ ; }
+
+  bool get ( size_t i, size_t j ) const noexcept
+    { assert ( j < size2_ ) ;
+      return   ( row_data ( i ) [ j / word_bit_size ]
+                 >> j % word_bit_size & 1 )
+             != 0 ; }
+
+  void set ( size_t i, size_t j, bool b ) noexcept
+    { assert ( j < size2_ ) ;
+      Word & w = row_data ( i ) [ j / word_bit_size ] ;
+      Word m = Word ( 1 ) << j % word_bit_size ;
+      w = b ? w | m : w & ~ m ; }
+
+  void flip ( size_t i, size_t j ) noexcept
+    { assert ( j < size2_ ) ;
+      row_data ( i ) [ j / word_bit_size ] ^=
+        Word ( 1 ) << j % word_bit_size ; }
+
+  bit_vector_type row ( size_t i ) const
+    { bit_vector_type x ( size2_ ) ;
+      copy_n ( row_data ( i ), row_word_size_, x.data ( ) ) ;
+      return x ; }
+
+  void set_row ( size_t i, const bit_vector_type & x ) ;
+
+  void swap_rows ( size_t i, size_t j ) noexcept
+    { if ( i != j )
+        swap_ranges ( row_data ( i ), row_data ( i ) + row_word_size_,
+                      row_data ( j ) ) ; }
+
+  // adds row j to row i
+
+  void add_row ( size_t i, size_t j ) noexcept
+    { add_words ( row_data ( i ), row_data ( j ), row_word_size_ ) ; }
+
+  // Transforms the matrix to the reduced row echelon form, or only to a
+  // row echelon form if reduced is false, using the threads of pool, or
+  // the calling thread if pool is nullptr.
+  //
+  // returns: rank
+
+  size_t echelonize ( bool reduced = true, thread_pool * pool = nullptr ) ;
+
+  size_t rank ( thread_pool * pool = nullptr ) const
+    { basic_bit_matrix x ( * this ) ;
+      return x.echelonize ( false, pool ) ; }
+
+  // returns: basis of the space of the solutions of * this * x = 0, one
+  //          vector in each row
+
+  basic_bit_matrix kernel ( thread_pool * pool = nullptr ) const ;
+
+  // Assigns to x a solution of * this * x = b.
+  //
+  // returns: false if there is no solution
+
+  bool solve ( const bit_vector_type & b,
+               bit_vector_type & x,
+               thread_pool * pool = nullptr ) const ;
+
+  basic_bit_matrix & operator += ( const basic_bit_matrix & b ) ;
+
+  void swap ( basic_bit_matrix & x ) noexcept
+    { :: swap ( size1_, x.size1_ ) ;
+      :: swap ( size2_, x.size2_ ) ;
+      :: swap ( row_word_size_, x.row_word_size_ ) ;
+      data_.swap ( x.data_ ) ; }
+
+  template < class Word2, class Allocator2 >
+  friend basic_bit_matrix < Word2, Allocator2 >
+    multiply ( const basic_bit_matrix < Word2, Allocator2 > & a,
+               const basic_bit_matrix < Word2, Allocator2 > & b,
+               thread_pool * pool ) ;
+
+  template < class Word2, class Allocator2 >
+  friend bool operator ==
+                ( const basic_bit_matrix < Word2, Allocator2 > & a,
+                  const basic_bit_matrix < Word2, Allocator2 > & b ) ;
+
+} ;
+
+
+// Calls f ( first, last ) for a split of n rows of row_words words into
+// ranges [ first, last ), on the threads of pool, or once on the calling
+// thread if pool is nullptr or there is not enough work.
+
+template < class Word, class Allocator >
+template < class F >
+void basic_bit_matrix < Word, Allocator > ::
+  for_row_ranges ( size_t n, size_t row_words, F f, thread_pool * pool )
+
+{
+size_t tasks =   pool == nullptr
+               ? 1
+               : min ( { pool -> size ( ) * tasks_per_thread,
+                         n * row_words / task_words,
+                         n } ) ;
+
+run_range_tasks ( pool,
+                  n,
+                  tasks,
+                  [ & f ] ( size_t, size_t first, size_t last )
+                  { f ( first, last ) ; } ) ;
+}
+
+
+//
+
+template < class Word, class Allocator >
+void basic_bit_matrix < Word, Allocator > ::
+  set_row ( size_t i, const bit_vector_type & x )
+
+{
+if ( x.size ( ) != size2_ )
+  throw invalid_argument ( "bit_matrix :: set_row, size mismatch" ) ;
+
+copy_n ( x.data ( ), row_word_size_, row_data ( i ) ) ;
+}
+
+
+// Finds up to k pivots in columns [ c, c + k ) among the rows from r, moves
+// them to rows r, r + 1, ..., and reduces them so that each one has 0 bits
+// in the pivot columns of the others.
+//
+// returns: number of pivots, with their columns, relative to c, in
+//          pivot_columns
+
+template < class Word, class Allocator >
+size_t basic_bit_matrix < Word, Allocator > ::
+  find_block_pivots ( size_t r, size_t c, size_t k, size_t * pivot_columns )
+
+{
+const size_t w0 = c / word_bit_size,
+             row_words = row_word_size_ - w0 ;
+
+size_t pivot_bits [ max_table_bits ] ;
+
+size_t pivots = 0 ;
+
+for ( size_t j = 0 ; j < k  &&  r + pivots < size1_ ; ++ j )
+  for ( size_t i = r + pivots ; i < size1_ ; ++ i )
+    {
+    // the bits of row i reduced by the pivots found so far
+
+    size_t b = row_bits ( i, c, k ) ;
+
+    for ( size_t p = 0 ; p < pivots ; ++ p )
+      if ( ( b >> pivot_columns [ p ] & 1 ) != 0 )
+        b ^= pivot_bits [ p ] ;
+
+    if ( ( b >> j & 1 ) != 0 )
+      {
+      b = row_bits ( i, c, k ) ;
+
+      for ( size_t p = 0 ; p < pivots ; ++ p )
+        if ( ( b >> pivot_columns [ p ] & 1 ) != 0 )
+          {
+          add_words ( row_data ( i ) + w0, row_data ( r + p ) + w0,
+                      row_words ) ;
+          b ^= pivot_bits [ p ] ;
+          }
+
+      swap_rows ( i, r + pivots ) ;
+      pivot_columns [ pivots ] = j ;
+      pivot_bits [ pivots ] = b ;
+      ++ pivots ;
+      break ;
+      }
+    }
+
+// clear the pivot columns of the later pivots in the earlier ones
+
+for ( size_t p = pivots ; p > 1 ; )
+  {
+  -- p ;
+
+  for ( size_t q = 0 ; q < p ; ++ q )
+    if ( ( pivot_bits [ q ] >> pivot_columns [ p ] & 1 ) != 0 )
+      {
+      add_words ( row_data ( r + q ) + w0, row_data ( r + p ) + w0,
+                  row_words ) ;
+      pivot_bits [ q ] ^= pivot_bits [ p ] ;
+      }
+  }
+
+return pivots ;
+}
+
+
+//
+
+template < class Word, class Allocator >
+size_t basic_bit_matrix < Word, Allocator > ::
+  echelonize ( bool reduced, thread_pool * pool )
+
+{
+const size_t k_max = table_bits ( min ( size1_, size2_ ) ) ;
+
+vector < Word, Allocator > table ;
+vector < size_t > table_index ;
+
+size_t pivot_columns [ max_table_bits ] ;
+
+size_t r = 0 ;
+
+for ( size_t c = 0 ; c < size2_  &&  r < size1_ ; c += k_max )
+  {
+  const size_t k = min ( k_max, size2_ - c ) ;
+
+  const size_t pivots = find_block_pivots ( r, c, k, pivot_columns ) ;
+
+  if ( pivots == 0 )
+    continue ;
+
+  // table [ s ]: the sum of the pivots with the columns selected by s,
+  // from word w0
+
+  const size_t w0 = c / word_bit_size,
+               row_words = row_word_size_ - w0 ;
+
+  size_t pivot_mask = 0 ;
+
+  for ( size_t p = 0 ; p < pivots ; ++ p )
+    pivot_mask |= size_t ( 1 ) << pivot_columns [ p ] ;
+
+  table.assign ( ( size_t ( 1 ) << k ) * row_words, Word ( 0 ) ) ;
+  table_index.assign ( size_t ( 1 ) << pivots, 0 ) ;
+
+  for ( size_t s = 1 ; s < table_index.size ( ) ; ++ s )
+    {
+    size_t p = trailing_zero_count ( s ),
+           t = table_index [ s & ( s - 1 ) ] ;
+
+    table_index [ s ] = t | size_t ( 1 ) << pivot_columns [ p ] ;
+
+    Word * q = table.data ( ) + table_index [ s ] * row_words ;
+
+    copy_n ( table.data ( ) + t * row_words, row_words, q ) ;
+    add_words ( q, row_data ( r + p ) + w0, row_words ) ;
+    }
+
+  const size_t first_pivot = r,
+               last_pivot = r + pivots ;
+
+  for_row_ranges ( size1_, row_words,
+                   [ & ] ( size_t first, size_t last )
+                   { for ( size_t i = first ; i < last ; ++ i )
+                       {
+                       if (     ( i < first_pivot  &&  ! reduced )
+                            ||  ( i >= first_pivot  &&  i < last_pivot ) )
+                         continue ;
+
+                       size_t b = row_bits ( i, c, k ) & pivot_mask ;
+
+                       if ( b != 0 )
+                         add_words ( row_data ( i ) + w0,
+                                     table.data ( ) + b * row_words,
+                                     row_words ) ;
+                       } },
+                   pool ) ;
+
+  r = last_pivot ;
+  }
+
+return r ;
+}
+
+
+// returns: the matrix with extra_columns 0 columns appended
+
+template < class Word, class Allocator >
+basic_bit_matrix < Word, Allocator >
+  basic_bit_matrix < Word, Allocator > ::
+    augmented ( size_t extra_columns ) const
+
+{
+basic_bit_matrix x ( size1_, size2_ + extra_columns ) ;
+
+for ( size_t i = 0 ; i < size1_ ; ++ i )
+  copy_n ( row_data ( i ), row_word_size_, x.row_data ( i ) ) ;
+
+return x ;
+}
+
+
+//
+
+template < class Word, class Allocator >
+basic_bit_matrix < Word, Allocator >
+  basic_bit_matrix < Word, Allocator > ::
+    kernel ( thread_pool * pool ) const
+
+{
+basic_bit_matrix a ( * this ) ;
+
+const size_t r = a.echelonize ( true, pool ) ;
+
+// pivot columns of the rows of a, and the other, free, columns
+
+vector < size_t > pivot_columns ( r ) ;
+vector < size_t > free_columns ;
+free_columns.reserve ( size2_ - r ) ;
+
+for ( size_t i = 0, j = 0 ; j < size2_ ; ++ j )
+  if ( i < r  &&  a.get ( i, j ) )
+    {
+    pivot_columns [ i ] = j ;
+    ++ i ;
+    }
+  else
+    free_columns.push_back ( j ) ;
+
+basic_bit_matrix x ( free_columns.size ( ), size2_ ) ;
+
+for ( size_t t = 0 ; t < free_columns.size ( ) ; ++ t )
+  {
+  size_t f = free_columns [ t ] ;
+
+  x.set ( t, f, true ) ;
+
+  for ( size_t i = 0 ; i < r ; ++ i )
+    if ( a.get ( i, f ) )
+      x.set ( t, pivot_columns [ i ], true ) ;
+  }
+
+return x ;
+}
+
+
+//
+
+template < class Word, class Allocator >
+bool basic_bit_matrix < Word, Allocator > ::
+  solve ( const bit_vector_type & b,
+          bit_vector_type & x,
+          thread_pool * pool ) const
+
+{
+if ( b.size ( ) != size1_ )
+  throw invalid_argument ( "bit_matrix :: solve, size mismatch" ) ;
+
+basic_bit_matrix a ( augmented ( 1 ) ) ;
+
+for ( size_t i = 0 ; i < size1_ ; ++ i )
+  a.set ( i, size2_, b [ i ] ) ;
+
+const size_t r = a.echelonize ( true, pool ) ;
+
+x.assign ( size2_, false ) ;
+
+for ( size_t i = 0, j = 0 ; i < r ; ++ i )
+  {
+  while ( ! a.get ( i, j ) )
+    ++ j ;
+
+  // a pivot in the column of b means 0 = 1
+
+  if ( j == size2_ )
+    return false ;
+
+  x [ j ] = a.get ( i, size2_ ) ;
+  }
+
+return true ;
+}
+
+
+//
+
+template < class Word, class Allocator >
+basic_bit_matrix < Word, Allocator > &
+  basic_bit_matrix < Word, Allocator > ::
+    operator += ( const basic_bit_matrix & b )
+
+{
+if ( size1_ != b.size1_  ||  size2_ != b.size2_ )
+  throw invalid_argument ( "bit_matrix :: operator +=, size mismatch" ) ;
+
+add_words ( data_.data ( ), b.data_.data ( ), data_.size ( ) ) ;
+
+return * this ;
+}
+
+
+//
+
+template < class Word, class Allocator >
+inline basic_bit_matrix < Word, Allocator >
+  operator + ( const basic_bit_matrix < Word, Allocator > & a,
+               const basic_bit_matrix < Word, Allocator > & b )
+
+{
+basic_bit_matrix < Word, Allocator > x ( a ) ;
+x += b ;
+return x ;
+}
+
+
+// returns: a * b, computed on the threads of pool, or on the calling
+//          thread if pool is nullptr
+
+template < class Word, class Allocator >
+basic_bit_matrix < Word, Allocator >
+  multiply ( const basic_bit_matrix < Word, Allocator > & a,
+             const basic_bit_matrix < Word, Allocator > & b,
+             thread_pool * pool = nullptr )
+
+{
+typedef basic_bit_matrix < Word, Allocator > matrix_type ;
+
+if ( a.size2_ != b.size1_ )
+  throw invalid_argument ( "bit_matrix :: multiply, size mismatch" ) ;
+
+matrix_type x ( a.size1_, b.size2_ ) ;
+
+const size_t k_max = matrix_type :: table_bits ( a.size2_ ),
+             row_words = b.row_word_size_ ;
+
+vector < Word, Allocator > table ;
+
+for ( size_t c = 0 ; c < a.size2_ ; c += k_max )
+  {
+  const size_t k = min ( k_max, a.size2_ - c ) ;
+
+  // table [ s ]: the sum of the rows c + p of b for the bits p of s
+
+  table.assign ( ( size_t ( 1 ) << k ) * row_words, Word ( 0 ) ) ;
+
+  for ( size_t s = 1 ; s < size_t ( 1 ) << k ; ++ s )
+    {
+    Word * q = table.data ( ) + s * row_words ;
+
+    copy_n ( table.data ( ) + ( s & ( s - 1 ) ) * row_words, row_words, q ) ;
+    matrix_type :: add_words ( q,
+                               b.row_data ( c + trailing_zero_count ( s ) ),
+                               row_words ) ;
+    }
+
+  matrix_type :: for_row_ranges
+    ( a.size1_, row_words,
+      [ & ] ( size_t first, size_t last )
+      { for ( size_t i = first ; i < last ; ++ i )
+          {
+          size_t s = a.row_bits ( i, c, k ) ;
+
+          if ( s != 0 )
+            matrix_type :: add_words ( x.row_data ( i ),
+                                       table.data ( ) + s * row_words,
+                                       row_words ) ;
+          } },
+      pool ) ;
+  }
+
+return x ;
+}
+
+
+//
+
+template < class Word, class Allocator >
+inline basic_bit_matrix < Word, Allocator >
+  operator * ( const basic_bit_matrix < Word, Allocator > & a,
+               const basic_bit_matrix < Word, Allocator > & b )
+
+{
+return multiply ( a, b ) ;
+}
+
+
+// returns: transpose of a, transposed in blocks of word_bit_size x
+//          word_bit_size bits (see transpose_bits)
+
+template < class Word, class Allocator >
+basic_bit_matrix < Word, Allocator >
+  transpose ( const basic_bit_matrix < Word, Allocator > & a )
+
+{
+basic_bit_matrix < Word, Allocator > x ( a.size2 ( ), a.size1 ( ) ) ;
+
+if ( a.size1 ( ) > 0  &&  a.size2 ( ) > 0 )
+  transpose_bits ( a.row_data ( 0 ), a.size1 ( ), a.size2 ( ),
+                   x.row_data ( 0 ) ) ;
+
+return x ;
+}
+
+
+// returns: inverse of a, computed on the threads of pool, or on the
+//          calling thread if pool is nullptr; singular is set to whether
+//          a is singular, in which case the result is unspecified
+
+template < class Word, class Allocator >
+basic_bit_matrix < Word, Allocator >
+  inverse ( const basic_bit_matrix < Word, Allocator > & a,
+            bool & singular,
+            thread_pool * pool = nullptr )
+
+{
+typedef basic_bit_matrix < Word, Allocator > matrix_type ;
+
+const size_t n = a.size1 ( ) ;
+
+if ( a.size2 ( ) != n )
+  throw invalid_argument ( "bit_matrix :: inverse, matrix not square" ) ;
+
+// [ a | 1 ] reduced to [ 1 | a ^ -1 ]
+
+matrix_type b ( n, 2 * n ) ;
+
+for ( size_t i = 0 ; i < n ; ++ i )
+  {
+  copy_n ( a.row_data ( i ), a.row_word_size ( ), b.row_data ( i ) ) ;
+  b.set ( i, n + i, true ) ;
+  }
+
+b.echelonize ( true, pool ) ;
+
+// a is regular if and only if all pivots are in its columns
+
+singular = n > 0  &&  ! b.get ( n - 1, n - 1 ) ;
+
+matrix_type x ( n, n ) ;
+
+for ( size_t i = 0 ; i < n ; ++ i )
+  {
+  const_bit_iterator < Word > source ( b.row_data ( i ), n ) ;
+
+  Word * p = x.row_data ( i ) ;
+
+  for ( size_t j = 0 ; j < n ; j += matrix_type :: word_bit_size )
+    {
+    * p = source.word ( min ( n - j, matrix_type :: word_bit_size ) ) ;
+    ++ p ;
+    source += matrix_type :: word_bit_size ;
+    }
+  }
+
+return x ;
+}
+
+
+//
+
+template < class Word, class Allocator >
+inline basic_bit_matrix < Word, Allocator >
+  inverse ( const basic_bit_matrix < Word, Allocator > & a,
+            thread_pool * pool = nullptr )
+
+{
+bool singular ;
+return inverse ( a, singular, pool ) ;
+}
+
+
+//
+
+template < class Word, class Allocator >
+bool operator == ( const basic_bit_matrix < Word, Allocator > & a,
+                   const basic_bit_matrix < Word, Allocator > & b )
+
+{
+return     a.size1_ == b.size1_
+       &&  a.size2_ == b.size2_
+       &&  a.data_ == b.data_ ;
+}
+
+
+//
+
+template < class Word, class Allocator >
+inline bool operator != ( const basic_bit_matrix < Word, Allocator > & a,
+                          const basic_bit_matrix < Word, Allocator > & b )
+
+{
+return ! ( a == b ) ;
+}
+
+
+//
+
+template < class Word, class Allocator >
+inline void swap ( basic_bit_matrix < Word, Allocator > & a,
+                   basic_bit_matrix < Word, Allocator > & b ) noexcept
+
+{
+a.swap ( b ) ;
+}
+
+
+
+// *** BIT_MATRIX ***
+
+
+typedef basic_bit_matrix < uint > bit_matrix ;
+
+
+
+#endif
@@ -19,6 +19,7 @@
 #include "algorithm.h"
 
 #include "numbase.h"
+#include "bitcount.h"
 
 
 
@@ -196,6 +197,9 @@ ptrdiff_t count_bit_0 ( BitIterator iter, size_t n ) ;
 
 //
 
+template < class Word >
+void copy_selected_bits ( Word source, Word selected_bits, Word & dest ) ;
+
 template < class SourceBitIterator, class DestBitIterator >
 DestBitIterator copy_n_bits ( SourceBitIterator source,
                               size_t n,
@@ -206,6 +210,23 @@ DestReverseBitIterator reverse_copy_n_bits ( SourceReverseBitIterator source,
                                              size_t n,
                                              DestReverseBitIterator dest ) ;
 
+template < class SourceBitIterator1, class SourceBitIterator2,
+           class DestBitIterator, class Operation >
+DestBitIterator transform_n_bits ( SourceBitIterator1 source1,
+                                   size_t n,
+                                   SourceBitIterator2 source2,
+                                   DestBitIterator dest,
+                                   Operation op ) ;
+
+template < class SourceReverseBitIterator1, class SourceReverseBitIterator2,
+           class DestReverseBitIterator, class Operation >
+DestReverseBitIterator
+  reverse_transform_n_bits ( SourceReverseBitIterator1 source1,
+                             size_t n,
+                             SourceReverseBitIterator2 source2,
+                             DestReverseBitIterator dest,
+                             Operation op ) ;
+
 
 
 // *** BIT_REFERENCE ***
@@ -415,6 +436,14 @@ private:
                                         size_t n,
                                         bit_iterator dest ) ;
 
+  template < class SourceBitIterator1, class SourceBitIterator2,
+             class DestBitIterator, class Operation >
+  friend DestBitIterator transform_n_bits ( SourceBitIterator1 source1,
+                                            size_t n,
+                                            SourceBitIterator2 source2,
+                                            DestBitIterator dest,
+                                            Operation op ) ;
+
   typedef Word word_type ;
 
   static constexpr size_t word_bit_size = numeric_traits < Word > :: bit_size ;
@@ -471,6 +500,33 @@ public:
         w &= ( Word ( 1 ) << bit_size ) - 1 ;
       return w ; }
 
+  void assign_word ( Word w, size_t bit_size = word_bit_size ) const noexcept
+    { assert ( bit_size > 0  &&  bit_size <= word_bit_size ) ;
+      Word m = unsigned_shift_right ( Word ( -1 ), word_bit_size - bit_size ) ;
+      copy_selected_bits ( Word ( w << bit_position ),
+                           Word ( m << bit_position ),
+                           * word_position ) ;
+      if ( bit_position + bit_size > word_bit_size )
+        copy_selected_bits
+          ( unsigned_shift_right ( w, word_bit_size - bit_position ),
+            unsigned_shift_right ( m, word_bit_size - bit_position ),
+            * ( word_position + 1 ) ) ; }
+
+  void non_atomic_assign_word ( Word w,
+                                size_t bit_size = word_bit_size ) const noexcept
+    { assert ( bit_size > 0  &&  bit_size <= word_bit_size ) ;
+      Word m = unsigned_shift_right ( Word ( -1 ), word_bit_size - bit_size ) ;
+      w &= m ;
+      * word_position =   ( * word_position & ~ ( m << bit_position ) )
+                        | w << bit_position ;
+      if ( bit_position + bit_size > word_bit_size )
+        {
+        size_t s = word_bit_size - bit_position ;
+        * ( word_position + 1 ) =
+            ( * ( word_position + 1 ) & ~ unsigned_shift_right ( m, s ) )
+          | unsigned_shift_right ( w, s ) ;
+        } }
+
   bit_iterator & operator ++ ( ) noexcept
     { if ( bit_position == word_bit_size_1 )
         {
@@ -579,6 +635,14 @@ private:
                                                  size_t n,
                                                  bit_iterator < Word > dest ) ;
 
+  template < class SourceBitIterator1, class SourceBitIterator2,
+             class DestBitIterator, class Operation >
+  friend DestBitIterator transform_n_bits ( SourceBitIterator1 source1,
+                                            size_t n,
+                                            SourceBitIterator2 source2,
+                                            DestBitIterator dest,
+                                            Operation op ) ;
+
   typedef Word word_type ;
 
   static constexpr size_t word_bit_size = numeric_traits < Word > :: bit_size ;
@@ -753,6 +817,16 @@ private:
                                      size_t n,
                                      reverse_bit_iterator dest ) ;
 
+  template < class SourceReverseBitIterator1,
+             class SourceReverseBitIterator2,
+             class DestReverseBitIterator, class Operation >
+  friend DestReverseBitIterator
+           reverse_transform_n_bits ( SourceReverseBitIterator1 source1,
+                                      size_t n,
+                                      SourceReverseBitIterator2 source2,
+                                      DestReverseBitIterator dest,
+                                      Operation op ) ;
+
   typedef Word word_type ;
 
   static constexpr size_t word_bit_size = numeric_traits < Word > :: bit_size ;
@@ -920,6 +994,16 @@ private:
                                      size_t n,
                                      reverse_bit_iterator < Word > dest ) ;
 
+  template < class SourceReverseBitIterator1,
+             class SourceReverseBitIterator2,
+             class DestReverseBitIterator, class Operation >
+  friend DestReverseBitIterator
+           reverse_transform_n_bits ( SourceReverseBitIterator1 source1,
+                                      size_t n,
+                                      SourceReverseBitIterator2 source2,
+                                      DestReverseBitIterator dest,
+                                      Operation op ) ;
+
   typedef Word word_type ;
 
   static constexpr size_t word_bit_size = numeric_traits < Word > :: bit_size ;
@@ -1140,9 +1224,7 @@ template < class Word >
 inline size_t raw_find_bit_1 ( Word w )
 
 {
-for ( size_t i = 0 ; ; ++ i )
-  if ( ( w >> i ) & 1 )
-    return i ;
+return trailing_zero_count ( w ) ;
 }
 
 
@@ -1163,9 +1245,7 @@ template < class Word >
 inline size_t raw_find_bit_0 ( Word w )
 
 {
-for ( size_t i = 0 ; ; ++ i )
-  if ( ! ( ( w >> i ) & 1 ) )
-    return i ;
+return trailing_zero_count ( Word ( ~ w ) ) ;
 }
 
 
@@ -1175,8 +1255,8 @@ template < class Word >
 inline size_t find_bit_0 ( Word w )
 
 {
-return w == -1 ? numeric_traits < Word > :: bit_size
-               : raw_find_bit_0 ( w ) ;
+return w == Word ( -1 ) ? numeric_traits < Word > :: bit_size
+                        : raw_find_bit_0 ( w ) ;
 }
 
 
@@ -1186,9 +1266,9 @@ template < class Word >
 inline size_t raw_find_last_bit_1 ( Word w )
 
 {
-for ( size_t i = numeric_traits < Word > :: bit_size - 1 ; ; -- i )
-  if ( ( w >> i ) & 1 )
-    return i ;
+typedef typename numeric_traits < Word > :: unsigned_type unsigned_type ;
+
+return exponent ( static_cast < unsigned_type > ( w ) ) - 1 ;
 }
 
 
@@ -1230,9 +1310,9 @@ template < class Word >
 inline size_t raw_find_last_bit_0 ( Word w )
 
 {
-for ( size_t i = numeric_traits < Word > :: bit_size - 1 ; ; -- i )
-  if ( ! ( ( w >> i ) & 1 ) )
-    return i ;
+typedef typename numeric_traits < Word > :: unsigned_type unsigned_type ;
+
+return exponent ( static_cast < unsigned_type > ( ~ w ) ) - 1 ;
 }
 
 
@@ -1242,8 +1322,8 @@ template < class Word >
 inline size_t find_last_bit_0 ( Word w )
 
 {
-return w == -1 ? -1
-               : raw_find_last_bit_0 ( w ) ;
+return w == Word ( -1 ) ? -1
+                        : raw_find_last_bit_0 ( w ) ;
 }
 
 
@@ -1263,8 +1343,54 @@ template < class Word >
 inline size_t reverse_find_bit_0 ( Word w )
 
 {
-return w == -1 ? numeric_traits < Word > :: bit_size
-               : raw_reverse_find_bit_0 ( w ) ;
+return w == Word ( -1 ) ? numeric_traits < Word > :: bit_size
+                        : raw_reverse_find_bit_0 ( w ) ;
+}
+
+
+// returns: number of the leading words among p [ 0 ], ..., p [ n - 1 ]
+//          equal to w
+
+template < class Word >
+inline size_t count_leading_words ( const Word * p, size_t n, Word w )
+
+{
+size_t i = 0 ;
+
+for ( ; i + 4 <= n ; i += 4 )
+  if (    ( p [ i ] ^ w )
+        | ( p [ i + 1 ] ^ w )
+        | ( p [ i + 2 ] ^ w )
+        | ( p [ i + 3 ] ^ w ) )
+    break ;
+
+while ( i < n  &&  p [ i ] == w )
+  ++ i ;
+
+return i ;
+}
+
+
+// returns: number of the trailing words among p [ 1 - n ], ..., p [ 0 ]
+//          equal to w
+
+template < class Word >
+inline size_t count_trailing_words ( const Word * p, size_t n, Word w )
+
+{
+size_t i = 0 ;
+
+for ( ; i + 4 <= n ; i += 4 )
+  if (    ( * ( p - i ) ^ w )
+        | ( * ( p - i - 1 ) ^ w )
+        | ( * ( p - i - 2 ) ^ w )
+        | ( * ( p - i - 3 ) ^ w ) )
+    break ;
+
+while ( i < n  &&  * ( p - i ) == w )
+  ++ i ;
+
+return i ;
 }
 
 
@@ -1298,15 +1424,17 @@ if ( iter.bit_position > 0 )
   n -= relevant_bits ;
   }
 
-while ( n >= word_bit_size )
-  {
-  if ( * iter.word_position )
-    return BitIterator ( iter.word_position,
-                         raw_find_bit_1 ( * iter.word_position ) ) ;
+{
+size_t k = count_leading_words
+             ( iter.word_position, n / word_bit_size, word_type ( 0 ) ) ;
 
-  ++ iter.word_position ;
-  n -= word_bit_size ;
-  }
+iter.word_position += k ;
+n -= k * word_bit_size ;
+}
+
+if ( n >= word_bit_size )
+  return BitIterator ( iter.word_position,
+                       raw_find_bit_1 ( * iter.word_position ) ) ;
 
 if ( n > 0 )
   {
@@ -1340,7 +1468,7 @@ if ( iter.bit_position > 0 )
   word_type w =   ( * iter.word_position >> iter.bit_position )
                 | ( word_type ( -1 ) << relevant_bits ) ;
 
-  if ( w != -1 )
+  if ( w != word_type ( -1 ) )
     return iter + raw_find_bit_0 ( w ) ;
 
   if ( n == relevant_bits )
@@ -1350,21 +1478,23 @@ if ( iter.bit_position > 0 )
   n -= relevant_bits ;
   }
 
-while ( n >= word_bit_size )
-  {
-  if ( * iter.word_position != -1 )
-    return BitIterator ( iter.word_position,
-                         raw_find_bit_0 ( * iter.word_position ) ) ;
+{
+size_t k = count_leading_words
+             ( iter.word_position, n / word_bit_size, word_type ( -1 ) ) ;
 
-  ++ iter.word_position ;
-  n -= word_bit_size ;
-  }
+iter.word_position += k ;
+n -= k * word_bit_size ;
+}
+
+if ( n >= word_bit_size )
+  return BitIterator ( iter.word_position,
+                       raw_find_bit_0 ( * iter.word_position ) ) ;
 
 if ( n > 0 )
   {
   word_type w = * iter.word_position | ( word_type ( -1 ) << n ) ;
 
-  if ( w != -1 )
+  if ( w != word_type ( -1 ) )
     return BitIterator ( iter.word_position, raw_find_bit_0 ( w ) ) ;
   }
 
@@ -1404,15 +1534,17 @@ if ( iter.bit_position < word_bit_size_1 )
   n -= relevant_bits ;
   }
 
-while ( n >= word_bit_size )
-  {
-  if ( * iter.word_position )
-    return ReverseBitIterator ( iter.word_position,
-                                raw_find_last_bit_1 ( * iter.word_position ) ) ;
+{
+size_t k = count_trailing_words
+             ( iter.word_position, n / word_bit_size, word_type ( 0 ) ) ;
 
-  -- iter.word_position ;
-  n -= word_bit_size ;
-  }
+iter.word_position -= k ;
+n -= k * word_bit_size ;
+}
+
+if ( n >= word_bit_size )
+  return ReverseBitIterator ( iter.word_position,
+                              raw_find_last_bit_1 ( * iter.word_position ) ) ;
 
 if ( n > 0 )
   {
@@ -1450,7 +1582,7 @@ if ( iter.bit_position < word_bit_size_1 )
     w =   ( * iter.word_position << ( word_bit_size_1 - iter.bit_position ) )
         | ( ( word_type ( 1 ) << ( word_bit_size - relevant_bits ) ) - 1 ) ;
 
-  if ( w != -1 )
+  if ( w != word_type ( -1 ) )
     return iter + raw_reverse_find_bit_0 ( w ) ;
 
   if ( n == relevant_bits )
@@ -1460,22 +1592,24 @@ if ( iter.bit_position < word_bit_size_1 )
   n -= relevant_bits ;
   }
 
-while ( n >= word_bit_size )
-  {
-  if ( * iter.word_position != -1 )
-    return ReverseBitIterator ( iter.word_position,
-                                raw_find_last_bit_0 ( * iter.word_position ) ) ;
+{
+size_t k = count_trailing_words
+             ( iter.word_position, n / word_bit_size, word_type ( -1 ) ) ;
 
-  -- iter.word_position ;
-  n -= word_bit_size ;
-  }
+iter.word_position -= k ;
+n -= k * word_bit_size ;
+}
+
+if ( n >= word_bit_size )
+  return ReverseBitIterator ( iter.word_position,
+                              raw_find_last_bit_0 ( * iter.word_position ) ) ;
 
 if ( n > 0 )
   {
   word_type w =   * iter.word_position
                 | ( ( word_type ( 1 ) << ( word_bit_size - n ) ) - 1 ) ;
 
-  if ( w != -1 )
+  if ( w != word_type ( -1 ) )
     return ReverseBitIterator ( iter.word_position,
                                 raw_find_last_bit_0 ( w ) ) ;
   }
@@ -1594,13 +1728,14 @@ if ( iter.bit_position > 0 )
   n -= relevant_bits ;
   }
 
-while ( n >= word_bit_size )
-  {
-  result += hamming_weight ( * iter.word_position ) ;
+{
+size_t k = n / word_bit_size ;
 
-  ++ iter.word_position ;
-  n -= word_bit_size ;
-  }
+result += words_hamming_weight ( iter.word_position, k ) ;
+
+iter.word_position += k ;
+n -= k * word_bit_size ;
+}
 
 if ( n > 0 )
   result += hamming_weight (   * iter.word_position
@@ -1636,13 +1771,15 @@ if ( iter.bit_position > 0 )
   n -= relevant_bits ;
   }
 
-while ( n >= word_bit_size )
-  {
-  result += hamming_weight ( ~ * iter.word_position ) ;
+{
+size_t k = n / word_bit_size ;
 
-  ++ iter.word_position ;
-  n -= word_bit_size ;
-  }
+result +=   k * word_bit_size
+          - words_hamming_weight ( iter.word_position, k ) ;
+
+iter.word_position += k ;
+n -= k * word_bit_size ;
+}
 
 if ( n > 0 )
   result += hamming_weight (   ~ * iter.word_position
@@ -2188,4 +2325,375 @@ return reverse_bit_iterator < Word >
 
 
 
+// *** TRANSFORM ***
+
+
+// a & ~ b
+
+template < class Word >
+class bit_and_not
+
+{
+public:
+
+  Word operator ( ) ( Word a, Word b ) const noexcept
+    { return a & ~ b ; }
+
+} ;
+
+
+// Reads the bits of a bit iterator range starting at an arbitrary bit
+// position, a word at a time, by funnel shifts of adjacent words.
+
+template < class Word >
+class __bit_word_reader
+
+{
+private:
+
+  static constexpr size_t word_bit_size = numeric_traits < Word > :: bit_size ;
+
+  const Word * word_position ;
+  size_t bit_position ;
+
+public:
+
+  __bit_word_reader ( const Word * i_word_position,
+                      size_t i_bit_position ) noexcept :
+    word_position ( i_word_position ),
+    bit_position ( i_bit_position )
+    { }
+
+  // pre: 0 < n <= word_bit_size
+  //
+  // returns: the next n bits in the low bits, the other bits are
+  //          unspecified
+
+  Word read ( size_t n ) noexcept
+    { Word w = unsigned_shift_right ( * word_position, bit_position ) ;
+      size_t available = word_bit_size - bit_position ;
+      if ( n < available )
+        bit_position += n ;
+      else
+        {
+        ++ word_position ;
+        bit_position = n - available ;
+        if ( bit_position > 0 )
+          w |= * word_position << available ;
+        }
+      return w ; }
+
+  // returns: the next word_bit_size bits
+
+  Word read_word ( ) noexcept
+    { Word w = * word_position ;
+      ++ word_position ;
+      if ( bit_position > 0 )
+        w =   unsigned_shift_right ( w, bit_position )
+            | * word_position << ( word_bit_size - bit_position ) ;
+      return w ; }
+
+} ;
+
+
+// Reads the bits of a reverse bit iterator range starting at an arbitrary
+// bit position, a word at a time, by funnel shifts of adjacent words.
+
+template < class Word >
+class __reverse_bit_word_reader
+
+{
+private:
+
+  static constexpr size_t word_bit_size = numeric_traits < Word > :: bit_size ;
+  static constexpr size_t word_bit_size_1 = word_bit_size - 1 ;
+
+  const Word * word_position ;
+  size_t bit_position ;
+
+public:
+
+  __reverse_bit_word_reader ( const Word * i_word_position,
+                              size_t i_bit_position ) noexcept :
+    word_position ( i_word_position ),
+    bit_position ( i_bit_position )
+    { }
+
+  // pre: 0 < n <= word_bit_size
+  //
+  // returns: the next n bits in the high bits, the other bits are
+  //          unspecified
+
+  Word read ( size_t n ) noexcept
+    { Word w = * word_position << ( word_bit_size_1 - bit_position ) ;
+      size_t available = bit_position + 1 ;
+      if ( n < available )
+        bit_position -= n ;
+      else
+        {
+        -- word_position ;
+        bit_position = word_bit_size_1 - ( n - available ) ;
+        if ( n > available )
+          w |= unsigned_shift_right ( * word_position, available ) ;
+        }
+      return w ; }
+
+  // returns: the next word_bit_size bits
+
+  Word read_word ( ) noexcept
+    { Word w = * word_position ;
+      -- word_position ;
+      if ( bit_position < word_bit_size_1 )
+        w =   w << ( word_bit_size_1 - bit_position )
+            | unsigned_shift_right ( * word_position, bit_position + 1 ) ;
+      return w ; }
+
+} ;
+
+
+// Assigns op ( x1, x2 ) to the n bits from dest, where x1 and x2 are the
+// corresponding bits from source1 and source2, a word at a time. op is
+// applied to words and has to act on each bit independently (bit_and,
+// bit_or, bit_xor, bit_and_not, ...). The destination range may be equal
+// to a source range, but must not overlap it otherwise.
+//
+// pre:    SourceBitIterator1 :: word_type == DestBitIterator :: word_type
+//     &&  SourceBitIterator2 :: word_type == DestBitIterator :: word_type
+
+template < class SourceBitIterator1, class SourceBitIterator2,
+           class DestBitIterator, class Operation >
+DestBitIterator transform_n_bits ( SourceBitIterator1 source1,
+                                   size_t n,
+                                   SourceBitIterator2 source2,
+                                   DestBitIterator dest,
+                                   Operation op )
+
+{
+typedef typename DestBitIterator :: word_type word_type ;
+
+constexpr size_t word_bit_size = DestBitIterator :: word_bit_size ;
+
+if ( n == 0 )
+  return dest ;
+
+__bit_word_reader < word_type >
+  reader1 ( source1.word_position, source1.bit_position ),
+  reader2 ( source2.word_position, source2.bit_position ) ;
+
+if ( dest.bit_position > 0 )
+  {
+  size_t relevant_bits = min ( word_bit_size - dest.bit_position, n ) ;
+
+  word_type w1 = reader1.read ( relevant_bits ),
+            w2 = reader2.read ( relevant_bits ) ;
+
+  copy_selected_bits
+    ( word_type ( word_type ( op ( w1, w2 ) ) << dest.bit_position ),
+      word_type (    ( ( word_type ( 1 ) << relevant_bits ) - 1 )
+                  << dest.bit_position ),
+      * dest.word_position ) ;
+
+  if ( n == relevant_bits )
+    return dest + n ;
+
+  ++ dest.word_position ;
+  n -= relevant_bits ;
+  }
+
+while ( n >= word_bit_size )
+  {
+  word_type w1 = reader1.read_word ( ),
+            w2 = reader2.read_word ( ) ;
+
+  * dest.word_position = op ( w1, w2 ) ;
+  ++ dest.word_position ;
+  n -= word_bit_size ;
+  }
+
+if ( n > 0 )
+  {
+  word_type w1 = reader1.read ( n ),
+            w2 = reader2.read ( n ) ;
+
+  copy_selected_bits ( word_type ( op ( w1, w2 ) ),
+                       word_type ( ( word_type ( 1 ) << n ) - 1 ),
+                       * dest.word_position ) ;
+  }
+
+return DestBitIterator ( dest.word_position, n ) ;
+}
+
+
+// Assigns op ( x1, x2 ) to the n bits from dest, where x1 and x2 are the
+// corresponding bits from source1 and source2, going backwards, a word at
+// a time (see transform_n_bits).
+//
+// pre:       SourceReverseBitIterator1 :: word_type
+//         == DestReverseBitIterator :: word_type
+//     &&     SourceReverseBitIterator2 :: word_type
+//         == DestReverseBitIterator :: word_type
+
+template < class SourceReverseBitIterator1, class SourceReverseBitIterator2,
+           class DestReverseBitIterator, class Operation >
+DestReverseBitIterator
+  reverse_transform_n_bits ( SourceReverseBitIterator1 source1,
+                             size_t n,
+                             SourceReverseBitIterator2 source2,
+                             DestReverseBitIterator dest,
+                             Operation op )
+
+{
+typedef typename DestReverseBitIterator :: word_type word_type ;
+
+constexpr size_t word_bit_size = DestReverseBitIterator :: word_bit_size,
+                 word_bit_size_1 = DestReverseBitIterator :: word_bit_size_1 ;
+
+if ( n == 0 )
+  return dest ;
+
+__reverse_bit_word_reader < word_type >
+  reader1 ( source1.word_position, source1.bit_position ),
+  reader2 ( source2.word_position, source2.bit_position ) ;
+
+if ( dest.bit_position < word_bit_size_1 )
+  {
+  size_t relevant_bits = min ( dest.bit_position + 1, n ) ;
+
+  word_type w1 = reader1.read ( relevant_bits ),
+            w2 = reader2.read ( relevant_bits ) ;
+
+  copy_selected_bits
+    ( unsigned_shift_right ( word_type ( op ( w1, w2 ) ),
+                             word_bit_size_1 - dest.bit_position ),
+      word_type (    ( ( word_type ( 1 ) << relevant_bits ) - 1 )
+                  << ( dest.bit_position + 1 - relevant_bits ) ),
+      * dest.word_position ) ;
+
+  if ( n == relevant_bits )
+    return dest + n ;
+
+  -- dest.word_position ;
+  n -= relevant_bits ;
+  }
+
+while ( n >= word_bit_size )
+  {
+  word_type w1 = reader1.read_word ( ),
+            w2 = reader2.read_word ( ) ;
+
+  * dest.word_position = op ( w1, w2 ) ;
+  -- dest.word_position ;
+  n -= word_bit_size ;
+  }
+
+if ( n > 0 )
+  {
+  word_type w1 = reader1.read ( n ),
+            w2 = reader2.read ( n ) ;
+
+  copy_selected_bits ( word_type ( op ( w1, w2 ) ),
+                       word_type ( word_type ( -1 ) << ( word_bit_size - n ) ),
+                       * dest.word_position ) ;
+  }
+
+return DestReverseBitIterator ( dest.word_position, word_bit_size_1 - n ) ;
+}
+
+
+// Assigns op ( x, y ) to the n bits from dest, where x is the bit from dest
+// and y the corresponding bit from source (see transform_n_bits).
+
+template < class SourceBitIterator, class DestBitIterator, class Operation >
+inline DestBitIterator transform_n_bits ( SourceBitIterator source,
+                                          size_t n,
+                                          DestBitIterator dest,
+                                          Operation op )
+
+{
+return transform_n_bits ( dest, n, source, dest, op ) ;
+}
+
+
+// Assigns op ( x, y ) to the n bits from dest, where x is the bit from dest
+// and y the corresponding bit from source, going backwards (see
+// transform_n_bits).
+
+template < class SourceReverseBitIterator, class DestReverseBitIterator,
+           class Operation >
+inline DestReverseBitIterator
+         reverse_transform_n_bits ( SourceReverseBitIterator source,
+                                    size_t n,
+                                    DestReverseBitIterator dest,
+                                    Operation op )
+
+{
+return reverse_transform_n_bits ( dest, n, source, dest, op ) ;
+}
+
+
+//
+
+template < class SourceBitIterator1, class SourceBitIterator2,
+           class DestBitIterator, class Operation >
+inline DestBitIterator transform_bits ( SourceBitIterator1 first1,
+                                        SourceBitIterator1 last1,
+                                        SourceBitIterator2 first2,
+                                        DestBitIterator result,
+                                        Operation op )
+
+{
+assert ( valid_bit_iterator_range ( first1, last1 ) ) ;
+return transform_n_bits ( first1, last1 - first1, first2, result, op ) ;
+}
+
+
+//
+
+template < class SourceReverseBitIterator1, class SourceReverseBitIterator2,
+           class DestReverseBitIterator, class Operation >
+inline DestReverseBitIterator
+         reverse_transform_bits ( SourceReverseBitIterator1 first1,
+                                  SourceReverseBitIterator1 last1,
+                                  SourceReverseBitIterator2 first2,
+                                  DestReverseBitIterator result,
+                                  Operation op )
+
+{
+assert ( valid_bit_iterator_range ( first1, last1 ) ) ;
+return reverse_transform_n_bits ( first1, last1 - first1, first2, result,
+                                  op ) ;
+}
+
+
+//
+
+template < class SourceBitIterator, class DestBitIterator, class Operation >
+inline DestBitIterator transform_bits ( SourceBitIterator first,
+                                        SourceBitIterator last,
+                                        DestBitIterator result,
+                                        Operation op )
+
+{
+assert ( valid_bit_iterator_range ( first, last ) ) ;
+return transform_n_bits ( first, last - first, result, op ) ;
+}
+
+
+//
+
+template < class SourceReverseBitIterator, class DestReverseBitIterator,
+           class Operation >
+inline DestReverseBitIterator
+         reverse_transform_bits ( SourceReverseBitIterator first,
+                                  SourceReverseBitIterator last,
+                                  DestReverseBitIterator result,
+                                  Operation op )
+
+{
+assert ( valid_bit_iterator_range ( first, last ) ) ;
+return reverse_transform_n_bits ( first, last - first, result, op ) ;
+}
+
+
+
 #endif
@@ -0,0 +1,563 @@
+// Copyright Ivan Stanojevic 2025.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+
+
+
+#ifndef __BITSEARCH_H
+
+#define __BITSEARCH_H
+
+
+
+#include "memory.h"
+#include "cstddef.h"
+#include "vector.h"
+#include "algorithm.h"
+#include "stdexcept.h"
+#include "cassert.h"
+#include "future.h"
+
+#include "numbase.h"
+#include "bitcount.h"
+#include "bitvector.h"
+#include "threadpool.h"
+
+
+
+// *** BIT_VECTOR_COLLECTION ***
+
+
+// Bit vectors of the same size, stored contiguously, each one in
+// word_size ( ) words. Bits after the end of each vector are 0.
+
+template < class Word, class Allocator = allocator < Word > >
+class basic_bit_vector_collection
+
+{
+public:
+
+  typedef Word word_type ;
+
+  typedef Allocator allocator_type ;
+
+  typedef basic_bit_vector < Word, Allocator > bit_vector_type ;
+
+  static constexpr size_t word_bit_size = numeric_traits < Word > :: bit_size ;
+
+private:
+
+  size_t bit_size_ ;
+  size_t word_size_ ;
+  size_t size_ ;
+
+  vector < Word, Allocator > data_ ;
+
+  void check_bit_size ( const bit_vector_type & x,
+                        const char * message ) const
+    { if ( x.size ( ) != bit_size_ )
+        throw invalid_argument ( message ) ; }
+
+public:
+
+  explicit basic_bit_vector_collection
+             ( size_t bit_size = 0, const Allocator & a = Allocator ( ) ) :
+    bit_size_ ( bit_size ),
+    word_size_ ( ( bit_size + word_bit_size - 1 ) / word_bit_size ),
+    size_ ( 0 ),
+    data_ ( a )
+    { }
+
+  size_t bit_size ( ) const noexcept
+    { return bit_size_ ; }
+
+  size_t word_size ( ) const noexcept
+    { return word_size_ ; }
+
+  size_t size ( ) const noexcept
+    { return size_ ; }
+
+  bool empty ( ) const noexcept
+    { return size_ == 0 ; }
+
+  void reserve ( size_t n )
+    { data_.reserve ( n * word_size_ ) ; }
+
+  void shrink_to_fit ( )
+    { data_.shrink_to_fit ( ) ; }
+
+  void clear ( ) noexcept
+    { data_.clear ( ) ;
+      size_ = 0 ; }
+
+  const Word * data ( ) const noexcept
+    { return data_.data ( ) ; }
+
+  const Word * data ( size_t n ) const noexcept
+    { assert ( n < size_ ) ;
+      return data_.data ( ) + n * word_size_ ; }
+
+  bit_vector_type get ( size_t n ) const
+    { assert ( n < size_ ) ;
+      bit_vector_type result ( bit_size_ ) ;
+      copy ( data ( n ), data ( n ) + word_size_, result.data ( ) ) ;
+      return result ; }
+
+  void set ( size_t n, const bit_vector_type & x )
+    { assert ( n < size_ ) ;
+      check_bit_size ( x, "bit_vector_collection :: set, size mismatch" ) ;
+      copy ( x.data ( ), x.data ( ) + word_size_,
+             data_.begin ( ) + n * word_size_ ) ; }
+
+  void push_back ( const bit_vector_type & x )
+    { check_bit_size ( x,
+                       "bit_vector_collection :: push_back, size mismatch" ) ;
+      data_.insert ( data_.end ( ), x.data ( ), x.data ( ) + word_size_ ) ;
+      ++ size_ ; }
+
+  void pop_back ( )
+    { assert ( size_ > 0 ) ;
+      data_.resize ( data_.size ( ) - word_size_ ) ;
+      -- size_ ; }
+
+  void swap ( basic_bit_vector_collection & b ) noexcept
+    { :: swap ( bit_size_, b.bit_size_ ) ;
+      :: swap ( word_size_, b.word_size_ ) ;
+      :: swap ( size_, b.size_ ) ;
+      data_.swap ( b.data_ ) ; }
+
+} ;
+
+
+//
+
+template < class Word, class Allocator >
+inline void swap ( basic_bit_vector_collection < Word, Allocator > & a,
+                   basic_bit_vector_collection < Word, Allocator > & b )
+  noexcept
+
+{
+a.swap ( b ) ;
+}
+
+
+//
+
+typedef basic_bit_vector_collection < uint > bit_vector_collection ;
+
+
+
+// *** METRICS ***
+
+
+// A metric computes the score of a pair of bit vectors, given as n words
+// each, and orders scores: better ( x, y ) is true iff x is strictly
+// better than y.
+
+class hamming_metric
+
+{
+public:
+
+  typedef size_t score_type ;
+
+  template < class Word >
+  static size_t score ( const Word * a, const Word * b, size_t n )
+    { return words_hamming_distance ( a, b, n ) ; }
+
+  static bool better ( size_t x, size_t y )
+    { return x < y ; }
+
+} ;
+
+
+// Tanimoto (Jaccard) similarity | a & b | / | a | b |, defined as 1 for
+// two vectors without 1 bits
+
+class tanimoto_metric
+
+{
+public:
+
+  typedef double score_type ;
+
+  template < class Word >
+  static double score ( const Word * a, const Word * b, size_t n )
+    { size_t and_weight, or_weight ;
+      words_and_or_weight ( a, b, n, and_weight, or_weight ) ;
+      return   or_weight == 0
+             ? 1.0
+             : double ( and_weight ) / double ( or_weight ) ; }
+
+  static bool better ( double x, double y )
+    { return x > y ; }
+
+} ;
+
+
+
+// *** BIT_VECTOR_MATCH ***
+
+
+//
+
+template < class Score >
+class bit_vector_match
+
+{
+public:
+
+  size_t index ;
+  Score score ;
+
+  bit_vector_match ( ) :
+    index ( 0 ),
+    score ( )
+    { }
+
+  bit_vector_match ( size_t i_index, Score i_score ) :
+    index ( i_index ),
+    score ( i_score )
+    { }
+
+} ;
+
+
+
+// *** SEARCH ACCUMULATORS ***
+
+
+// Matches are ordered by score, and by index among equal scores, so that
+// results do not depend on the way the search is split into tasks.
+
+template < class Metric >
+class __bit_search_order
+
+{
+public:
+
+  typedef bit_vector_match < typename Metric :: score_type > match_type ;
+
+  bool operator ( ) ( const match_type & x, const match_type & y ) const
+    { return     Metric :: better ( x.score, y.score )
+             ||  (    ! Metric :: better ( y.score, x.score )
+                  &&  x.index < y.index ) ; }
+
+} ;
+
+
+// keeps the k best matches in a heap with the worst one on top
+
+template < class Metric >
+class __top_k_accumulator
+
+{
+public:
+
+  typedef typename Metric :: score_type score_type ;
+
+  typedef bit_vector_match < score_type > match_type ;
+
+  explicit __top_k_accumulator ( size_t i_k = 0 ) :
+    k ( i_k ),
+    heap ( )
+    { }
+
+  void add ( size_t index, score_type score )
+    { match_type m ( index, score ) ;
+      if ( heap.size ( ) < k )
+        {
+        heap.push_back ( m ) ;
+        push_heap ( heap.begin ( ), heap.end ( ),
+                    __bit_search_order < Metric > ( ) ) ;
+        }
+      else if (    k > 0
+               &&  __bit_search_order < Metric > ( ) ( m, heap.front ( ) ) )
+        {
+        pop_heap ( heap.begin ( ), heap.end ( ),
+                   __bit_search_order < Metric > ( ) ) ;
+        heap.back ( ) = m ;
+        push_heap ( heap.begin ( ), heap.end ( ),
+                    __bit_search_order < Metric > ( ) ) ;
+        } }
+
+  void merge ( const __top_k_accumulator & b )
+    { for ( const match_type & m : b.heap )
+        add ( m.index, m.score ) ; }
+
+  vector < match_type > result ( )
+    { sort_heap ( heap.begin ( ), heap.end ( ),
+                  __bit_search_order < Metric > ( ) ) ;
+      return move ( heap ) ; }
+
+private:
+
+  size_t k ;
+  vector < match_type > heap ;
+
+} ;
+
+
+// keeps the matches whose score is not worse than the threshold
+
+template < class Metric >
+class __threshold_accumulator
+
+{
+public:
+
+  typedef typename Metric :: score_type score_type ;
+
+  typedef bit_vector_match < score_type > match_type ;
+
+  explicit __threshold_accumulator
+             ( score_type i_threshold = score_type ( ) ) :
+    threshold ( i_threshold ),
+    matches ( )
+    { }
+
+  void add ( size_t index, score_type score )
+    { if ( ! Metric :: better ( threshold, score ) )
+        matches.push_back ( match_type ( index, score ) ) ; }
+
+  void merge ( const __threshold_accumulator & b )
+    { matches.insert ( matches.end ( ),
+                       b.matches.begin ( ), b.matches.end ( ) ) ; }
+
+  vector < match_type > result ( )
+    { sort ( matches.begin ( ), matches.end ( ),
+             __bit_search_order < Metric > ( ) ) ;
+      return move ( matches ) ; }
+
+private:
+
+  score_type threshold ;
+  vector < match_type > matches ;
+
+} ;
+
+
+
+// *** BIT VECTOR SEARCH ***
+
+
+// The queries and the collection are split into blocks which fit into
+// the cache: each block of the collection is compared with all queries
+// of a block before the next one is loaded. Tasks cover a range of
+// queries and a range of the collection, and each one has its own
+// accumulators, merged at the end.
+
+constexpr size_t __bit_search_query_block_bytes = size_t ( 1 ) << 14 ;
+
+constexpr size_t __bit_search_collection_block_bytes = size_t ( 1 ) << 18 ;
+
+constexpr size_t __bit_search_tasks_per_thread = 4 ;
+
+
+// pre: accumulators [ q - q_first ] is the accumulator of query q
+
+template < class Metric, class Accumulator, class Word, class Allocator >
+void __bit_search_range
+       ( const basic_bit_vector_collection < Word, Allocator > & queries,
+         const basic_bit_vector_collection < Word, Allocator > & collection,
+         size_t q_first,
+         size_t q_last,
+         size_t c_first,
+         size_t c_last,
+         Accumulator * accumulators )
+
+{
+const size_t n = collection.word_size ( ),
+             vector_bytes = max ( n * sizeof ( Word ), size_t ( 1 ) ),
+             query_block
+               = max ( __bit_search_query_block_bytes / vector_bytes,
+                       size_t ( 1 ) ),
+             collection_block
+               = max ( __bit_search_collection_block_bytes / vector_bytes,
+                       size_t ( 1 ) ) ;
+
+for ( size_t qb = q_first ; qb < q_last ; qb += query_block )
+  {
+  size_t qe = min ( q_last, qb + query_block ) ;
+
+  for ( size_t cb = c_first ; cb < c_last ; cb += collection_block )
+    {
+    size_t ce = min ( c_last, cb + collection_block ) ;
+
+    for ( size_t q = qb ; q < qe ; ++ q )
+      {
+      const Word * p = queries.data ( q ) ;
+      Accumulator & acc = accumulators [ q - q_first ] ;
+
+      for ( size_t c = cb ; c < ce ; ++ c )
+        acc.add ( c, Metric :: score ( p, collection.data ( c ), n ) ) ;
+      }
+    }
+  }
+}
+
+
+// returns: the results of prototype accumulators, one for each query,
+//          after adding all vectors of the collection
+
+template < class Metric, class Accumulator, class Word, class Allocator >
+vector < vector < typename Accumulator :: match_type > >
+  __bit_search
+    ( const basic_bit_vector_collection < Word, Allocator > & queries,
+      const basic_bit_vector_collection < Word, Allocator > & collection,
+      const Accumulator & prototype,
+      thread_pool * pool )
+
+{
+if ( queries.bit_size ( ) != collection.bit_size ( ) )
+  throw invalid_argument ( "bit vector search, size mismatch" ) ;
+
+const size_t queries_size = queries.size ( ),
+             collection_size = collection.size ( ) ;
+
+vector < Accumulator > accumulators ( queries_size, prototype ) ;
+
+size_t tasks =   pool == nullptr
+               ? 0
+               : pool -> size ( ) * __bit_search_tasks_per_thread ;
+
+if ( tasks <= 1  ||  queries_size * collection_size <= 1 )
+  __bit_search_range < Metric >
+    ( queries, collection, 0, queries_size, 0, collection_size,
+      accumulators.data ( ) ) ;
+else
+  {
+  // split the queries first, and the collection only if there are not
+  // enough of them
+
+  size_t query_tasks = min ( queries_size, tasks ),
+         collection_tasks
+           = min ( max ( tasks / query_tasks, size_t ( 1 ) ),
+                   max ( collection_size, size_t ( 1 ) ) ) ;
+
+  vector < vector < Accumulator > > task_accumulators
+                                      ( query_tasks * collection_tasks ) ;
+
+  // task t searches the query range t / collection_tasks in the
+  // collection range t % collection_tasks
+
+  run_tasks
+    ( pool,
+      query_tasks * collection_tasks,
+      [ & ] ( size_t t )
+      { size_t i = t / collection_tasks,
+               j = t % collection_tasks,
+               q_first = queries_size * i / query_tasks,
+               q_last = queries_size * ( i + 1 ) / query_tasks,
+               c_first = collection_size * j / collection_tasks,
+               c_last = collection_size * ( j + 1 ) / collection_tasks ;
+        vector < Accumulator > & acc = task_accumulators [ t ] ;
+        acc.assign ( q_last - q_first, prototype ) ;
+        __bit_search_range < Metric >
+          ( queries, collection, q_first, q_last, c_first, c_last,
+            acc.data ( ) ) ; } ) ;
+
+  for ( size_t i = 0 ; i < query_tasks ; ++ i )
+    {
+    size_t q_first = queries_size * i / query_tasks ;
+
+    for ( size_t j = 0 ; j < collection_tasks ; ++ j )
+      {
+      const vector < Accumulator > & acc
+        = task_accumulators [ i * collection_tasks + j ] ;
+
+      for ( size_t q = 0 ; q < acc.size ( ) ; ++ q )
+        accumulators [ q_first + q ].merge ( acc [ q ] ) ;
+      }
+    }
+  }
+
+vector < vector < typename Accumulator :: match_type > > result ;
+result.reserve ( queries_size ) ;
+
+for ( Accumulator & acc : accumulators )
+  result.push_back ( acc.result ( ) ) ;
+
+return result ;
+}
+
+
+// returns: for each query, the k best matches in the collection, best
+//          first (among equal scores, smaller indices first)
+//
+// The search runs on the threads of pool, or on the calling thread if
+// pool is nullptr.
+
+template < class Metric, class Word, class Allocator >
+inline vector < vector < bit_vector_match < typename Metric :: score_type > > >
+  top_k_search
+    ( const basic_bit_vector_collection < Word, Allocator > & queries,
+      const basic_bit_vector_collection < Word, Allocator > & collection,
+      size_t k,
+      thread_pool * pool = nullptr )
+
+{
+return __bit_search < Metric >
+         ( queries, collection, __top_k_accumulator < Metric > ( k ), pool ) ;
+}
+
+
+//
+
+template < class Metric, class Word, class Allocator >
+inline vector < bit_vector_match < typename Metric :: score_type > >
+  top_k_search
+    ( const basic_bit_vector < Word, Allocator > & query,
+      const basic_bit_vector_collection < Word, Allocator > & collection,
+      size_t k,
+      thread_pool * pool = nullptr )
+
+{
+basic_bit_vector_collection < Word, Allocator > queries ( query.size ( ) ) ;
+queries.push_back ( query ) ;
+
+return move ( top_k_search < Metric > ( queries, collection, k, pool )
+                [ 0 ] ) ;
+}
+
+
+// returns: for each query, the matches in the collection with scores not
+//          worse than threshold, ordered like the results of top_k_search
+
+template < class Metric, class Word, class Allocator >
+inline vector < vector < bit_vector_match < typename Metric :: score_type > > >
+  threshold_search
+    ( const basic_bit_vector_collection < Word, Allocator > & queries,
+      const basic_bit_vector_collection < Word, Allocator > & collection,
+      typename Metric :: score_type threshold,
+      thread_pool * pool = nullptr )
+
+{
+return __bit_search < Metric >
+         ( queries, collection,
+           __threshold_accumulator < Metric > ( threshold ), pool ) ;
+}
+
+
+//
+
+template < class Metric, class Word, class Allocator >
+inline vector < bit_vector_match < typename Metric :: score_type > >
+  threshold_search
+    ( const basic_bit_vector < Word, Allocator > & query,
+      const basic_bit_vector_collection < Word, Allocator > & collection,
+      typename Metric :: score_type threshold,
+      thread_pool * pool = nullptr )
+
+{
+basic_bit_vector_collection < Word, Allocator > queries ( query.size ( ) ) ;
+queries.push_back ( query ) ;
+
+return move ( threshold_search < Metric >
+                ( queries, collection, threshold, pool ) [ 0 ] ) ;
+}
+
+
+
+#endif
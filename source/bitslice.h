@@ -0,0 +1,524 @@
+// Copyright Ivan Stanojevic 2025.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+
+
+
+#ifndef __BITSLICE_H
+
+#define __BITSLICE_H
+
+
+
+#include "cstddef.h"
+#include "cstdint.h"
+#include "cstring.h"
+#include "algorithm.h"
+#include "stdexcept.h"
+
+#include "numbase.h"
+#include "cpufeat.h"
+#include "smallint.h"
+#include "bitvector.h"
+
+
+
+// *** TRANSPOSE_BIT_BLOCK ***
+
+
+// Transposes the square block of n x n bits, n being the bit size of
+// Word, stored in the words a [ 0 ], a [ 1 ], ..., a [ n - 1 ], so that
+// bit j of a [ i ] is exchanged with bit i of a [ j ]. The quarters of the
+// block off the diagonal are swapped, and then recursively the quarters of
+// each quarter, all blocks of one level at once, in log2 ( n ) rounds of
+// n / 2 word operations (H. S. Warren, "Hacker's Delight", 7-3).
+
+template < class Word >
+void __transpose_bit_block ( Word * a ) noexcept
+
+{
+constexpr sint n = numeric_traits < Word > :: bit_size ;
+
+// m holds the low halves of the blocks of size j
+
+Word m = Word ( Word ( ~ Word ( 0 ) ) >> n / 2 ) ;
+
+for ( sint j = n / 2 ; j != 0 ; j >>= 1, m ^= Word ( m << j ) )
+  for ( sint k = 0 ; k < n ; k = ( k + j + 1 ) & ~ j )
+    {
+    Word t = Word ( ( ( a [ k ] >> j ) ^ a [ k + j ] ) & m ) ;
+
+    a [ k + j ] ^= t ;
+    a [ k ] ^= Word ( t << j ) ;
+    }
+}
+
+
+#ifdef __x86_simd__
+
+
+// Transposes 64 x 64 bits 16 rows at a time: the 16 x 8 bytes of the rows
+// are transposed by unpacking, and then movemask gathers the same bit of
+// 16 bytes, that is 16 bits of one row of the result.
+
+__sse2_function__
+inline void __sse2_transpose_bit_block ( uint64_t * a ) noexcept
+
+{
+uint16_t r [ 64 ] [ 4 ] ;
+
+for ( size_t i0 = 0 ; i0 < 64 ; i0 += 16 )
+  {
+  __m128i x [ 16 ], y [ 8 ] ;
+
+  for ( size_t i = 0 ; i < 16 ; ++ i )
+    x [ i ] = _mm_loadl_epi64
+                ( reinterpret_cast < const __m128i * > ( a + i0 + i ) ) ;
+
+  // bytes of pairs of rows
+
+  for ( size_t k = 0 ; k < 8 ; ++ k )
+    y [ k ] = _mm_unpacklo_epi8 ( x [ 2 * k ], x [ 2 * k + 1 ] ) ;
+
+  // bytes 0 - 3 and 4 - 7 of quadruples of rows
+
+  for ( size_t k = 0 ; k < 4 ; ++ k )
+    {
+    x [ 2 * k ] = _mm_unpacklo_epi16 ( y [ 2 * k ], y [ 2 * k + 1 ] ) ;
+    x [ 2 * k + 1 ] = _mm_unpackhi_epi16 ( y [ 2 * k ], y [ 2 * k + 1 ] ) ;
+    }
+
+  // pairs of bytes of octuples of rows, y [ 4 * k + p ] holding the bytes
+  // 2 * p and 2 * p + 1 of the rows 8 * k, ..., 8 * k + 7
+
+  for ( size_t k = 0 ; k < 2 ; ++ k )
+    for ( size_t h = 0 ; h < 2 ; ++ h )
+      {
+      y [ 4 * k + 2 * h ] =
+        _mm_unpacklo_epi32 ( x [ 4 * k + h ], x [ 4 * k + 2 + h ] ) ;
+      y [ 4 * k + 2 * h + 1 ] =
+        _mm_unpackhi_epi32 ( x [ 4 * k + h ], x [ 4 * k + 2 + h ] ) ;
+      }
+
+  // byte b of all 16 rows in x [ b ]
+
+  for ( size_t p = 0 ; p < 4 ; ++ p )
+    {
+    x [ 2 * p ] = _mm_unpacklo_epi64 ( y [ p ], y [ 4 + p ] ) ;
+    x [ 2 * p + 1 ] = _mm_unpackhi_epi64 ( y [ p ], y [ 4 + p ] ) ;
+    }
+
+  // the highest bit of each byte first
+
+  for ( size_t b = 0 ; b < 8 ; ++ b )
+    for ( size_t t = 8 ; t-- > 0 ; )
+      {
+      r [ 8 * b + t ] [ i0 / 16 ] =
+        uint16_t ( _mm_movemask_epi8 ( x [ b ] ) ) ;
+      x [ b ] = _mm_slli_epi64 ( x [ b ], 1 ) ;
+      }
+  }
+
+// x86 is little endian
+
+memcpy ( a, r, sizeof ( r ) ) ;
+}
+
+
+#endif
+
+
+//
+
+template < class Word >
+inline void transpose_bit_block ( Word * a ) noexcept
+
+{
+__transpose_bit_block ( a ) ;
+}
+
+
+//
+
+inline void transpose_bit_block ( uint64_t * a ) noexcept
+
+{
+#ifdef __x86_simd__
+  static const bool has_sse2 = cpu_has_sse2 ( ) ;
+
+  if ( has_sse2 )
+    {
+    __sse2_transpose_bit_block ( a ) ;
+    return ;
+    }
+#endif
+
+__transpose_bit_block ( a ) ;
+}
+
+
+
+// *** TRANSPOSE_BITS ***
+
+
+// Transposes the matrix of rows x columns bits, stored in a with each row
+// in ( columns + w - 1 ) / w words, w being the bit size of Word, into b,
+// with each of its columns rows in ( rows + w - 1 ) / w words, packed like
+// the words of a basic_bit_vector. Bits after the end of each row of b
+// are 0, and those of a are ignored.
+//
+// pre: a and b do not overlap
+
+template < class Word >
+void transpose_bits ( const Word * a, size_t rows, size_t columns, Word * b )
+
+{
+constexpr size_t w = numeric_traits < Word > :: bit_size ;
+
+const size_t a_row_words = ( columns + w - 1 ) / w,
+             b_row_words = ( rows + w - 1 ) / w ;
+
+Word x [ w ] ;
+
+for ( size_t r = 0 ; r < b_row_words ; ++ r )
+  {
+  const size_t n = min ( rows - r * w, w ) ;
+
+  for ( size_t c = 0 ; c < a_row_words ; ++ c )
+    {
+    for ( size_t i = 0 ; i < n ; ++ i )
+      x [ i ] = a [ ( r * w + i ) * a_row_words + c ] ;
+
+    fill ( x + n, x + w, Word ( 0 ) ) ;
+
+    transpose_bit_block ( x ) ;
+
+    const size_t m = min ( columns - c * w, w ) ;
+
+    for ( size_t j = 0 ; j < m ; ++ j )
+      b [ ( c * w + j ) * b_row_words + r ] = x [ j ] ;
+    }
+  }
+}
+
+
+
+// *** TRANSPOSE_BIT_SQUARE ***
+
+
+// Transposes in place the matrix of n x n bits stored in a, with each row
+// in n / w words, w being the bit size of Word, for example 256 x 256
+// bits in 4 x 4 blocks of 64 x 64 bits. The blocks are transposed, and
+// those off the diagonal swapped.
+//
+// pre: n % w == 0
+
+template < class Word >
+void transpose_bit_square ( Word * a, size_t n ) noexcept
+
+{
+constexpr size_t w = numeric_traits < Word > :: bit_size ;
+
+const size_t row_words = n / w ;
+
+Word x [ w ], y [ w ] ;
+
+for ( size_t r = 0 ; r < row_words ; ++ r )
+  for ( size_t c = r ; c < row_words ; ++ c )
+    {
+    Word * p = a + r * w * row_words + c,
+         * q = a + c * w * row_words + r ;
+
+    for ( size_t i = 0 ; i < w ; ++ i )
+      x [ i ] = p [ i * row_words ] ;
+
+    transpose_bit_block ( x ) ;
+
+    if ( c != r )
+      {
+      for ( size_t i = 0 ; i < w ; ++ i )
+        y [ i ] = q [ i * row_words ] ;
+
+      transpose_bit_block ( y ) ;
+
+      for ( size_t i = 0 ; i < w ; ++ i )
+        p [ i * row_words ] = y [ i ] ;
+      }
+
+    for ( size_t i = 0 ; i < w ; ++ i )
+      q [ i * row_words ] = x [ i ] ;
+    }
+}
+
+
+// Transposes in place the matrix of n x n bits stored in x, bit j of row i
+// being x [ i * n + j ].
+//
+// pre: n % x.word_bit_size == 0
+
+template < class Word, class Allocator >
+void transpose_bit_square ( basic_bit_vector < Word, Allocator > & x,
+                            size_t n )
+
+{
+if ( x.size ( ) != n * n )
+  throw invalid_argument ( "transpose_bit_square, size mismatch" ) ;
+
+if ( n % x.word_bit_size != 0 )
+  throw invalid_argument ( "transpose_bit_square, invalid size" ) ;
+
+transpose_bit_square ( x.data ( ), n ) ;
+}
+
+
+
+// *** BITSLICE ***
+
+
+// In the bitsliced form of n values of Bits bits, bit i of plane k is bit
+// k of value i, so that a boolean circuit operating on the planes word by
+// word evaluates w instances at once, w being the bit size of Word. The
+// planes are stored one after another in ( n + w - 1 ) / w words each,
+// packed like the words of a basic_bit_vector, and bits after the end of
+// each plane are 0. Blocks of w values are bitsliced by transpose_bit_block.
+
+
+// Bitslices 64 values of up to 8 bits 16 at a time, movemask gathering
+// the same bit of 16 bytes.
+
+#ifdef __x86_simd__
+
+__sse2_function__
+inline void __sse2_bitslice_bytes ( const uint8_t * v,
+                                    uint64_t * a,
+                                    sint bits ) noexcept
+
+{
+uint16_t r [ 8 ] [ 4 ] ;
+
+for ( size_t i0 = 0 ; i0 < 64 ; i0 += 16 )
+  {
+  __m128i x = _mm_slli_epi64
+                ( _mm_loadu_si128
+                    ( reinterpret_cast < const __m128i * > ( v + i0 ) ),
+                  8 - bits ) ;
+
+  for ( sint k = bits - 1 ; k >= 0 ; -- k )
+    {
+    r [ k ] [ i0 / 16 ] = uint16_t ( _mm_movemask_epi8 ( x ) ) ;
+    x = _mm_slli_epi64 ( x, 1 ) ;
+    }
+  }
+
+// x86 is little endian
+
+memcpy ( a, r, size_t ( bits ) * sizeof ( r [ 0 ] ) ) ;
+}
+
+#endif
+
+
+// Bitslices the n <= w values x [ 0 ], ..., x [ n - 1 ] into the planes
+// a [ 0 ], ..., a [ Bits - 1 ].
+
+template < class T, sint Bits, class Word >
+void __bitslice_block ( const unsigned_small_int < T, Bits > * x,
+                        size_t n,
+                        Word * a ) noexcept
+
+{
+constexpr size_t w = numeric_traits < Word > :: bit_size ;
+
+Word y [ w ] ;
+
+for ( size_t i = 0 ; i < n ; ++ i )
+  y [ i ] = Word ( x [ i ].unsigned_data ( ) ) ;
+
+fill ( y + n, y + w, Word ( 0 ) ) ;
+
+transpose_bit_block ( y ) ;
+
+copy_n ( y, Bits, a ) ;
+}
+
+
+//
+
+template < class T, sint Bits >
+void __bitslice_block ( const unsigned_small_int < T, Bits > * x,
+                        size_t n,
+                        uint64_t * a ) noexcept
+
+{
+#ifdef __x86_simd__
+  static const bool has_sse2 = cpu_has_sse2 ( ) ;
+
+  if ( Bits <= 8  &&  has_sse2 )
+    {
+    uint8_t v [ 64 ] ;
+
+    for ( size_t i = 0 ; i < n ; ++ i )
+      v [ i ] = uint8_t ( x [ i ].unsigned_data ( ) ) ;
+
+    fill ( v + n, v + 64, uint8_t ( 0 ) ) ;
+
+    __sse2_bitslice_bytes ( v, a, Bits ) ;
+    return ;
+    }
+#endif
+
+uint64_t y [ 64 ] ;
+
+for ( size_t i = 0 ; i < n ; ++ i )
+  y [ i ] = uint64_t ( x [ i ].unsigned_data ( ) ) ;
+
+fill ( y + n, y + 64, uint64_t ( 0 ) ) ;
+
+transpose_bit_block ( y ) ;
+
+copy_n ( y, Bits, a ) ;
+}
+
+
+// Bitslices x [ 0 ], ..., x [ n - 1 ] into the Bits planes in planes.
+
+template < class T, sint Bits, class Word >
+void bitslice ( const unsigned_small_int < T, Bits > * x,
+                size_t n,
+                Word * planes ) noexcept
+
+{
+constexpr size_t w = numeric_traits < Word > :: bit_size ;
+
+static_assert ( size_t ( Bits ) <= w, "Values wider than words." ) ;
+
+const size_t plane_words = ( n + w - 1 ) / w ;
+
+Word a [ Bits ] ;
+
+for ( size_t c = 0 ; c < plane_words ; ++ c )
+  {
+  __bitslice_block ( x + c * w, min ( n - c * w, w ), a ) ;
+
+  for ( sint k = 0 ; k < Bits ; ++ k )
+    planes [ k * plane_words + c ] = a [ k ] ;
+  }
+}
+
+
+// Bitslices x [ 0 ], ..., x [ n - 1 ] into the bit vectors planes [ 0 ],
+// ..., planes [ Bits - 1 ], each resized to n.
+
+template < class T, sint Bits, class Word, class Allocator >
+void bitslice ( const unsigned_small_int < T, Bits > * x,
+                size_t n,
+                basic_bit_vector < Word, Allocator > * planes )
+
+{
+constexpr size_t w = numeric_traits < Word > :: bit_size ;
+
+static_assert ( size_t ( Bits ) <= w, "Values wider than words." ) ;
+
+Word a [ Bits ] ;
+
+for ( sint k = 0 ; k < Bits ; ++ k )
+  planes [ k ].resize ( n ) ;
+
+for ( size_t c = 0 ; c * w < n ; ++ c )
+  {
+  __bitslice_block ( x + c * w, min ( n - c * w, w ), a ) ;
+
+  for ( sint k = 0 ; k < Bits ; ++ k )
+    planes [ k ].data ( ) [ c ] = a [ k ] ;
+  }
+}
+
+
+
+// *** UNBITSLICE ***
+
+
+// Assigns to x [ 0 ], ..., x [ n - 1 ] the values bitsliced into planes
+// from a block of w planes a, w being the bit size of Word.
+
+template < class T, sint Bits, class Word >
+void __unbitslice_block ( Word * a,
+                          size_t n,
+                          unsigned_small_int < T, Bits > * x ) noexcept
+
+{
+typedef typename unsigned_small_int < T, Bits > :: unsigned_value_type
+          value_type ;
+
+constexpr size_t w = numeric_traits < Word > :: bit_size ;
+
+fill ( a + Bits, a + w, Word ( 0 ) ) ;
+
+transpose_bit_block ( a ) ;
+
+for ( size_t i = 0 ; i < n ; ++ i )
+  x [ i ] = unsigned_small_int < T, Bits > ( value_type ( a [ i ] ) ) ;
+}
+
+
+// Inverse of bitslice: assigns to x [ 0 ], ..., x [ n - 1 ] the values
+// bitsliced into planes.
+
+template < class T, sint Bits, class Word >
+void unbitslice ( const Word * planes,
+                  size_t n,
+                  unsigned_small_int < T, Bits > * x ) noexcept
+
+{
+constexpr size_t w = numeric_traits < Word > :: bit_size ;
+
+static_assert ( size_t ( Bits ) <= w, "Values wider than words." ) ;
+
+const size_t plane_words = ( n + w - 1 ) / w ;
+
+Word a [ w ] ;
+
+for ( size_t c = 0 ; c < plane_words ; ++ c )
+  {
+  for ( sint k = 0 ; k < Bits ; ++ k )
+    a [ k ] = planes [ k * plane_words + c ] ;
+
+  __unbitslice_block ( a, min ( n - c * w, w ), x + c * w ) ;
+  }
+}
+
+
+// Inverse of bitslice: assigns to x [ 0 ], ..., x [ n - 1 ] the values
+// bitsliced into the bit vectors planes [ 0 ], ..., planes [ Bits - 1 ] of
+// size n.
+
+template < class T, sint Bits, class Word, class Allocator >
+void unbitslice ( const basic_bit_vector < Word, Allocator > * planes,
+                  unsigned_small_int < T, Bits > * x )
+
+{
+constexpr size_t w = numeric_traits < Word > :: bit_size ;
+
+static_assert ( size_t ( Bits ) <= w, "Values wider than words." ) ;
+
+const size_t n = planes [ 0 ].size ( ) ;
+
+for ( sint k = 1 ; k < Bits ; ++ k )
+  if ( planes [ k ].size ( ) != n )
+    throw invalid_argument ( "unbitslice, size mismatch" ) ;
+
+Word a [ w ] ;
+
+for ( size_t c = 0 ; c * w < n ; ++ c )
+  {
+  for ( sint k = 0 ; k < Bits ; ++ k )
+    a [ k ] = planes [ k ].data ( ) [ c ] ;
+
+  __unbitslice_block ( a, min ( n - c * w, w ), x + c * w ) ;
+  }
+}
+
+
+
+#endif
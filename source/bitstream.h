@@ -0,0 +1,528 @@
+// Copyright Ivan Stanojevic 2025.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+
+
+
+#ifndef __BITSTREAM_H
+
+#define __BITSTREAM_H
+
+
+
+#include "memory.h"
+#include "cstddef.h"
+#include "cstdint.h"
+#include "algorithm.h"
+#include "cassert.h"
+
+#include "numbase.h"
+#include "bitref.h"
+#include "bitvector.h"
+
+
+
+// *** WORD ACCESS ***
+
+
+// Bits are written and read in increasing order of position. A code of
+// several bits is stored with its least significant bit first.
+
+
+// returns: 2 ^ n - 1
+//
+// pre: n <= 64
+
+inline uint64_t __bit_stream_mask ( size_t n ) noexcept
+
+{
+return n == 64 ? uint64_t ( -1 ) : ( uint64_t ( 1 ) << n ) - 1 ;
+}
+
+
+// returns: the n bits of p from position, reading only the words holding
+//          them
+//
+// pre: 0 < n <= 64
+
+template < class Word >
+inline uint64_t __bit_stream_load ( const Word * p,
+                                    size_t position,
+                                    size_t n ) noexcept
+
+{
+constexpr size_t word_bit_size = numeric_traits < Word > :: bit_size ;
+
+p += position / word_bit_size ;
+
+size_t offset = position % word_bit_size ;
+
+uint64_t result = uint64_t ( * p ) >> offset ;
+
+for ( size_t k = word_bit_size - offset ; k < n ; k += word_bit_size )
+  {
+  ++ p ;
+  result |= uint64_t ( * p ) << k ;
+  }
+
+return result & __bit_stream_mask ( n ) ;
+}
+
+
+// Assigns x to the n bits of p from position, keeping the other bits.
+//
+// pre: 0 < n <= 64, x < 2 ^ n
+
+template < class Word >
+inline void __bit_stream_store ( Word * p,
+                                 size_t position,
+                                 uint64_t x,
+                                 size_t n ) noexcept
+
+{
+constexpr size_t word_bit_size = numeric_traits < Word > :: bit_size ;
+
+p += position / word_bit_size ;
+
+size_t offset = position % word_bit_size,
+       k = min ( n, word_bit_size - offset ) ;
+
+Word m = Word ( __bit_stream_mask ( k ) << offset ) ;
+
+* p = Word ( ( * p & Word ( ~ m ) ) | ( Word ( x << offset ) & m ) ) ;
+
+for ( ; k < n ; k += word_bit_size )
+  {
+  ++ p ;
+  m = Word ( __bit_stream_mask ( min ( n - k, word_bit_size ) ) ) ;
+  * p = Word ( ( * p & Word ( ~ m ) ) | ( Word ( x >> k ) & m ) ) ;
+  }
+}
+
+
+
+// *** BASIC_BIT_WRITER ***
+
+
+// Writes codes to a bit vector, appending to it, or to a buffer of words,
+// overwriting its bits. The bits are collected in a 64 bit buffer, and
+// stored 64 at a time, so they reach the bit vector or the words only when
+// the buffer is full or when flush is called. A bit vector must not be
+// modified by other means while it is written.
+//
+// unary: x as x 0 bits and a 1 bit
+// gamma: x > 0 of n + 1 significant bits as n in unary and the n low bits
+// delta: x > 0 of n + 1 significant bits as n + 1 in gamma and the n low
+//        bits
+// rice: x with the parameter k as x >> k in unary and the k low bits
+
+template < class Word, class Allocator = allocator < Word > >
+class basic_bit_writer
+
+{
+private:
+
+  basic_bit_vector < Word, Allocator > * vector_ ;
+  Word * data_ ;
+  size_t capacity_ ;
+
+  // position of the first bit of buffer_, and the number of its bits
+  // written, the others being 0
+
+  size_t position_ ;
+  uint64_t buffer_ ;
+  size_t buffer_size_ ;
+
+  void store ( uint64_t x, size_t n ) ;
+
+public:
+
+  // writer appending to x
+
+  explicit basic_bit_writer ( basic_bit_vector < Word, Allocator > & x ) :
+    vector_ ( & x ),
+    data_ ( x.data ( ) ),
+    capacity_ ( size_t ( -1 ) ),
+    position_ ( x.size ( ) ),
+    buffer_ ( 0 ),
+    buffer_size_ ( 0 )
+    { }
+
+  // writer to the bits [ position, n ) of the words from p
+
+  basic_bit_writer ( Word * p, size_t n, size_t position = 0 ) :
+    vector_ ( nullptr ),
+    data_ ( p ),
+    capacity_ ( n ),
+    position_ ( position ),
+    buffer_ ( 0 ),
+    buffer_size_ ( 0 )
+    { assert ( position <= n ) ; }
+
+  basic_bit_writer ( const basic_bit_writer & ) = delete ;
+
+  basic_bit_writer & operator = ( const basic_bit_writer & ) = delete ;
+
+  // returns: position after the last bit written
+
+  size_t position ( ) const noexcept
+    { return position_ + buffer_size_ ; }
+
+  // writes the n low bits of x
+  //
+  // pre: n <= 64, x < 2 ^ n
+
+  void write ( uint64_t x, size_t n )
+    { assert ( n == 64  ||  x >> n == 0 ) ;
+      buffer_ |= x << buffer_size_ ;
+      buffer_size_ += n ;
+      if ( buffer_size_ >= 64 )
+        { store ( buffer_, 64 ) ;
+          buffer_size_ -= 64 ;
+          buffer_ = buffer_size_ == 0 ? 0 : x >> ( n - buffer_size_ ) ; } }
+
+  void write_bit ( bool b )
+    { write ( uint64_t ( b ), 1 ) ; }
+
+  void write_unary ( uint64_t x )
+    { for ( ; x >= 64 ; x -= 64 )
+        write ( 0, 64 ) ;
+      write ( uint64_t ( 1 ) << x, x + 1 ) ; }
+
+  // pre: x > 0
+
+  void write_gamma ( uint64_t x )
+    { assert ( x > 0 ) ;
+      size_t n = raw_find_last_bit_1 ( x ) ;
+      write_unary ( n ) ;
+      write ( x ^ uint64_t ( 1 ) << n, n ) ; }
+
+  // pre: x > 0
+
+  void write_delta ( uint64_t x )
+    { assert ( x > 0 ) ;
+      size_t n = raw_find_last_bit_1 ( x ) ;
+      write_gamma ( n + 1 ) ;
+      write ( x ^ uint64_t ( 1 ) << n, n ) ; }
+
+  // pre: k < 64
+
+  void write_rice ( uint64_t x, size_t k )
+    { write_unary ( x >> k ) ;
+      write ( x & __bit_stream_mask ( k ), k ) ; }
+
+  // Stores the bits of the buffer. A bit vector then has all bits written,
+  // and the writer can be used further.
+
+  void flush ( ) ;
+
+} ;
+
+
+// stores the n bits of x at position_
+//
+// pre: 0 < n <= 64
+
+template < class Word, class Allocator >
+void basic_bit_writer < Word, Allocator > :: store ( uint64_t x, size_t n )
+
+{
+if ( vector_ != nullptr )
+  {
+  vector_ -> resize ( position_ + n ) ;
+  data_ = vector_ -> data ( ) ;
+  }
+
+assert ( position_ + n <= capacity_ ) ;
+
+__bit_stream_store ( data_, position_, x, n ) ;
+
+position_ += n ;
+}
+
+
+//
+
+template < class Word, class Allocator >
+void basic_bit_writer < Word, Allocator > :: flush ( )
+
+{
+if ( buffer_size_ == 0 )
+  return ;
+
+store ( buffer_, buffer_size_ ) ;
+
+buffer_ = 0 ;
+buffer_size_ = 0 ;
+}
+
+
+
+// *** BASIC_BIT_READER ***
+
+
+// Reads the codes of basic_bit_writer from a bit vector or a buffer of
+// words, loading 64 bits at a time into a buffer. The batch reads decode n
+// codes in a loop with the state of the reader in local variables. Reading
+// past the end is not allowed.
+
+template < class Word >
+class basic_bit_reader
+
+{
+private:
+
+  const Word * data_ ;
+  size_t size_ ;
+
+  // position of the first bit not loaded, and buffer_size_ loaded bits
+  // before it, the others being 0
+
+  size_t position_ ;
+  uint64_t buffer_ ;
+  size_t buffer_size_ ;
+
+  // loads bits into the buffer, until it holds 64 bits or the rest of the
+  // bits
+
+  void refill ( ) noexcept
+    { size_t n = min ( 64 - buffer_size_, size_ - position_ ) ;
+      if ( n > 0 )
+        { buffer_ |=    __bit_stream_load ( data_, position_, n )
+                     << buffer_size_ ;
+          position_ += n ;
+          buffer_size_ += n ; } }
+
+  // removes the n low bits of the buffer
+  //
+  // pre: n <= buffer_size_
+
+  void skip_buffer ( size_t n ) noexcept
+    { buffer_ = n == 64 ? 0 : buffer_ >> n ;
+      buffer_size_ -= n ; }
+
+  template < class Integer, class F >
+  void read_n ( Integer * x, size_t n, F f ) ;
+
+public:
+
+  // reader of the bits [ position, n ) of the words from p
+
+  basic_bit_reader ( const Word * p, size_t n, size_t position = 0 ) noexcept :
+    data_ ( p ),
+    size_ ( n ),
+    position_ ( position ),
+    buffer_ ( 0 ),
+    buffer_size_ ( 0 )
+    { assert ( position <= n ) ; }
+
+  template < class Allocator >
+  explicit basic_bit_reader ( const basic_bit_vector < Word, Allocator > & x,
+                              size_t position = 0 ) noexcept :
+    basic_bit_reader ( x.data ( ), x.size ( ), position )
+    { }
+
+  size_t size ( ) const noexcept
+    { return size_ ; }
+
+  // returns: position of the next bit read
+
+  size_t position ( ) const noexcept
+    { return position_ - buffer_size_ ; }
+
+  bool at_end ( ) const noexcept
+    { return position ( ) == size_ ; }
+
+  // pre: position <= size ( )
+
+  void seek ( size_t position ) noexcept
+    { assert ( position <= size_ ) ;
+      position_ = position ;
+      buffer_ = 0 ;
+      buffer_size_ = 0 ; }
+
+  // returns: the next n bits, the first as the least significant one
+  //
+  // pre: n <= 64
+
+  uint64_t read ( size_t n ) ;
+
+  bool read_bit ( )
+    { return read ( 1 ) != 0 ; }
+
+  uint64_t read_unary ( ) ;
+
+  uint64_t read_gamma ( ) ;
+
+  uint64_t read_delta ( )
+    { size_t n = read_gamma ( ) - 1 ;
+      return read ( n ) | uint64_t ( 1 ) << n ; }
+
+  // pre: k < 64
+
+  uint64_t read_rice ( size_t k ) ;
+
+  // batch reads of n codes into x
+
+  template < class Integer >
+  void read ( Integer * x, size_t n, size_t width )
+    { read_n ( x, n,
+               [ width ] ( basic_bit_reader & r )
+               { return r.read ( width ) ; } ) ; }
+
+  template < class Integer >
+  void read_unary ( Integer * x, size_t n )
+    { read_n ( x, n,
+               [ ] ( basic_bit_reader & r )
+               { return r.read_unary ( ) ; } ) ; }
+
+  template < class Integer >
+  void read_gamma ( Integer * x, size_t n )
+    { read_n ( x, n,
+               [ ] ( basic_bit_reader & r )
+               { return r.read_gamma ( ) ; } ) ; }
+
+  template < class Integer >
+  void read_delta ( Integer * x, size_t n )
+    { read_n ( x, n,
+               [ ] ( basic_bit_reader & r )
+               { return r.read_delta ( ) ; } ) ; }
+
+  template < class Integer >
+  void read_rice ( Integer * x, size_t n, size_t k )
+    { read_n ( x, n,
+               [ k ] ( basic_bit_reader & r )
+               { return r.read_rice ( k ) ; } ) ; }
+
+} ;
+
+
+//
+
+template < class Word >
+uint64_t basic_bit_reader < Word > :: read ( size_t n )
+
+{
+if ( n > buffer_size_ )
+  {
+  refill ( ) ;
+  assert ( n <= buffer_size_ ) ;
+  n = min ( n, buffer_size_ ) ;
+  }
+
+uint64_t x = buffer_ & __bit_stream_mask ( n ) ;
+skip_buffer ( n ) ;
+
+return x ;
+}
+
+
+//
+
+template < class Word >
+uint64_t basic_bit_reader < Word > :: read_unary ( )
+
+{
+uint64_t x = 0 ;
+
+while ( buffer_ == 0 )
+  {
+  x += buffer_size_ ;
+  buffer_size_ = 0 ;
+  refill ( ) ;
+
+  assert ( buffer_size_ > 0 ) ;
+
+  if ( buffer_size_ == 0 )
+    return x ;
+  }
+
+size_t n = raw_find_bit_1 ( buffer_ ) ;
+
+skip_buffer ( n + 1 ) ;
+
+return x + n ;
+}
+
+
+//
+
+template < class Word >
+uint64_t basic_bit_reader < Word > :: read_gamma ( )
+
+{
+// a code in the buffer is decoded directly
+
+if ( buffer_ != 0 )
+  {
+  size_t n = raw_find_bit_1 ( buffer_ ) ;
+
+  if ( 2 * n + 1 <= buffer_size_ )
+    {
+    uint64_t x = buffer_ >> ( n + 1 ) & __bit_stream_mask ( n ) ;
+    skip_buffer ( 2 * n + 1 ) ;
+    return x | uint64_t ( 1 ) << n ;
+    }
+  }
+
+size_t n = read_unary ( ) ;
+
+return read ( n ) | uint64_t ( 1 ) << n ;
+}
+
+
+//
+
+template < class Word >
+uint64_t basic_bit_reader < Word > :: read_rice ( size_t k )
+
+{
+// a code in the buffer is decoded directly
+
+if ( buffer_ != 0 )
+  {
+  size_t n = raw_find_bit_1 ( buffer_ ) ;
+
+  if ( n + 1 + k <= buffer_size_ )
+    {
+    uint64_t x = buffer_ >> ( n + 1 ) & __bit_stream_mask ( k ) ;
+    skip_buffer ( n + 1 + k ) ;
+    return uint64_t ( n ) << k | x ;
+    }
+  }
+
+uint64_t q = read_unary ( ) ;
+
+return q << k | read ( k ) ;
+}
+
+
+// The reader is copied to a local variable, so that its state can stay in
+// registers while x is written.
+
+template < class Word >
+template < class Integer, class F >
+void basic_bit_reader < Word > :: read_n ( Integer * x, size_t n, F f )
+
+{
+basic_bit_reader r ( * this ) ;
+
+for ( size_t i = 0 ; i < n ; ++ i )
+  x [ i ] = Integer ( f ( r ) ) ;
+
+* this = r ;
+}
+
+
+
+// *** BIT_WRITER, BIT_READER ***
+
+
+typedef basic_bit_writer < uint > bit_writer ;
+
+typedef basic_bit_reader < uint > bit_reader ;
+
+
+
+#endif
@@ -51,6 +51,13 @@ size_t bit_or_weight
          ( const basic_bit_vector < Word, Allocator > & a,
            const basic_bit_vector < Word, Allocator > & b ) ;
 
+template < class Word, class Allocator >
+void bit_and_or_weight
+       ( const basic_bit_vector < Word, Allocator > & a,
+         const basic_bit_vector < Word, Allocator > & b,
+         size_t & and_weight,
+         size_t & or_weight ) ;
+
 template < class Word, class Allocator >
 bool bit_and_nonzero
        ( const basic_bit_vector < Word, Allocator > & a,
@@ -149,6 +156,9 @@ private:
       if ( back_size_mod > 0 )
         data_.back ( ) |= Word ( -1 ) << back_size_mod ; }
 
+  void rotate_words_left ( size_t k ) ;
+  void rotate_words_right ( size_t k ) ;
+
   template < class InputIterator >
   void copy_from_range ( InputIterator first,
                          InputIterator last,
@@ -522,6 +532,12 @@ public:
                   ( const basic_bit_vector & a,
                     const basic_bit_vector & b ) ;
 
+  friend void bit_and_or_weight < >
+                ( const basic_bit_vector & a,
+                  const basic_bit_vector & b,
+                  size_t & and_weight,
+                  size_t & or_weight ) ;
+
   friend bool bit_and_nonzero < >
                 ( const basic_bit_vector & a,
                   const basic_bit_vector & b ) ;
@@ -545,6 +561,32 @@ public:
                                        const basic_bit_vector & b )
     { return basic_bit_vector ( a ) ^= b ; }
 
+  // moves bit n to n + k, the first k bits becoming 0
+
+  basic_bit_vector & operator <<= ( size_t k ) ;
+
+  // moves bit n to n - k, the last k bits becoming 0
+
+  basic_bit_vector & operator >>= ( size_t k ) ;
+
+  friend basic_bit_vector operator << ( const basic_bit_vector & a, size_t k )
+    { return basic_bit_vector ( a ) <<= k ; }
+
+  friend basic_bit_vector operator >> ( const basic_bit_vector & a, size_t k )
+    { return basic_bit_vector ( a ) >>= k ; }
+
+  // moves bit n to ( n + k ) mod size ( )
+
+  basic_bit_vector & rotate_left ( size_t k ) ;
+
+  // moves bit n to ( n - k ) mod size ( )
+
+  basic_bit_vector & rotate_right ( size_t k ) ;
+
+  // moves bit n to size ( ) - 1 - n
+
+  basic_bit_vector & reverse ( ) ;
+
   friend basic_bit_vector operator + ( const basic_bit_vector & a,
                                        const basic_bit_vector & b )
     { return a ^ b ; }
@@ -681,12 +723,7 @@ template < class Word, class Allocator >
 size_t hamming_weight ( const basic_bit_vector < Word, Allocator > & x )
 
 {
-size_t result = 0 ;
-
-for ( Word w : x.data_ )
-  result += :: hamming_weight ( w ) ;
-
-return result ;
+return words_hamming_weight ( x.data_.data ( ), x.data_.size ( ) ) ;
 }
 
 
@@ -711,17 +748,12 @@ else
   bp = & a ;
   }
 
-size_t result = 0 ;
+const Word * p = ap -> data_.data ( ) ;
+const Word * q = bp -> data_.data ( ) ;
+size_t n = ap -> data_.size ( ) ;
 
-for_pairs
-  ( ap -> data_.begin ( ), ap -> data_.end ( ),
-    bp -> data_.begin ( ),
-    [ & ] ( Word x, Word y ) { result += hamming_weight ( x ^ y ) ; } ) ;
-
-for_each ( bp -> data_.begin ( ) + ap -> data_.size ( ), bp -> data_.end ( ),
-           [ & ] ( Word x ) { result += hamming_weight ( x ) ; } ) ;
-
-return result ;
+return   words_hamming_distance ( p, q, n )
+       + words_hamming_weight ( q + n, bp -> data_.size ( ) - n ) ;
 }
 
 
@@ -746,14 +778,8 @@ else
   bp = & a ;
   }
 
-size_t result = 0 ;
-
-for_pairs
-  ( ap -> data_.begin ( ), ap -> data_.end ( ),
-    bp -> data_.begin ( ),
-    [ & ] ( Word x, Word y ) { result += hamming_weight ( x & y ) ; } ) ;
-
-return result ;
+return words_and_weight ( ap -> data_.data ( ), bp -> data_.data ( ),
+                         ap -> data_.size ( ) ) ;
 }
 
 
@@ -778,17 +804,48 @@ else
   bp = & a ;
   }
 
-size_t result = 0 ;
+const Word * p = ap -> data_.data ( ) ;
+const Word * q = bp -> data_.data ( ) ;
+size_t n = ap -> data_.size ( ) ;
+
+return   words_or_weight ( p, q, n )
+       + words_hamming_weight ( q + n, bp -> data_.size ( ) - n ) ;
+}
+
 
-for_pairs
-  ( ap -> data_.begin ( ), ap -> data_.end ( ),
-    bp -> data_.begin ( ),
-    [ & ] ( Word x, Word y ) { result += hamming_weight ( x | y ) ; } ) ;
+// post: and_weight = bit_and_weight ( a, b ),
+//       or_weight = bit_or_weight ( a, b ),
+//       computed in a single pass (for Tanimoto similarity
+//       and_weight / or_weight)
 
-for_each ( bp -> data_.begin ( ) + ap -> data_.size ( ), bp -> data_.end ( ),
-           [ & ] ( Word x ) { result += hamming_weight ( x ) ; } ) ;
+template < class Word, class Allocator >
+void bit_and_or_weight ( const basic_bit_vector < Word, Allocator > & a,
+                         const basic_bit_vector < Word, Allocator > & b,
+                         size_t & and_weight,
+                         size_t & or_weight )
+
+{
+const basic_bit_vector < Word, Allocator > * ap ;
+const basic_bit_vector < Word, Allocator > * bp ;
 
-return result ;
+if ( a.data_.size ( ) < b.data_.size ( ) )
+  {
+  ap = & a ;
+  bp = & b ;
+  }
+else
+  {
+  ap = & b ;
+  bp = & a ;
+  }
+
+const Word * p = ap -> data_.data ( ) ;
+const Word * q = bp -> data_.data ( ) ;
+size_t n = ap -> data_.size ( ) ;
+
+words_and_or_weight ( p, q, n, and_weight, or_weight ) ;
+
+or_weight += words_hamming_weight ( q + n, bp -> data_.size ( ) - n ) ;
 }
 
 
@@ -813,9 +870,8 @@ else
   bp = & a ;
   }
 
-return ! equal ( ap -> data_.begin ( ), ap -> data_.end ( ),
-                 bp -> data_.begin ( ),
-                 [ ] ( Word x, Word y ) { return ( x & y ) == Word ( 0 ) ; } ) ;
+return words_and_nonzero ( ap -> data_.data ( ), bp -> data_.data ( ),
+                          ap -> data_.size ( ) ) ;
 }
 
 
@@ -915,6 +971,217 @@ return * this ;
 }
 
 
+// Each word is assembled from the two source words holding its bits,
+// going from the last word down, so that the words are moved in place.
+
+template < class Word, class Allocator >
+basic_bit_vector < Word, Allocator > &
+  basic_bit_vector < Word, Allocator > :: operator <<= ( size_t k )
+
+{
+if ( k >= size_ )
+  return reset ( ) ;
+
+const size_t n = data_.size ( ),
+             q = k >> log2_word_bit_size,
+             r = k & word_bit_size_1 ;
+
+Word * p = data_.data ( ) ;
+
+if ( r == 0 )
+  for ( size_t i = n - 1 ; i >= q + 1 ; -- i )
+    p [ i ] = p [ i - q ] ;
+else
+  for ( size_t i = n - 1 ; i >= q + 1 ; -- i )
+    p [ i ] = Word (   p [ i - q ] << r
+                     | unsigned_shift_right ( p [ i - q - 1 ],
+                                              word_bit_size - r ) ) ;
+
+p [ q ] = Word ( p [ 0 ] << r ) ;
+
+fill ( p, p + q, Word ( 0 ) ) ;
+
+reset_trail ( ) ;
+return * this ;
+}
+
+
+// Each word is assembled from the two source words holding its bits,
+// going from the first word up.
+
+template < class Word, class Allocator >
+basic_bit_vector < Word, Allocator > &
+  basic_bit_vector < Word, Allocator > :: operator >>= ( size_t k )
+
+{
+if ( k >= size_ )
+  return reset ( ) ;
+
+const size_t n = data_.size ( ),
+             q = k >> log2_word_bit_size,
+             r = k & word_bit_size_1 ;
+
+Word * p = data_.data ( ) ;
+
+if ( r == 0 )
+  copy ( p + q, p + n, p ) ;
+else
+  {
+  for ( size_t i = 0 ; i + q + 1 < n ; ++ i )
+    p [ i ] = Word (   unsigned_shift_right ( p [ i + q ], r )
+                     | p [ i + q + 1 ] << ( word_bit_size - r ) ) ;
+
+  p [ n - q - 1 ] = unsigned_shift_right ( p [ n - 1 ], r ) ;
+  }
+
+fill ( p + n - q, p + n, Word ( 0 ) ) ;
+
+return * this ;
+}
+
+
+// Rotates by 0 < k < size_ by saving the last k bits, shifting, and
+// putting the saved bits first.
+
+template < class Word, class Allocator >
+void basic_bit_vector < Word, Allocator > :: rotate_words_left ( size_t k )
+
+{
+const size_t m = ( k + word_bit_size_1 ) >> log2_word_bit_size ;
+
+vector < Word > t ( m ) ;
+
+for ( size_t i = 0, j = 0 ; i < m ; ++ i, j += word_bit_size )
+  t [ i ] = ( cbegin ( ) + ( size_ - k + j ) ).word
+              ( min ( k - j, word_bit_size ) ) ;
+
+* this <<= k ;
+
+Word * p = data_.data ( ) ;
+
+for ( size_t i = 0 ; i < m ; ++ i )
+  p [ i ] |= t [ i ] ;
+}
+
+
+// Rotates by 0 < k < size_ by saving the first k bits, shifting, and
+// putting the saved bits last.
+
+template < class Word, class Allocator >
+void basic_bit_vector < Word, Allocator > :: rotate_words_right ( size_t k )
+
+{
+const size_t m = ( k + word_bit_size_1 ) >> log2_word_bit_size ;
+
+vector < Word > t ( data_.begin ( ), data_.begin ( ) + m ) ;
+
+if ( ( k & word_bit_size_1 ) != 0 )
+  t.back ( ) &= ( Word ( 1 ) << ( k & word_bit_size_1 ) ) - 1 ;
+
+* this >>= k ;
+
+Word * p = data_.data ( ) ;
+
+size_t position = size_ - k ;
+
+for ( size_t i = 0 ; i < m ; ++ i, position += word_bit_size )
+  {
+  const size_t j = position >> log2_word_bit_size,
+               r = position & word_bit_size_1 ;
+
+  p [ j ] |= Word ( t [ i ] << r ) ;
+
+  if ( r != 0 )
+    {
+    Word w = unsigned_shift_right ( t [ i ], word_bit_size - r ) ;
+
+    if ( w != 0 )
+      p [ j + 1 ] |= w ;
+    }
+  }
+}
+
+
+// The smaller part of the bits is saved.
+
+template < class Word, class Allocator >
+basic_bit_vector < Word, Allocator > &
+  basic_bit_vector < Word, Allocator > :: rotate_left ( size_t k )
+
+{
+if ( size_ == 0 )
+  return * this ;
+
+k %= size_ ;
+
+if ( k == 0 )
+  return * this ;
+
+if ( k <= size_ - k )
+  rotate_words_left ( k ) ;
+else
+  rotate_words_right ( size_ - k ) ;
+
+return * this ;
+}
+
+
+//
+
+template < class Word, class Allocator >
+basic_bit_vector < Word, Allocator > &
+  basic_bit_vector < Word, Allocator > :: rotate_right ( size_t k )
+
+{
+if ( size_ == 0 )
+  return * this ;
+
+return rotate_left ( size_ - k % size_ ) ;
+}
+
+
+// Reversing the order of the words and the bits of each word moves bit n
+// to data_.size ( ) * word_bit_size - 1 - n, and a shift down by the
+// number r of bits after the end moves it to size_ - 1 - n.
+
+template < class Word, class Allocator >
+basic_bit_vector < Word, Allocator > &
+  basic_bit_vector < Word, Allocator > :: reverse ( )
+
+{
+Word * first = data_.data ( ) ;
+Word * last = first + data_.size ( ) ;
+
+for ( ; last - first > 1 ; ++ first )
+  {
+  -- last ;
+
+  Word w = :: reverse ( * first ) ;
+  * first = :: reverse ( * last ) ;
+  * last = w ;
+  }
+
+if ( first != last )
+  * first = :: reverse ( * first ) ;
+
+const size_t r = ( data_.size ( ) << log2_word_bit_size ) - size_ ;
+
+if ( r != 0 )
+  {
+  Word * p = data_.data ( ) ;
+  const size_t n = data_.size ( ) ;
+
+  for ( size_t i = 0 ; i + 1 < n ; ++ i )
+    p [ i ] = Word (   unsigned_shift_right ( p [ i ], r )
+                     | p [ i + 1 ] << ( word_bit_size - r ) ) ;
+
+  p [ n - 1 ] = unsigned_shift_right ( p [ n - 1 ], r ) ;
+  }
+
+return * this ;
+}
+
+
 //
 
 template < class Word, class Allocator >
@@ -0,0 +1,922 @@
+// Copyright Ivan Stanojevic 2025.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+
+
+
+#ifndef __BLOOM_H
+
+#define __BLOOM_H
+
+
+
+#include "cstddef.h"
+#include "cstdint.h"
+#include "vector.h"
+#include "functional.h"
+#include "algorithm.h"
+#include "utility.h"
+#include "cmath.h"
+#include "stdexcept.h"
+#include "ios.h"
+#include "istream.h"
+#include "ostream.h"
+
+#include "numbase.h"
+#include "cpufeat.h"
+#include "bitcount.h"
+#include "bitvector.h"
+
+
+
+// *** HASH MIXING ***
+
+
+// Finalizer of MurmurHash3, a bijection whose result bits all depend on
+// all bits of x. It makes weak hashes, such as the identity hash of the
+// integers, usable for indexing a filter.
+
+constexpr uint64_t __bloom_mix ( uint64_t x ) noexcept
+
+{
+x ^= x >> 33 ;
+x *= 0xff51afd7ed558ccdULL ;
+x ^= x >> 33 ;
+x *= 0xc4ceb9fe1a85ec53ULL ;
+x ^= x >> 33 ;
+
+return x ;
+}
+
+
+// returns: floor ( x * n / 2 ^ 64 ), a value in [ 0, n ) as uniform as x,
+//          computed without a division
+
+inline uint64_t __bloom_reduce ( uint64_t x, uint64_t n ) noexcept
+
+{
+uint64_t h, l ;
+
+unsigned_double_multiply ( x, n, h, l ) ;
+
+return h ;
+}
+
+
+// Reads a filter size and its words written by output_to of a filter.
+//
+// returns: true on success, false with failbit set otherwise
+
+template < class CharT, class CharTraits, class Word >
+bool __bloom_input_words ( basic_istream < CharT, CharTraits > & i,
+                           size_t size,
+                           vector < Word > & words )
+
+{
+words.resize ( size ) ;
+
+for ( Word & w : words )
+  {
+  uint64_t x ;
+
+  i >> x ;
+  if ( i.fail ( ) )
+    return false ;
+
+  if ( x != uint64_t ( Word ( x ) ) )
+    {
+    i.setstate ( ios_base :: failbit ) ;
+    return false ;
+    }
+
+  w = Word ( x ) ;
+  }
+
+return true ;
+}
+
+
+
+// *** BLOOM_FILTER ***
+
+
+// Set of keys with false positives: contains returns true for all keys
+// inserted, and for other keys with a probability of about the false
+// positive rate the filter was constructed for. A key is represented by
+// hash_number bits of a bit vector, chosen by hashing the result of Hash
+// once for each bit.
+
+template < class Key, class Hash = hash < Key > >
+class bloom_filter
+
+{
+private:
+
+  typedef bit_vector :: word_type word_type ;
+
+  static constexpr size_t word_bit_size = bit_vector :: word_bit_size ;
+
+  bit_vector bits_ ;
+  size_t hash_number_ ;
+  Hash hasher ;
+
+  // The bit of key for the probe i is the hash of key remixed with i, so
+  // that the probes of a key are independent. Double hashing, even with
+  // both hashes reduced to [ 0, m ) before stepping, makes two keys share
+  // all their bits with a probability of about 1 / m ^ 2, which is above
+  // the false positive rate of small filters.
+
+  static uint64_t probe ( uint64_t h, size_t i, uint64_t m )
+    { return __bloom_reduce
+               ( __bloom_mix ( h + i * 0x9e3779b97f4a7c15ULL ), m ) ; }
+
+  void check_compatible ( const bloom_filter & x, const char * message ) const
+    { if (    bits_.size ( ) != x.bits_.size ( )
+          ||  hash_number_ != x.hash_number_ )
+        throw invalid_argument ( message ) ; }
+
+public:
+
+  bloom_filter ( ) :
+    hash_number_ ( 1 )
+    { }
+
+  // filter for n keys with the false positive rate p
+  //
+  // pre: 0 < p < 1
+
+  bloom_filter ( size_t n, double p, const Hash & i_hasher = Hash ( ) ) ;
+
+  // returns: bit size of a filter for n keys with the false positive rate p
+
+  static size_t optimal_bit_size ( size_t n, double p ) ;
+
+  // returns: number of bits per key of a filter of m bits for n keys with
+  //          the least false positive rate
+
+  static size_t optimal_hash_number ( size_t n, size_t m ) ;
+
+  // returns: expected false positive rate of a filter of m bits with k
+  //          bits per key and n keys
+
+  static double false_positive_rate ( size_t n, size_t m, size_t k ) ;
+
+  size_t bit_size ( ) const noexcept
+    { return bits_.size ( ) ; }
+
+  size_t hash_number ( ) const noexcept
+    { return hash_number_ ; }
+
+  const bit_vector & bits ( ) const noexcept
+    { return bits_ ; }
+
+  bool empty ( ) const noexcept
+    { return bits_.size ( ) == 0 ; }
+
+  void insert ( const Key & key ) ;
+
+  // returns: false if key was not inserted, true if it probably was
+
+  bool contains ( const Key & key ) const ;
+
+  void clear ( )
+    { fill ( bits_.data ( ),
+             bits_.data ( ) + bits_.size ( ) / word_bit_size,
+             word_type ( 0 ) ) ; }
+
+  // returns: estimate of the number of distinct keys inserted
+
+  double estimated_size ( ) const ;
+
+  // Union and intersection of the sets of keys. The intersection may
+  // have a higher false positive rate than a filter of the common keys.
+  //
+  // pre: both filters have the same bit size, hash number and hasher
+
+  bloom_filter & operator |= ( const bloom_filter & x )
+    { check_compatible ( x, "bloom_filter :: operator |=, size mismatch" ) ;
+      bits_ |= x.bits_ ;
+      return * this ; }
+
+  bloom_filter & operator &= ( const bloom_filter & x )
+    { check_compatible ( x, "bloom_filter :: operator &=, size mismatch" ) ;
+      bits_ &= x.bits_ ;
+      return * this ; }
+
+  friend bloom_filter operator | ( const bloom_filter & a,
+                                   const bloom_filter & b )
+    { bloom_filter c ( a ) ;
+      c |= b ;
+      return c ; }
+
+  friend bloom_filter operator & ( const bloom_filter & a,
+                                   const bloom_filter & b )
+    { bloom_filter c ( a ) ;
+      c &= b ;
+      return c ; }
+
+  friend bool operator == ( const bloom_filter & a, const bloom_filter & b )
+    { return a.hash_number_ == b.hash_number_  &&  a.bits_ == b.bits_ ; }
+
+  friend bool operator != ( const bloom_filter & a, const bloom_filter & b )
+    { return ! ( a == b ) ; }
+
+  void swap ( bloom_filter & x )
+    { bits_.swap ( x.bits_ ) ;
+      :: swap ( hash_number_, x.hash_number_ ) ;
+      :: swap ( hasher, x.hasher ) ; }
+
+  // The text form is the bit size, the hash number and the words of the
+  // bits, in decimal. The hasher is not written, and must be the same
+  // when the filter is read.
+
+  template < class CharT, class CharTraits >
+  basic_ostream < CharT, CharTraits > &
+    output_to ( basic_ostream < CharT, CharTraits > & o ) const ;
+
+  template < class CharT, class CharTraits >
+  basic_istream < CharT, CharTraits > &
+    input_from ( basic_istream < CharT, CharTraits > & i ) ;
+
+  template < class CharT, class CharTraits >
+  friend basic_ostream < CharT, CharTraits > &
+    operator << ( basic_ostream < CharT, CharTraits > & o,
+                  const bloom_filter & x )
+    { return x.output_to ( o ) ; }
+
+  template < class CharT, class CharTraits >
+  friend basic_istream < CharT, CharTraits > &
+    operator >> ( basic_istream < CharT, CharTraits > & i,
+                  bloom_filter & x )
+    { return x.input_from ( i ) ; }
+
+} ;
+
+
+//
+
+template < class Key, class Hash >
+bloom_filter < Key, Hash > ::
+  bloom_filter ( size_t n, double p, const Hash & i_hasher ) :
+  bits_ ( optimal_bit_size ( n, p ) ),
+  hash_number_ ( optimal_hash_number ( n, bits_.size ( ) ) ),
+  hasher ( i_hasher )
+
+{
+}
+
+
+// The search starts from m = - n ln p / ( ln 2 ) ^ 2, rounded up to whole
+// words, which is too small for small filters and when k is far from
+// m / n ln 2 after rounding.
+
+template < class Key, class Hash >
+size_t bloom_filter < Key, Hash > :: optimal_bit_size ( size_t n, double p )
+
+{
+if ( ! ( p > 0  &&  p < 1 ) )
+  throw invalid_argument
+          ( "bloom_filter :: optimal_bit_size, probability out of range" ) ;
+
+const double ln2 = log ( 2.0 ) ;
+
+double m = ceil ( - double ( max ( n, size_t ( 1 ) ) ) * log ( p )
+                  / ( ln2 * ln2 ) ) ;
+
+size_t words = max ( size_t ( ( m + word_bit_size - 1 ) / word_bit_size ),
+                     size_t ( 1 ) ) ;
+
+while ( false_positive_rate ( n, words * word_bit_size,
+                              optimal_hash_number
+                                ( n, words * word_bit_size ) ) > p )
+  words += max ( words / 64, size_t ( 1 ) ) ;
+
+return words * word_bit_size ;
+}
+
+
+// k = m / n ln 2
+
+template < class Key, class Hash >
+size_t bloom_filter < Key, Hash > ::
+  optimal_hash_number ( size_t n, size_t m )
+
+{
+double k = round ( double ( m ) / double ( max ( n, size_t ( 1 ) ) )
+                   * log ( 2.0 ) ) ;
+
+return size_t ( min ( max ( k, 1.0 ), 64.0 ) ) ;
+}
+
+
+// The fraction x of 1 bits has the mean q = 1 - a1 and the variance v =
+// a2 - a1 ^ 2 + ( a1 - a2 ) / m, where a1 = ( 1 - 1 / m ) ^ k n and
+// a2 = ( 1 - 2 / m ) ^ k n, and the rate E [ x ^ k ] is approximated by
+// q ^ k + k ( k - 1 ) / 2 q ^ ( k - 2 ) v. The variance term is
+// significant for small filters only.
+
+template < class Key, class Hash >
+double bloom_filter < Key, Hash > ::
+  false_positive_rate ( size_t n, size_t m, size_t k )
+
+{
+if ( n == 0 )
+  return 0 ;
+
+if ( m < 2 )
+  return 1 ;
+
+const double kn = double ( k ) * double ( n ),
+             l1 = kn * log1p ( - 1 / double ( m ) ),
+             a1 = exp ( l1 ),
+             a2 = exp ( kn * log1p ( - 2 / double ( m ) ) ),
+             q = - expm1 ( l1 ),
+             v =   a1 * a1
+                   * expm1 (   kn * log1p ( - 2 / double ( m ) )
+                             - 2 * l1 )
+                 + ( a1 - a2 ) / double ( m ),
+             d = double ( k ) ;
+
+return   pow ( q, d )
+       + d * ( d - 1 ) / 2 * pow ( q, d - 2 ) * max ( v, 0.0 ) ;
+}
+
+
+//
+
+template < class Key, class Hash >
+void bloom_filter < Key, Hash > :: insert ( const Key & key )
+
+{
+const uint64_t m = bits_.size ( ) ;
+
+if ( m == 0 )
+  return ;
+
+const uint64_t h = __bloom_mix ( uint64_t ( hasher ( key ) ) ) ;
+
+word_type * p = bits_.data ( ) ;
+
+for ( size_t i = 0 ; i < hash_number_ ; ++ i )
+  {
+  const uint64_t n = probe ( h, i, m ) ;
+
+  p [ n / word_bit_size ] |= word_type ( 1 ) << n % word_bit_size ;
+  }
+}
+
+
+//
+
+template < class Key, class Hash >
+bool bloom_filter < Key, Hash > :: contains ( const Key & key ) const
+
+{
+const uint64_t m = bits_.size ( ) ;
+
+if ( m == 0 )
+  return false ;
+
+const uint64_t h = __bloom_mix ( uint64_t ( hasher ( key ) ) ) ;
+
+const word_type * p = bits_.data ( ) ;
+
+for ( size_t i = 0 ; i < hash_number_ ; ++ i )
+  {
+  const uint64_t n = probe ( h, i, m ) ;
+
+  if ( ( p [ n / word_bit_size ] >> n % word_bit_size & 1 ) == 0 )
+    return false ;
+  }
+
+return true ;
+}
+
+
+// n = - m / k ln ( 1 - x / m ), where x is the number of 1 bits
+
+template < class Key, class Hash >
+double bloom_filter < Key, Hash > :: estimated_size ( ) const
+
+{
+const double m = double ( bits_.size ( ) ) ;
+
+if ( m == 0 )
+  return 0 ;
+
+return   - m / double ( hash_number_ )
+       * log1p ( - double ( hamming_weight ( bits_ ) ) / m ) ;
+}
+
+
+//
+
+template < class Key, class Hash >
+template < class CharT, class CharTraits >
+basic_ostream < CharT, CharTraits > &
+  bloom_filter < Key, Hash > ::
+    output_to ( basic_ostream < CharT, CharTraits > & o ) const
+
+{
+o << uint64_t ( bits_.size ( ) ) << CharT ( ' ' )
+  << uint64_t ( hash_number_ ) ;
+
+const word_type * p = bits_.data ( ) ;
+
+for ( size_t i = 0 ; i < bits_.size ( ) / word_bit_size ; ++ i )
+  o << CharT ( ' ' ) << uint64_t ( p [ i ] ) ;
+
+return o ;
+}
+
+
+// The filter is unchanged if the input fails.
+
+template < class Key, class Hash >
+template < class CharT, class CharTraits >
+basic_istream < CharT, CharTraits > &
+  bloom_filter < Key, Hash > ::
+    input_from ( basic_istream < CharT, CharTraits > & i )
+
+{
+uint64_t m, k ;
+
+i >> m >> k ;
+if ( i.fail ( ) )
+  return i ;
+
+if ( m % word_bit_size != 0  ||  k == 0  ||  k > 64 )
+  {
+  i.setstate ( ios_base :: failbit ) ;
+  return i ;
+  }
+
+vector < word_type > words ;
+
+if ( ! __bloom_input_words ( i, m / word_bit_size, words ) )
+  return i ;
+
+bits_.resize ( m ) ;
+copy ( words.begin ( ), words.end ( ), bits_.data ( ) ) ;
+hash_number_ = k ;
+
+return i ;
+}
+
+
+//
+
+template < class Key, class Hash >
+inline void swap ( bloom_filter < Key, Hash > & a,
+                   bloom_filter < Key, Hash > & b )
+
+{
+a.swap ( b ) ;
+}
+
+
+
+// *** SPLIT BLOCKS ***
+
+
+// A block of a blocked Bloom filter is 8 lanes of 32 bits, aligned so
+// that it lies in one cache line. A key sets one bit in each lane, chosen
+// by multiplying the 32 bit key hash by the odd salt of the lane and
+// taking the 5 high bits of the product.
+
+class alignas ( 32 ) __bloom_block
+
+{
+public:
+
+  static constexpr size_t lanes = 8,
+                          bit_size = lanes * 32 ;
+
+  uint32_t words [ lanes ] ;
+
+  static constexpr uint32_t salt ( size_t i ) noexcept
+    { constexpr uint32_t s [ lanes ] =
+        { 0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+          0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U } ;
+      return s [ i ] ; }
+
+  void generic_insert ( uint32_t key ) noexcept
+    { for ( size_t i = 0 ; i < lanes ; ++ i )
+        words [ i ] |= uint32_t ( 1 ) << ( ( key * salt ( i ) ) >> 27 ) ; }
+
+  bool generic_contains ( uint32_t key ) const noexcept
+    { for ( size_t i = 0 ; i < lanes ; ++ i )
+        if ( ( words [ i ] >> ( ( key * salt ( i ) ) >> 27 ) & 1 ) == 0 )
+          return false ;
+      return true ; }
+
+#ifdef __x86_simd__
+
+  __avx2_function__
+  static __m256i avx2_mask ( uint32_t key ) noexcept
+    { const __m256i s = _mm256_setr_epi32 ( int ( salt ( 0 ) ),
+                                            int ( salt ( 1 ) ),
+                                            int ( salt ( 2 ) ),
+                                            int ( salt ( 3 ) ),
+                                            int ( salt ( 4 ) ),
+                                            int ( salt ( 5 ) ),
+                                            int ( salt ( 6 ) ),
+                                            int ( salt ( 7 ) ) ) ;
+      __m256i x = _mm256_mullo_epi32 ( _mm256_set1_epi32 ( int ( key ) ), s ) ;
+      return _mm256_sllv_epi32 ( _mm256_set1_epi32 ( 1 ),
+                                 _mm256_srli_epi32 ( x, 27 ) ) ; }
+
+  __avx2_function__
+  void avx2_insert ( uint32_t key ) noexcept
+    { __m256i * p = reinterpret_cast < __m256i * > ( words ) ;
+      _mm256_store_si256
+        ( p, _mm256_or_si256 ( _mm256_load_si256 ( p ),
+                               avx2_mask ( key ) ) ) ; }
+
+  // all 8 bits are tested by one instruction
+
+  __avx2_function__
+  bool avx2_contains ( uint32_t key ) const noexcept
+    { const __m256i * p = reinterpret_cast < const __m256i * > ( words ) ;
+      return _mm256_testc_si256 ( _mm256_load_si256 ( p ),
+                                  avx2_mask ( key ) ) ; }
+
+#endif
+
+  void insert ( uint32_t key ) noexcept
+    {
+#ifdef __x86_simd__
+      static const bool has_avx2 = cpu_has_avx2 ( ) ;
+
+      if ( has_avx2 )
+        {
+        avx2_insert ( key ) ;
+        return ;
+        }
+#endif
+
+      generic_insert ( key ) ; }
+
+  bool contains ( uint32_t key ) const noexcept
+    {
+#ifdef __x86_simd__
+      static const bool has_avx2 = cpu_has_avx2 ( ) ;
+
+      if ( has_avx2 )
+        return avx2_contains ( key ) ;
+#endif
+
+      return generic_contains ( key ) ; }
+
+} ;
+
+
+
+// *** BLOCKED_BLOOM_FILTER ***
+
+
+// Bloom filter whose keys are each represented by 8 bits of one block of
+// 256 bits (see __bloom_block), so that insert and contains touch one
+// cache line, and test all bits of a key with a few SIMD instructions.
+// For the same false positive rate it needs somewhat more bits than
+// bloom_filter.
+
+template < class Key, class Hash = hash < Key > >
+class blocked_bloom_filter
+
+{
+private:
+
+  vector < __bloom_block > blocks ;
+  Hash hasher ;
+
+  // The 32 high bits of the hash select the block, the 32 low bits the
+  // bits in the block.
+
+  const __bloom_block & block_of ( uint64_t h ) const
+    { return blocks [ __bloom_reduce ( h >> 32 << 32, blocks.size ( ) ) ] ; }
+
+  __bloom_block & block_of ( uint64_t h )
+    { return blocks [ __bloom_reduce ( h >> 32 << 32, blocks.size ( ) ) ] ; }
+
+  const uint32_t * words ( ) const noexcept
+    { return reinterpret_cast < const uint32_t * > ( blocks.data ( ) ) ; }
+
+  uint32_t * words ( ) noexcept
+    { return reinterpret_cast < uint32_t * > ( blocks.data ( ) ) ; }
+
+  size_t word_size ( ) const noexcept
+    { return blocks.size ( ) * __bloom_block :: lanes ; }
+
+  void check_compatible ( const blocked_bloom_filter & x,
+                          const char * message ) const
+    { if ( blocks.size ( ) != x.blocks.size ( ) )
+        throw invalid_argument ( message ) ; }
+
+public:
+
+  static constexpr size_t hash_number = __bloom_block :: lanes,
+                          block_bit_size = __bloom_block :: bit_size ;
+
+  blocked_bloom_filter ( )
+    { }
+
+  // filter for n keys with the false positive rate p
+  //
+  // pre: 0 < p < 1
+
+  blocked_bloom_filter ( size_t n,
+                         double p,
+                         const Hash & i_hasher = Hash ( ) ) ;
+
+  // returns: number of blocks of a filter for n keys with the false
+  //          positive rate p
+
+  static size_t optimal_block_number ( size_t n, double p ) ;
+
+  // returns: expected false positive rate of a filter of b blocks with n
+  //          keys
+
+  static double false_positive_rate ( size_t n, size_t b ) ;
+
+  size_t bit_size ( ) const noexcept
+    { return blocks.size ( ) * block_bit_size ; }
+
+  size_t block_number ( ) const noexcept
+    { return blocks.size ( ) ; }
+
+  bool empty ( ) const noexcept
+    { return blocks.empty ( ) ; }
+
+  void insert ( const Key & key )
+    { if ( ! blocks.empty ( ) )
+        { uint64_t h = __bloom_mix ( uint64_t ( hasher ( key ) ) ) ;
+          block_of ( h ).insert ( uint32_t ( h ) ) ; } }
+
+  // returns: false if key was not inserted, true if it probably was
+
+  bool contains ( const Key & key ) const
+    { if ( blocks.empty ( ) )
+        return false ;
+      uint64_t h = __bloom_mix ( uint64_t ( hasher ( key ) ) ) ;
+      return block_of ( h ).contains ( uint32_t ( h ) ) ; }
+
+  void clear ( ) noexcept
+    { fill ( words ( ), words ( ) + word_size ( ), uint32_t ( 0 ) ) ; }
+
+  // returns: estimate of the number of distinct keys inserted
+
+  double estimated_size ( ) const ;
+
+  // Union and intersection of the sets of keys. The intersection may
+  // have a higher false positive rate than a filter of the common keys.
+  //
+  // pre: both filters have the same bit size and hasher
+
+  blocked_bloom_filter & operator |= ( const blocked_bloom_filter & x ) ;
+  blocked_bloom_filter & operator &= ( const blocked_bloom_filter & x ) ;
+
+  friend blocked_bloom_filter operator | ( const blocked_bloom_filter & a,
+                                           const blocked_bloom_filter & b )
+    { blocked_bloom_filter c ( a ) ;
+      c |= b ;
+      return c ; }
+
+  friend blocked_bloom_filter operator & ( const blocked_bloom_filter & a,
+                                           const blocked_bloom_filter & b )
+    { blocked_bloom_filter c ( a ) ;
+      c &= b ;
+      return c ; }
+
+  friend bool operator == ( const blocked_bloom_filter & a,
+                            const blocked_bloom_filter & b )
+    { return    a.blocks.size ( ) == b.blocks.size ( )
+             &&  equal ( a.words ( ), a.words ( ) + a.word_size ( ),
+                         b.words ( ) ) ; }
+
+  friend bool operator != ( const blocked_bloom_filter & a,
+                            const blocked_bloom_filter & b )
+    { return ! ( a == b ) ; }
+
+  void swap ( blocked_bloom_filter & x )
+    { blocks.swap ( x.blocks ) ;
+      :: swap ( hasher, x.hasher ) ; }
+
+  // The text form is the bit size and the 32 bit words of the blocks, in
+  // decimal. The hasher is not written, and must be the same when the
+  // filter is read.
+
+  template < class CharT, class CharTraits >
+  basic_ostream < CharT, CharTraits > &
+    output_to ( basic_ostream < CharT, CharTraits > & o ) const ;
+
+  template < class CharT, class CharTraits >
+  basic_istream < CharT, CharTraits > &
+    input_from ( basic_istream < CharT, CharTraits > & i ) ;
+
+  template < class CharT, class CharTraits >
+  friend basic_ostream < CharT, CharTraits > &
+    operator << ( basic_ostream < CharT, CharTraits > & o,
+                  const blocked_bloom_filter & x )
+    { return x.output_to ( o ) ; }
+
+  template < class CharT, class CharTraits >
+  friend basic_istream < CharT, CharTraits > &
+    operator >> ( basic_istream < CharT, CharTraits > & i,
+                  blocked_bloom_filter & x )
+    { return x.input_from ( i ) ; }
+
+} ;
+
+
+//
+
+template < class Key, class Hash >
+blocked_bloom_filter < Key, Hash > ::
+  blocked_bloom_filter ( size_t n, double p, const Hash & i_hasher ) :
+  blocks ( optimal_block_number ( n, p ) ),
+  hasher ( i_hasher )
+
+{
+clear ( ) ;
+}
+
+
+// The number of keys of a block is Poisson distributed with the mean
+// l = n / b, and a block of c keys gives a false positive with the
+// probability ( 1 - ( 31 / 32 ) ^ c ) ^ 8.
+
+template < class Key, class Hash >
+double blocked_bloom_filter < Key, Hash > ::
+  false_positive_rate ( size_t n, size_t b )
+
+{
+if ( b == 0 )
+  return 1 ;
+
+const double l = double ( n ) / double ( b ),
+             d = 10 * sqrt ( l ) + 10 ;
+
+double result = 0 ;
+
+for ( double c = max ( ceil ( l - d ), 0.0 ) ; c <= l + d ; ++ c )
+  result +=   exp ( ( c > 0 ? c * log ( l ) : 0 ) - l - lgamma ( c + 1 ) )
+            * pow ( - expm1 ( c * log1p ( - 1 / 32.0 ) ),
+                    double ( hash_number ) ) ;
+
+return result ;
+}
+
+
+// The search starts from m = - k n / ln ( 1 - p ^ ( 1 / k ) ), k = 8, the
+// bit size of a Bloom filter with k bits per key, which the uneven loads
+// of the blocks make too small.
+
+template < class Key, class Hash >
+size_t blocked_bloom_filter < Key, Hash > ::
+  optimal_block_number ( size_t n, double p )
+
+{
+if ( ! ( p > 0  &&  p < 1 ) )
+  throw invalid_argument
+          ( "blocked_bloom_filter :: optimal_block_number, "
+            "probability out of range" ) ;
+
+const double k = double ( hash_number ) ;
+
+n = max ( n, size_t ( 1 ) ) ;
+
+double m = - k * double ( n ) / log1p ( - pow ( p, 1 / k ) ) ;
+
+size_t b = max ( size_t ( ceil ( m / double ( block_bit_size ) ) ),
+                 size_t ( 1 ) ) ;
+
+while ( false_positive_rate ( n, b ) > p )
+  b += max ( b / 64, size_t ( 1 ) ) ;
+
+return b ;
+}
+
+
+// Each lane is a Bloom filter of 32 * b bits with one bit per key, where
+// b is the number of blocks, so n = - 32 b ln ( 1 - x / m ), where x is
+// the number of 1 bits.
+
+template < class Key, class Hash >
+double blocked_bloom_filter < Key, Hash > :: estimated_size ( ) const
+
+{
+const double m = double ( bit_size ( ) ) ;
+
+if ( m == 0 )
+  return 0 ;
+
+return   - m / double ( hash_number )
+       * log1p ( - double ( words_hamming_weight ( words ( ), word_size ( ) ) )
+                 / m ) ;
+}
+
+
+//
+
+template < class Key, class Hash >
+blocked_bloom_filter < Key, Hash > &
+  blocked_bloom_filter < Key, Hash > ::
+    operator |= ( const blocked_bloom_filter & x )
+
+{
+check_compatible ( x, "blocked_bloom_filter :: operator |=, size mismatch" ) ;
+
+transform ( words ( ), words ( ) + word_size ( ),
+            x.words ( ),
+            words ( ),
+            bit_or < uint32_t > ( ) ) ;
+
+return * this ;
+}
+
+
+//
+
+template < class Key, class Hash >
+blocked_bloom_filter < Key, Hash > &
+  blocked_bloom_filter < Key, Hash > ::
+    operator &= ( const blocked_bloom_filter & x )
+
+{
+check_compatible ( x, "blocked_bloom_filter :: operator &=, size mismatch" ) ;
+
+transform ( words ( ), words ( ) + word_size ( ),
+            x.words ( ),
+            words ( ),
+            bit_and < uint32_t > ( ) ) ;
+
+return * this ;
+}
+
+
+//
+
+template < class Key, class Hash >
+template < class CharT, class CharTraits >
+basic_ostream < CharT, CharTraits > &
+  blocked_bloom_filter < Key, Hash > ::
+    output_to ( basic_ostream < CharT, CharTraits > & o ) const
+
+{
+o << uint64_t ( bit_size ( ) ) ;
+
+for ( size_t i = 0 ; i < word_size ( ) ; ++ i )
+  o << CharT ( ' ' ) << uint64_t ( words ( ) [ i ] ) ;
+
+return o ;
+}
+
+
+// The filter is unchanged if the input fails.
+
+template < class Key, class Hash >
+template < class CharT, class CharTraits >
+basic_istream < CharT, CharTraits > &
+  blocked_bloom_filter < Key, Hash > ::
+    input_from ( basic_istream < CharT, CharTraits > & i )
+
+{
+uint64_t m ;
+
+i >> m ;
+if ( i.fail ( ) )
+  return i ;
+
+if ( m % block_bit_size != 0 )
+  {
+  i.setstate ( ios_base :: failbit ) ;
+  return i ;
+  }
+
+vector < uint32_t > w ;
+
+if ( ! __bloom_input_words ( i, m / 32, w ) )
+  return i ;
+
+blocks.resize ( m / block_bit_size ) ;
+copy ( w.begin ( ), w.end ( ), words ( ) ) ;
+
+return i ;
+}
+
+
+//
+
+template < class Key, class Hash >
+inline void swap ( blocked_bloom_filter < Key, Hash > & a,
+                   blocked_bloom_filter < Key, Hash > & b )
+
+{
+a.swap ( b ) ;
+}
+
+
+
+#endif
@@ -360,4 +360,23 @@ Macro(double,long_double)
 
 
 
+// *** BUILTIN BIT OPERATIONS ***
+
+
+// __builtin_bit_operations__ is defined when the compiler provides
+// __builtin_popcountll, __builtin_clzll, __builtin_ctzll and
+// __builtin_bswap64. Defining CPPEXTS_NO_BUILTIN_BITS selects the portable
+// implementations in numbase.h instead.
+
+#if     (    defined(__gnu_compiler__) \
+         ||  defined(__clang_compiler__) \
+         ||  defined(__mingw_compiler__) ) \
+    &&  ! defined(CPPEXTS_NO_BUILTIN_BITS)
+
+  #define __builtin_bit_operations__
+
+#endif
+
+
+
 #endif
@@ -0,0 +1,385 @@
+// Copyright Ivan Stanojevic 2025.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+
+
+
+#ifndef __CONCBITVECTOR_H
+
+#define __CONCBITVECTOR_H
+
+
+
+#include "cstddef.h"
+#include "vector.h"
+#include "atomic.h"
+#include "algorithm.h"
+#include "utility.h"
+#include "cassert.h"
+#include "future.h"
+
+#include "numbase.h"
+#include "bitcount.h"
+#include "bitvector.h"
+#include "threadpool.h"
+
+
+
+// *** BASIC_CONCURRENT_BIT_VECTOR ***
+
+
+// Bit vector of a fixed size whose bits can be tested and modified by
+// several threads at the same time without locking. Each operation on a
+// bit is one atomic operation on its word, with the given memory order.
+// count, snapshot and clear are atomic for each word, but not for the
+// bit vector as a whole. Bits after the end are 0.
+
+template < class Word >
+class basic_concurrent_bit_vector
+
+{
+public:
+
+  typedef Word word_type ;
+
+  static constexpr size_t word_bit_size = numeric_traits < Word > :: bit_size ;
+
+private:
+
+  static constexpr size_t word_bit_size_1 = word_bit_size - 1 ;
+
+  static constexpr size_t log2_word_bit_size =
+                            const_exponent ( word_bit_size ) - 1 ;
+
+  static_assert ( word_bit_size == size_t ( 1 ) << log2_word_bit_size,
+                  "Illegal word bit size." ) ;
+
+  // words loaded at a time by count, and the minimal number of words of
+  // a task of count and clear
+
+  static constexpr size_t count_block_words = 256,
+                          task_words = 16384,
+                          tasks_per_thread = 4 ;
+
+  vector < atomic < Word > > words ;
+  size_t size_ ;
+
+  static Word bit_mask ( size_t n ) noexcept
+    { return Word ( 1 ) << ( n & word_bit_size_1 ) ; }
+
+  atomic < Word > & word_of ( size_t n ) noexcept
+    { assert ( n < size_ ) ;
+      return words [ n >> log2_word_bit_size ] ; }
+
+  const atomic < Word > & word_of ( size_t n ) const noexcept
+    { assert ( n < size_ ) ;
+      return words [ n >> log2_word_bit_size ] ; }
+
+  template < class F >
+  static void for_word_ranges ( size_t n, F f, thread_pool * pool ) ;
+
+  size_t count_words ( size_t first, size_t last ) const ;
+
+public:
+
+  explicit basic_concurrent_bit_vector ( size_t n = 0, bool b = false ) ;
+
+  template < class Allocator >
+  explicit basic_concurrent_bit_vector
+             ( const basic_bit_vector < Word, Allocator > & x ) ;
+
+  basic_concurrent_bit_vector ( const basic_concurrent_bit_vector & ) =
+    delete ;
+
+  basic_concurrent_bit_vector ( basic_concurrent_bit_vector && x ) noexcept :
+    words ( move ( x.words ) ),
+    size_ ( x.size_ )
+    { x.size_ = 0 ; }
+
+  basic_concurrent_bit_vector &
+    operator = ( const basic_concurrent_bit_vector & ) = delete ;
+
+  basic_concurrent_bit_vector &
+    operator = ( basic_concurrent_bit_vector && x ) noexcept
+    { words = move ( x.words ) ;
+      size_ = x.size_ ;
+      x.size_ = 0 ;
+      return * this ; }
+
+  size_t size ( ) const noexcept
+    { return size_ ; }
+
+  size_t word_size ( ) const noexcept
+    { return words.size ( ) ; }
+
+  bool empty ( ) const noexcept
+    { return size_ == 0 ; }
+
+  // returns: bit n
+
+  bool test ( size_t n, memory_order order = memory_order_seq_cst ) const
+    { return ( word_of ( n ).load ( order ) & bit_mask ( n ) ) != 0 ; }
+
+  // sets bit n
+  //
+  // returns: the previous value of bit n
+
+  bool test_and_set ( size_t n, memory_order order = memory_order_seq_cst )
+    { Word m = bit_mask ( n ) ;
+      return ( word_of ( n ).fetch_or ( m, order ) & m ) != 0 ; }
+
+  // resets bit n
+  //
+  // returns: the previous value of bit n
+
+  bool test_and_reset ( size_t n, memory_order order = memory_order_seq_cst )
+    { Word m = bit_mask ( n ) ;
+      return ( word_of ( n ).fetch_and ( Word ( ~ m ), order ) & m ) != 0 ; }
+
+  // flips bit n
+  //
+  // returns: the previous value of bit n
+
+  bool test_and_flip ( size_t n, memory_order order = memory_order_seq_cst )
+    { Word m = bit_mask ( n ) ;
+      return ( word_of ( n ).fetch_xor ( m, order ) & m ) != 0 ; }
+
+  void set ( size_t n, memory_order order = memory_order_seq_cst )
+    { word_of ( n ).fetch_or ( bit_mask ( n ), order ) ; }
+
+  void reset ( size_t n, memory_order order = memory_order_seq_cst )
+    { word_of ( n ).fetch_and ( Word ( ~ bit_mask ( n ) ), order ) ; }
+
+  void flip ( size_t n, memory_order order = memory_order_seq_cst )
+    { word_of ( n ).fetch_xor ( bit_mask ( n ), order ) ; }
+
+  // returns: word w, holding bits w * word_bit_size to
+  //          ( w + 1 ) * word_bit_size - 1
+
+  Word load_word ( size_t w, memory_order order = memory_order_seq_cst ) const
+    { return words [ w ].load ( order ) ; }
+
+  // pre: the bits of x after the end are 0
+  //
+  // sets the bits of word w selected by x
+  //
+  // returns: the previous value of word w
+
+  Word fetch_or_word ( size_t w,
+                       Word x,
+                       memory_order order = memory_order_seq_cst )
+    { return words [ w ].fetch_or ( x, order ) ; }
+
+  // resets the bits of word w not selected by x
+  //
+  // returns: the previous value of word w
+
+  Word fetch_and_word ( size_t w,
+                        Word x,
+                        memory_order order = memory_order_seq_cst )
+    { return words [ w ].fetch_and ( x, order ) ; }
+
+  // returns: number of 1 bits, counted on the threads of pool, or on the
+  //          calling thread if pool is nullptr
+
+  size_t count ( thread_pool * pool = nullptr ) const ;
+
+  // assigns the bits to x
+
+  template < class Allocator >
+  void snapshot ( basic_bit_vector < Word, Allocator > & x ) const ;
+
+  basic_bit_vector < Word > snapshot ( ) const
+    { basic_bit_vector < Word > x ;
+      snapshot ( x ) ;
+      return x ; }
+
+  // resets all bits, on the threads of pool, or on the calling thread if
+  // pool is nullptr
+
+  void clear ( thread_pool * pool = nullptr ) ;
+
+  void swap ( basic_concurrent_bit_vector & x ) noexcept
+    { words.swap ( x.words ) ;
+      :: swap ( size_, x.size_ ) ; }
+
+} ;
+
+
+//
+
+template < class Word >
+basic_concurrent_bit_vector < Word > ::
+  basic_concurrent_bit_vector ( size_t n, bool b ) :
+  words ( ( n + word_bit_size_1 ) >> log2_word_bit_size ),
+  size_ ( n )
+
+{
+Word w = b ? Word ( -1 ) : Word ( 0 ) ;
+
+for ( atomic < Word > & x : words )
+  x.store ( w, memory_order_relaxed ) ;
+
+if ( b  &&  ( n & word_bit_size_1 ) != 0 )
+  words.back ( ).store ( Word ( bit_mask ( n ) - 1 ), memory_order_relaxed ) ;
+}
+
+
+//
+
+template < class Word >
+template < class Allocator >
+basic_concurrent_bit_vector < Word > ::
+  basic_concurrent_bit_vector
+    ( const basic_bit_vector < Word, Allocator > & x ) :
+  words ( ( x.size ( ) + word_bit_size_1 ) >> log2_word_bit_size ),
+  size_ ( x.size ( ) )
+
+{
+const Word * p = x.data ( ) ;
+
+for ( atomic < Word > & w : words )
+  {
+  w.store ( * p, memory_order_relaxed ) ;
+  ++ p ;
+  }
+}
+
+
+// Calls f ( i, first, last ) for the tasks i of a split of n words into
+// ranges [ first, last ), on the threads of pool, or once on the calling
+// thread if pool is nullptr.
+
+template < class Word >
+template < class F >
+void basic_concurrent_bit_vector < Word > ::
+  for_word_ranges ( size_t n, F f, thread_pool * pool )
+
+{
+size_t tasks =   pool == nullptr
+               ? 1
+               : min ( pool -> size ( ) * tasks_per_thread,
+                       n / task_words ) ;
+
+run_range_tasks ( pool, n, tasks, f ) ;
+}
+
+
+// returns: number of 1 bits in the words [ first, last )
+
+template < class Word >
+size_t basic_concurrent_bit_vector < Word > ::
+  count_words ( size_t first, size_t last ) const
+
+{
+// the words are loaded into a buffer, to be counted by the word kernels
+
+Word buffer [ count_block_words ] ;
+
+size_t result = 0 ;
+
+while ( first < last )
+  {
+  size_t n = min ( last - first, count_block_words ) ;
+
+  for ( size_t i = 0 ; i < n ; ++ i )
+    buffer [ i ] = words [ first + i ].load ( memory_order_relaxed ) ;
+
+  result += words_hamming_weight ( buffer, n ) ;
+  first += n ;
+  }
+
+atomic_thread_fence ( memory_order_acquire ) ;
+
+return result ;
+}
+
+
+//
+
+template < class Word >
+size_t basic_concurrent_bit_vector < Word > ::
+  count ( thread_pool * pool ) const
+
+{
+vector < size_t > counts
+                    ( pool == nullptr
+                      ? 1
+                      : pool -> size ( ) * tasks_per_thread,
+                      0 ) ;
+
+for_word_ranges ( words.size ( ),
+                  [ this, & counts ] ( size_t i, size_t first, size_t last )
+                  { counts [ i ] = count_words ( first, last ) ; },
+                  pool ) ;
+
+size_t result = 0 ;
+
+for ( size_t c : counts )
+  result += c ;
+
+return result ;
+}
+
+
+//
+
+template < class Word >
+template < class Allocator >
+void basic_concurrent_bit_vector < Word > ::
+  snapshot ( basic_bit_vector < Word, Allocator > & x ) const
+
+{
+x.resize ( size_ ) ;
+
+Word * p = x.data ( ) ;
+
+for ( const atomic < Word > & w : words )
+  {
+  * p = w.load ( memory_order_relaxed ) ;
+  ++ p ;
+  }
+
+atomic_thread_fence ( memory_order_acquire ) ;
+}
+
+
+//
+
+template < class Word >
+void basic_concurrent_bit_vector < Word > ::
+  clear ( thread_pool * pool )
+
+{
+atomic_thread_fence ( memory_order_release ) ;
+
+for_word_ranges ( words.size ( ),
+                  [ this ] ( size_t, size_t first, size_t last )
+                  { for ( size_t i = first ; i < last ; ++ i )
+                      words [ i ].store ( Word ( 0 ),
+                                          memory_order_relaxed ) ; },
+                  pool ) ;
+}
+
+
+//
+
+template < class Word >
+inline void swap ( basic_concurrent_bit_vector < Word > & a,
+                   basic_concurrent_bit_vector < Word > & b ) noexcept
+
+{
+a.swap ( b ) ;
+}
+
+
+
+// *** CONCURRENT_BIT_VECTOR ***
+
+
+typedef basic_concurrent_bit_vector < uint > concurrent_bit_vector ;
+
+
+
+#endif
@@ -17,6 +17,7 @@
 #include "istream.h"
 #include "ostream.h"
 #include "utility.h"
+#include "type_traits.h"
 
 #include "typeconv.h"
 #include "numbase.h"
@@ -68,6 +69,105 @@ FOR_BUILTIN_UNSIGNED_INTEGRAL_TYPES(__DEFINE_NORMALIZE_CONGRUENCE_RING_ELEMENT)
 #undef __DEFINE_NORMALIZE_CONGRUENCE_RING_ELEMENT
 
 
+//
+
+template < class T >
+inline void
+  normalize_congruence_ring_element ( T & value,
+                                      const invariant_divider < T > & divider )
+
+{
+value = divider.remainder ( value ) ;
+}
+
+
+//
+
+#define __DEFINE_NORMALIZE_CONGRUENCE_RING_ELEMENT(Type)                    \
+                                                                            \
+inline void                                                                 \
+  normalize_congruence_ring_element                                         \
+    ( Type & value, const invariant_divider < Type > & divider )            \
+                                                                            \
+{                                                                           \
+value = divider.remainder ( value ) ;                                       \
+if ( value < 0 )                                                            \
+  value += divider.divisor ( ) ;                                            \
+}
+
+FOR_BUILTIN_SIGNED_INTEGRAL_TYPES(__DEFINE_NORMALIZE_CONGRUENCE_RING_ELEMENT)
+
+#undef __DEFINE_NORMALIZE_CONGRUENCE_RING_ELEMENT
+
+
+
+// *** CONGRUENCE_RING_NORMALIZER ***
+
+
+//
+
+template < class RingTraits, class = void >
+class __ring_traits_has_divider
+
+{
+public:
+
+  static constexpr bool value = false ;
+
+} ;
+
+
+//
+
+template < class RingTraits >
+class __ring_traits_has_divider
+        < RingTraits, void_t < decltype ( RingTraits :: divider ( ) ) > >
+
+{
+public:
+
+  static constexpr bool value = true ;
+
+} ;
+
+
+//
+
+template < class RingTraits,
+           bool HasDivider = __ring_traits_has_divider < RingTraits > :: value >
+class congruence_ring_normalizer ;
+
+
+//
+
+template < class RingTraits >
+class congruence_ring_normalizer < RingTraits, false >
+
+{
+public:
+
+  static void operate ( typename RingTraits :: value_type & value )
+    { normalize_congruence_ring_element ( value,
+                                          RingTraits :: modulus ( ) ) ; }
+
+} ;
+
+
+//
+
+template < class RingTraits >
+class congruence_ring_normalizer < RingTraits, true >
+
+{
+public:
+
+  static void operate ( typename RingTraits :: value_type & value )
+    { normalize_congruence_ring_element ( value,
+                                          RingTraits :: divider ( ) ) ; }
+
+} ;
+
+
 
 // *** FORWARD DECLARATIONS ***
 
@@ -127,8 +227,7 @@ private:
   value_type value ;
 
   void normalize ( )
-    { normalize_congruence_ring_element ( value,
-                                          RingTraits :: modulus ( ) ) ; }
+    { congruence_ring_normalizer < RingTraits > :: operate ( value ) ; }
 
 public:
 
@@ -258,6 +357,46 @@ public:
 
 
 
+// *** RUNTIME_Z_RING_TRAITS ***
+
+
+// Modulus is set at run time, and reductions use a precomputed
+// invariant_divider. Distinct Tag types give independent moduli.
+
+template < class T = sint, class Tag = void >
+class runtime_z_ring_traits
+
+{
+private:
+
+  static invariant_divider < T > divider_ ;
+
+public:
+
+  typedef T value_type ;
+
+  static value_type modulus ( )
+    { return divider_.divisor ( ) ; }
+
+  static const invariant_divider < T > & divider ( )
+    { return divider_ ; }
+
+  // pre: m > 0
+
+  static void set_modulus ( const value_type & m )
+    { assert ( m > value_type ( 0 ) ) ;
+      divider_ = invariant_divider < T > ( m ) ; }
+
+} ;
+
+
+//
+
+template < class T, class Tag >
+invariant_divider < T > runtime_z_ring_traits < T, Tag > :: divider_ ;
+
+
+
 // *** IMPLICIT CONVERSION ***
 
 
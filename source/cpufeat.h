@@ -0,0 +1,106 @@
+// Copyright Ivan Stanojevic 2025.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+
+
+
+#ifndef __CPUFEAT_H
+
+#define __CPUFEAT_H
+
+
+
+#include "compspec.h"
+
+
+
+// *** SIMD SUPPORT ***
+
+
+// __x86_simd__ is defined when the compiler can generate POPCNT, SSE2,
+// AVX2 and AVX-512 code for individual functions (see __popcnt_function__,
+// __sse2_function__, __avx2_function__ and __avx512_popcnt_function__),
+// independently of the options the translation unit is compiled with.
+// Defining CPPEXTS_NO_SIMD disables all SIMD code paths.
+
+#if     (    defined(__gnu_compiler__) \
+         ||  defined(__clang_compiler__) \
+         ||  defined(__mingw_compiler__) ) \
+    &&  (    defined(__x86_64__) \
+         ||  defined(__i386__) ) \
+    &&  ! defined(CPPEXTS_NO_SIMD)
+
+  #define __x86_simd__
+
+  #include <immintrin.h>
+
+  #define __popcnt_function__ __attribute__ ( ( target ( "popcnt" ) ) )
+  #define __sse2_function__ __attribute__ ( ( target ( "sse2" ) ) )
+  #define __avx2_function__ __attribute__ ( ( target ( "avx2" ) ) )
+  #define __avx512_popcnt_function__ \
+            __attribute__ ( ( target ( "avx512f,avx512vpopcntdq" ) ) )
+
+#endif
+
+
+
+// *** CPU FEATURES ***
+
+
+//
+
+inline bool cpu_has_popcnt ( )
+
+{
+#ifdef __x86_simd__
+  return __builtin_cpu_supports ( "popcnt" ) ;
+#else
+  return false ;
+#endif
+}
+
+
+//
+
+inline bool cpu_has_sse2 ( )
+
+{
+#ifdef __x86_simd__
+  return __builtin_cpu_supports ( "sse2" ) ;
+#else
+  return false ;
+#endif
+}
+
+
+//
+
+inline bool cpu_has_avx2 ( )
+
+{
+#ifdef __x86_simd__
+  return __builtin_cpu_supports ( "avx2" ) ;
+#else
+  return false ;
+#endif
+}
+
+
+// AVX-512 foundation together with the VPOPCNTDQ population count
+// extension
+
+inline bool cpu_has_avx512_popcnt ( )
+
+{
+#ifdef __x86_simd__
+  return     __builtin_cpu_supports ( "avx512f" )
+         &&  __builtin_cpu_supports ( "avx512vpopcntdq" ) ;
+#else
+  return false ;
+#endif
+}
+
+
+
+#endif
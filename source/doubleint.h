@@ -83,39 +83,39 @@ bool operator < ( const signed_double_int < T > & a,
                   const signed_double_int < T > & b ) ;
 
 template < class T >
-bool is_negative ( const signed_double_int < T > & x ) ;
+constexpr bool is_negative ( const signed_double_int < T > & x ) ;
 
 template < class T >
-bool is_high_bit_set ( const signed_double_int < T > & x ) ;
+constexpr bool is_high_bit_set ( const signed_double_int < T > & x ) ;
 
 template < class T >
 sint hamming_weight ( const signed_double_int < T > & x ) ;
 
 template < class T >
-signed_double_int < T >
+constexpr signed_double_int < T >
   signed_shift_right ( const signed_double_int < T > & x, sint n ) ;
 
 template < class T >
-signed_double_int < T >
+constexpr signed_double_int < T >
   unsigned_shift_right ( const signed_double_int < T > & x, sint n ) ;
 
 template < class T >
-sint exponent ( const signed_double_int < T > & x ) ;
+constexpr sint exponent ( const signed_double_int < T > & x ) ;
 
 template < class T >
 signed_double_int < T > reverse ( const signed_double_int < T > & x ) ;
 
 template < class T >
-void normalize_gcd ( signed_double_int < T > & gcd ) ;
+constexpr void normalize_gcd ( signed_double_int < T > & gcd ) ;
 
 template < class T >
-void normalize_gcd_ext ( signed_double_int < T > & c,
-                         signed_double_int < T > & d,
-                         signed_double_int < T > & gcd ) ;
+constexpr void normalize_gcd_ext ( signed_double_int < T > & c,
+                                   signed_double_int < T > & d,
+                                   signed_double_int < T > & gcd ) ;
 
 template < class T >
-void normalize_fraction ( signed_double_int < T > & a,
-                          signed_double_int < T > & b ) ;
+constexpr void normalize_fraction ( signed_double_int < T > & a,
+                                    signed_double_int < T > & b ) ;
 
 
 //
@@ -165,24 +165,24 @@ bool operator < ( const unsigned_double_int < T > & a,
                   const unsigned_double_int < T > & b ) ;
 
 template < class T >
-bool is_negative ( const unsigned_double_int < T > & x ) ;
+constexpr bool is_negative ( const unsigned_double_int < T > & x ) ;
 
 template < class T >
-bool is_high_bit_set ( const unsigned_double_int < T > & x ) ;
+constexpr bool is_high_bit_set ( const unsigned_double_int < T > & x ) ;
 
 template < class T >
 sint hamming_weight ( const unsigned_double_int < T > & x ) ;
 
 template < class T >
-unsigned_double_int < T >
+constexpr unsigned_double_int < T >
   signed_shift_right ( const unsigned_double_int < T > & x, sint n ) ;
 
 template < class T >
-unsigned_double_int < T >
+constexpr unsigned_double_int < T >
   unsigned_shift_right ( const unsigned_double_int < T > & x, sint n ) ;
 
 template < class T >
-sint exponent ( const unsigned_double_int < T > & x ) ;
+constexpr sint exponent ( const unsigned_double_int < T > & x ) ;
 
 template < class T >
 unsigned_double_int < T > reverse ( const unsigned_double_int < T > & x ) ;
@@ -195,7 +195,7 @@ unsigned_double_int < T > reverse ( const unsigned_double_int < T > & x ) ;
 //
 
 template < class DoubleInt >
-inline DoubleInt double_int_shift_left ( DoubleInt x, sint n )
+constexpr DoubleInt double_int_shift_left ( DoubleInt x, sint n )
 
 {
 assert ( n >= 0  &&  n < 2 * DoubleInt :: digit_bit_size ) ;
@@ -222,7 +222,7 @@ return x ;
 //
 
 template < class DoubleInt >
-inline DoubleInt double_int_signed_shift_right ( DoubleInt x, sint n )
+constexpr DoubleInt double_int_signed_shift_right ( DoubleInt x, sint n )
 
 {
 assert ( n >= 0  &&  n < 2 * DoubleInt :: digit_bit_size ) ;
@@ -256,7 +256,7 @@ return x ;
 //
 
 template < class DoubleInt >
-inline DoubleInt double_int_unsigned_shift_right ( DoubleInt x, sint n )
+constexpr DoubleInt double_int_unsigned_shift_right ( DoubleInt x, sint n )
 
 {
 assert ( n >= 0  &&  n < 2 * DoubleInt :: digit_bit_size ) ;
@@ -291,22 +291,22 @@ return x ;
 //       r = a % b
 
 template < class DoubleInt >
-inline void double_int_positive_divmod ( DoubleInt a, DoubleInt b,
-                                         DoubleInt & q, DoubleInt & r )
+constexpr void double_int_positive_divmod ( DoubleInt a, DoubleInt b,
+                                            DoubleInt & q, DoubleInt & r )
 
 {
 assert ( b != 0 ) ;
 
 typedef typename DoubleInt :: unsigned_digit_type unsigned_digit_type ;
 
-sint bit_shift ;
+sint bit_shift ( 0 ) ;
 
 if ( b.high == 0 )
   {
   sint bit_shift_comp = exponent ( b.low ) ;
   bit_shift = DoubleInt :: digit_bit_size - bit_shift_comp ;
 
-  unsigned_digit_type ac ;
+  unsigned_digit_type ac ( 0 ) ;
 
   if ( bit_shift == 0 )
     ac = 0 ;
@@ -333,7 +333,7 @@ else
   sint bit_shift_comp = exponent ( b.high ) ;
   bit_shift = DoubleInt :: digit_bit_size - bit_shift_comp ;
 
-  unsigned_digit_type ac ;
+  unsigned_digit_type ac ( 0 ) ;
 
   if ( bit_shift == 0 )
     ac = 0 ;
@@ -350,12 +350,12 @@ else
   q.high = 0 ;
   q.low = unsigned_double_divide ( ac, a.high, b.high ) ;
 
-  unsigned_digit_type mc, mh, ml ;
+  unsigned_digit_type mc ( 0 ), mh ( 0 ), ml ( 0 ) ;
 
   unsigned_double_multiply ( q.low, b.low, mh, ml ) ;
 
   {
-  unsigned_digit_type th ;
+  unsigned_digit_type th ( 0 ) ;
   unsigned_double_multiply ( q.low, b.high, mc, th ) ;
 
   mh += th ;
@@ -515,8 +515,8 @@ class double_int_unsigned_double_multiplier
 {
 public:
 
-  static void operate ( DoubleInt a, DoubleInt b,
-                        DoubleInt & h, DoubleInt & l ) ;
+  static constexpr void operate ( DoubleInt a, DoubleInt b,
+                                  DoubleInt & h, DoubleInt & l ) ;
 
 } ;
 
@@ -524,19 +524,19 @@ public:
 //
 
 template < class DoubleInt >
-inline void double_int_unsigned_double_multiplier < DoubleInt > ::
-              operate ( DoubleInt a, DoubleInt b,
-                        DoubleInt & h, DoubleInt & l )
+constexpr void double_int_unsigned_double_multiplier < DoubleInt > ::
+                 operate ( DoubleInt a, DoubleInt b,
+                           DoubleInt & h, DoubleInt & l )
 
 {
 typedef typename DoubleInt :: unsigned_digit_type unsigned_digit_type ;
 
-unsigned_digit_type hh, hl, lh, ll ;
+unsigned_digit_type hh ( 0 ), hl ( 0 ), lh ( 0 ), ll ( 0 ) ;
 
 unsigned_double_multiply ( a.high, b.high, hh, hl ) ;
 unsigned_double_multiply ( a.low, b.low, lh, ll ) ;
 
-unsigned_digit_type mc ( 0 ), mh, ml ;
+unsigned_digit_type mc ( 0 ), mh ( 0 ), ml ( 0 ) ;
 
 {
 unsigned_digit_type as ( a.high + a.low ),
@@ -636,7 +636,7 @@ class double_int_unsigned_double_divider
 {
 public:
 
-  static DoubleInt operate ( DoubleInt h, DoubleInt l, DoubleInt b ) ;
+  static constexpr DoubleInt operate ( DoubleInt h, DoubleInt l, DoubleInt b ) ;
 
 } ;
 
@@ -644,24 +644,24 @@ public:
 //
 
 template < class DoubleInt >
-inline DoubleInt double_int_unsigned_double_divider < DoubleInt > ::
-                   operate ( DoubleInt h, DoubleInt l, DoubleInt b )
+constexpr DoubleInt double_int_unsigned_double_divider < DoubleInt > ::
+                      operate ( DoubleInt h, DoubleInt l, DoubleInt b )
 
 {
 typedef typename DoubleInt :: unsigned_digit_type unsigned_digit_type ;
 
-DoubleInt result ;
+DoubleInt result ( 0, 0 ) ;
 
 result.high =   h.high == b.high
               ? unsigned_digit_type ( -1 )
               : unsigned_double_divide ( h.high, h.low, b.high ) ;
 
 {
-unsigned_digit_type mc, mh, ml ;
+unsigned_digit_type mc ( 0 ), mh ( 0 ), ml ( 0 ) ;
 unsigned_double_multiply ( result.high, b.low, mh, ml ) ;
 
 {
-unsigned_digit_type th ;
+unsigned_digit_type th ( 0 ) ;
 unsigned_double_multiply ( result.high, b.high, mc, th ) ;
 
 mh += th ;
@@ -712,11 +712,11 @@ result.low =   h.low == b.high
              : unsigned_double_divide ( h.low, l.high, b.high ) ;
 
 {
-unsigned_digit_type mc, mh, ml ;
+unsigned_digit_type mc ( 0 ), mh ( 0 ), ml ( 0 ) ;
 unsigned_double_multiply ( result.low, b.low, mh, ml ) ;
 
 {
-unsigned_digit_type th ;
+unsigned_digit_type th ( 0 ) ;
 unsigned_double_multiply ( result.low, b.high, mc, th ) ;
 
 mh += th ;
@@ -796,7 +796,7 @@ public:
 
 private:
 
-  sint positive_exponent ( ) const
+  constexpr sint positive_exponent ( ) const
     { sint e = :: exponent ( high ) ;
       return e != 0 ? e + digit_bit_size : :: exponent ( low ) ; }
 
@@ -828,45 +828,45 @@ public:
   signed_double_int ( )
     { }
 
-  signed_double_int ( const unsigned_digit_type & i_high,
-                      const unsigned_digit_type & i_low ) :
+  constexpr signed_double_int ( const unsigned_digit_type & i_high,
+                                const unsigned_digit_type & i_low ) :
     high ( i_high ),
     low ( i_low )
     { }
 
-  signed_double_int ( const signed_digit_type & x ) :
+  constexpr signed_double_int ( const signed_digit_type & x ) :
     high ( x >= 0 ? 0 : -1 ),
     low ( x )
     { }
 
-  signed_double_int ( const unsigned_digit_type & x ) :
+  constexpr signed_double_int ( const unsigned_digit_type & x ) :
     high ( 0 ),
     low ( x )
     { }
 
   template < class S >
-  signed_double_int ( const S & x,
-                      typename implicit_conversion_test
-                                 < S, unsigned_digit_type > :: result =
-                        implicit_conversion_allowed ) :
+  constexpr signed_double_int ( const S & x,
+                                typename implicit_conversion_test
+                                  < S, unsigned_digit_type > :: result =
+                                  implicit_conversion_allowed ) :
     high (   numeric_traits < S > :: is_signed
            ? ( is_negative ( x ) ? -1 : 0 )
            : 0 ),
     low ( x )
     { }
 
-  static signed_double_int min ( )
+  static constexpr signed_double_int min ( )
     { return signed_double_int
                ( numeric_traits < signed_digit_type > :: min ( ), 0 ) ; }
 
-  static signed_double_int max ( )
+  static constexpr signed_double_int max ( )
     { return signed_double_int
                ( numeric_traits < signed_digit_type > :: max ( ), -1 ) ; }
 
-  bool is_high_bit_set ( ) const
+  constexpr bool is_high_bit_set ( ) const
     { return :: is_high_bit_set ( high ) ; }
 
-  sint exponent ( ) const
+  constexpr sint exponent ( ) const
     { return   is_high_bit_set ( )
              ? ( - * this ).positive_exponent ( )
              : positive_exponent ( ) ; }
@@ -884,35 +884,35 @@ public:
              ? - from_positive_floating_point ( - x )
              : from_positive_floating_point ( x ) ; }
 
-  const signed_double_int & operator + ( ) const
+  constexpr const signed_double_int & operator + ( ) const
     { return * this ; }
 
-  signed_double_int operator - ( ) const
+  constexpr signed_double_int operator - ( ) const
     { return signed_double_int ( low == 0 ? - high : - high - 1, - low ) ; }
 
-  friend signed_double_int operator + ( const signed_double_int & a,
-                                        const signed_double_int & b )
+  friend constexpr signed_double_int operator + ( const signed_double_int & a,
+                                                  const signed_double_int & b )
     { signed_double_int result ( a.high + b.high, a.low + b.low ) ;
       if ( result.low < a.low )
         ++ result.high ;
       return result ; }
 
-  friend signed_double_int operator - ( const signed_double_int & a,
-                                        const signed_double_int & b )
+  friend constexpr signed_double_int operator - ( const signed_double_int & a,
+                                                  const signed_double_int & b )
     { signed_double_int result ( a.high - b.high, a.low - b.low ) ;
       if ( result.low > a.low )
         -- result.high ;
       return result ; }
 
-  friend signed_double_int operator * ( const signed_double_int & a,
-                                        const signed_double_int & b )
-    { signed_double_int result ;
+  friend constexpr signed_double_int operator * ( const signed_double_int & a,
+                                                  const signed_double_int & b )
+    { signed_double_int result ( 0, 0 ) ;
       unsigned_double_multiply ( a.low, b.low, result.high, result.low ) ;
       result.high += a.high * b.low + a.low * b.high ;
       return result ; }
 
-  friend void divmod ( signed_double_int a, signed_double_int b,
-                       signed_double_int & q, signed_double_int & r )
+  friend constexpr void divmod ( signed_double_int a, signed_double_int b,
+                                 signed_double_int & q, signed_double_int & r )
     { if ( is_negative ( a ) )
         if ( is_negative ( b ) )
           {
@@ -934,26 +934,26 @@ public:
         else
           double_int_positive_divmod ( a, b, q, r ) ; }
 
-  friend signed_double_int operator / ( const signed_double_int & a,
-                                        const signed_double_int & b )
-    { signed_double_int q, r ;
+  friend constexpr signed_double_int operator / ( const signed_double_int & a,
+                                                  const signed_double_int & b )
+    { signed_double_int q ( 0, 0 ), r ( 0, 0 ) ;
       divmod ( a, b, q, r ) ;
       return q ; }
 
-  friend signed_double_int operator % ( const signed_double_int & a,
-                                        const signed_double_int & b )
-    { signed_double_int q, r ;
+  friend constexpr signed_double_int operator % ( const signed_double_int & a,
+                                                  const signed_double_int & b )
+    { signed_double_int q ( 0, 0 ), r ( 0, 0 ) ;
       divmod ( a, b, q, r ) ;
       return r ; }
 
-  signed_double_int & operator += ( const signed_double_int & b )
+  constexpr signed_double_int & operator += ( const signed_double_int & b )
     { low += b.low ;
       if ( low < b.low )
         ++ high ;
       high += b.high ;
       return * this ; }
 
-  signed_double_int & operator -= ( const signed_double_int & b )
+  constexpr signed_double_int & operator -= ( const signed_double_int & b )
     { unsigned_digit_type ln ( low - b.low ) ;
       if ( ln > low )
         -- high ;
@@ -961,85 +961,85 @@ public:
       high -= b.high ;
       return * this ; }
 
-  signed_double_int & operator *= ( const signed_double_int & b )
+  constexpr signed_double_int & operator *= ( const signed_double_int & b )
     { return * this = * this * b ; }
 
-  signed_double_int & operator /= ( const signed_double_int & b )
+  constexpr signed_double_int & operator /= ( const signed_double_int & b )
     { return * this = * this / b ; }
 
-  signed_double_int & operator %= ( const signed_double_int & b )
+  constexpr signed_double_int & operator %= ( const signed_double_int & b )
     { return * this = * this % b ; }
 
-  signed_double_int & operator ++ ( )
+  constexpr signed_double_int & operator ++ ( )
     { ++ low ;
       if ( low == 0 )
         ++ high ;
       return * this ; }
 
-  signed_double_int operator ++ ( int )
+  constexpr signed_double_int operator ++ ( int )
     { signed_double_int t ( * this ) ;
       ++ * this ;
       return t ; }
 
-  signed_double_int & operator -- ( )
+  constexpr signed_double_int & operator -- ( )
     { -- low ;
       if ( low == unsigned_digit_type ( -1 ) )
         -- high ;
       return * this ; }
 
-  signed_double_int operator -- ( int )
+  constexpr signed_double_int operator -- ( int )
     { signed_double_int t ( * this ) ;
       -- * this ;
       return t ; }
 
-  signed_double_int operator ~ ( ) const
+  constexpr signed_double_int operator ~ ( ) const
     { return signed_double_int ( ~ high, ~ low ) ; }
 
-  friend signed_double_int operator & ( const signed_double_int & a,
-                                        const signed_double_int & b )
+  friend constexpr signed_double_int operator & ( const signed_double_int & a,
+                                                  const signed_double_int & b )
     { return signed_double_int ( a.high & b.high, a.low & b.low ) ; }
 
-  friend signed_double_int operator | ( const signed_double_int & a,
-                                        const signed_double_int & b )
+  friend constexpr signed_double_int operator | ( const signed_double_int & a,
+                                                  const signed_double_int & b )
     { return signed_double_int ( a.high | b.high, a.low | b.low ) ; }
 
-  friend signed_double_int operator ^ ( const signed_double_int & a,
-                                        const signed_double_int & b )
+  friend constexpr signed_double_int operator ^ ( const signed_double_int & a,
+                                                  const signed_double_int & b )
     { return signed_double_int ( a.high ^ b.high, a.low ^ b.low ) ; }
 
-  signed_double_int & operator &= ( const signed_double_int & b )
+  constexpr signed_double_int & operator &= ( const signed_double_int & b )
     { high &= b.high ;
       low &= b.low ;
       return * this ; }
 
-  signed_double_int & operator |= ( const signed_double_int & b )
+  constexpr signed_double_int & operator |= ( const signed_double_int & b )
     { high |= b.high ;
       low |= b.low ;
       return * this ; }
 
-  signed_double_int & operator ^= ( const signed_double_int & b )
+  constexpr signed_double_int & operator ^= ( const signed_double_int & b )
     { high ^= b.high ;
       low ^= b.low ;
       return * this ; }
 
-  signed_double_int operator << ( sint n ) const
+  constexpr signed_double_int operator << ( sint n ) const
     { return double_int_shift_left ( * this, n ) ; }
 
-  signed_double_int operator >> ( sint n ) const
+  constexpr signed_double_int operator >> ( sint n ) const
     { return double_int_signed_shift_right ( * this, n ) ; }
 
-  signed_double_int & operator <<= ( sint n )
+  constexpr signed_double_int & operator <<= ( sint n )
     { return * this = * this << n ; }
 
-  signed_double_int & operator >>= ( sint n )
+  constexpr signed_double_int & operator >>= ( sint n )
     { return * this = * this >> n ; }
 
-  friend bool operator == ( const signed_double_int & a,
-                            const signed_double_int & b )
+  friend constexpr bool operator == ( const signed_double_int & a,
+                                      const signed_double_int & b )
     { return a.high == b.high  &&  a.low == b.low ; }
 
-  friend bool operator < ( const signed_double_int & a,
-                           const signed_double_int & b )
+  friend constexpr bool operator < ( const signed_double_int & a,
+                                     const signed_double_int & b )
     { return       convert_to < signed_digit_type > ( a.high )
                  < convert_to < signed_digit_type > ( b.high )
              ||  ( a.high == b.high  &&  a.low < b.low ) ; }
@@ -1081,10 +1081,10 @@ public:
   static constexpr bool has_double_size_type = false ;
   typedef void double_size_type ;
 
-  static signed_double_int < T > min ( )
+  static constexpr signed_double_int < T > min ( )
     { return signed_double_int < T > :: min ( ) ; }
 
-  static signed_double_int < T > max ( )
+  static constexpr signed_double_int < T > max ( )
     { return signed_double_int < T > :: max ( ) ; }
 
 } ;
@@ -1145,7 +1145,7 @@ class range_rnd_static_generator < signed_double_int < T > > :
 //
 
 template < class T >
-inline bool is_negative ( const signed_double_int < T > & x )
+constexpr bool is_negative ( const signed_double_int < T > & x )
 
 {
 return x.is_high_bit_set ( ) ;
@@ -1155,7 +1155,7 @@ return x.is_high_bit_set ( ) ;
 //
 
 template < class T >
-inline bool is_high_bit_set ( const signed_double_int < T > & x )
+constexpr bool is_high_bit_set ( const signed_double_int < T > & x )
 
 {
 return x.is_high_bit_set ( ) ;
@@ -1175,8 +1175,8 @@ return hamming_weight ( x.high ) + hamming_weight ( x.low ) ;
 //
 
 template < class T >
-inline signed_double_int < T >
-         signed_shift_right ( const signed_double_int < T > & x, sint n )
+constexpr signed_double_int < T >
+            signed_shift_right ( const signed_double_int < T > & x, sint n )
 
 {
 return double_int_signed_shift_right ( x, n ) ;
@@ -1186,8 +1186,8 @@ return double_int_signed_shift_right ( x, n ) ;
 //
 
 template < class T >
-inline signed_double_int < T >
-         unsigned_shift_right ( const signed_double_int < T > & x, sint n )
+constexpr signed_double_int < T >
+            unsigned_shift_right ( const signed_double_int < T > & x, sint n )
 
 {
 return double_int_unsigned_shift_right ( x, n ) ;
@@ -1197,7 +1197,7 @@ return double_int_unsigned_shift_right ( x, n ) ;
 //
 
 template < class T >
-inline sint exponent ( const signed_double_int < T > & x )
+constexpr sint exponent ( const signed_double_int < T > & x )
 
 {
 return x.exponent ( ) ;
@@ -1217,7 +1217,7 @@ return signed_double_int < T > ( reverse ( x.low ), reverse ( x.high ) ) ;
 //
 
 template < class T >
-inline void normalize_gcd ( signed_double_int < T > & gcd )
+constexpr void normalize_gcd ( signed_double_int < T > & gcd )
 
 {
 if ( is_negative ( gcd ) )
@@ -1228,9 +1228,9 @@ if ( is_negative ( gcd ) )
 //
 
 template < class T >
-inline void normalize_gcd_ext ( signed_double_int < T > & c,
-                                signed_double_int < T > & d,
-                                signed_double_int < T > & gcd )
+constexpr void normalize_gcd_ext ( signed_double_int < T > & c,
+                                   signed_double_int < T > & d,
+                                   signed_double_int < T > & gcd )
 
 {
 if ( is_negative ( gcd ) )
@@ -1245,8 +1245,8 @@ if ( is_negative ( gcd ) )
 //
 
 template < class T >
-inline void normalize_fraction ( signed_double_int < T > & a,
-                                 signed_double_int < T > & b )
+constexpr void normalize_fraction ( signed_double_int < T > & a,
+                                    signed_double_int < T > & b )
 
 {
 if ( is_negative ( b ) )
@@ -1332,48 +1332,48 @@ public:
   unsigned_double_int ( )
     { }
 
-  unsigned_double_int ( const unsigned_digit_type & i_high,
-                        const unsigned_digit_type & i_low ) :
+  constexpr unsigned_double_int ( const unsigned_digit_type & i_high,
+                                  const unsigned_digit_type & i_low ) :
     high ( i_high ),
     low ( i_low )
     { }
 
-  unsigned_double_int ( const signed_digit_type & x ) :
+  constexpr unsigned_double_int ( const signed_digit_type & x ) :
     high ( x >= 0 ? 0 : -1 ),
     low ( x )
     { }
 
-  unsigned_double_int ( const unsigned_digit_type & x ) :
+  constexpr unsigned_double_int ( const unsigned_digit_type & x ) :
     high ( 0 ),
     low ( x )
     { }
 
-  unsigned_double_int ( const signed_double_int < T > & x ) :
+  constexpr unsigned_double_int ( const signed_double_int < T > & x ) :
     high ( x.high ),
     low ( x.low )
     { }
 
   template < class S >
-  unsigned_double_int ( const S & x,
-                        typename implicit_conversion_test
-                                   < S, unsigned_digit_type > :: result =
-                          implicit_conversion_allowed ) :
+  constexpr unsigned_double_int ( const S & x,
+                                  typename implicit_conversion_test
+                                    < S, unsigned_digit_type > :: result =
+                                    implicit_conversion_allowed ) :
     high (   numeric_traits < S > :: is_signed
            ? ( is_negative ( x ) ? -1 : 0 )
            : 0 ),
     low ( x )
     { }
 
-  static unsigned_double_int min ( )
+  static constexpr unsigned_double_int min ( )
     { return 0 ; }
 
-  static unsigned_double_int max ( )
+  static constexpr unsigned_double_int max ( )
     { return unsigned_double_int ( -1, -1 ) ; }
 
-  bool is_high_bit_set ( ) const
+  constexpr bool is_high_bit_set ( ) const
     { return :: is_high_bit_set ( high ) ; }
 
-  sint exponent ( ) const
+  constexpr sint exponent ( ) const
     { sint e = :: exponent ( high ) ;
       return e != 0 ? e + digit_bit_size : :: exponent ( low ) ; }
 
@@ -1393,57 +1393,63 @@ public:
              ? - from_positive_floating_point ( - x )
              : from_positive_floating_point ( x ) ; }
 
-  const unsigned_double_int & operator + ( ) const
+  constexpr const unsigned_double_int & operator + ( ) const
     { return * this ; }
 
-  unsigned_double_int operator - ( ) const
+  constexpr unsigned_double_int operator - ( ) const
     { return unsigned_double_int ( low == 0 ? - high : - high - 1, - low ) ; }
 
-  friend unsigned_double_int operator + ( const unsigned_double_int & a,
-                                          const unsigned_double_int & b )
+  friend constexpr unsigned_double_int
+    operator + ( const unsigned_double_int & a,
+                 const unsigned_double_int & b )
     { unsigned_double_int result ( a.high + b.high, a.low + b.low ) ;
       if ( result.low < a.low )
         ++ result.high ;
       return result ; }
 
-  friend unsigned_double_int operator - ( const unsigned_double_int & a,
-                                          const unsigned_double_int & b )
+  friend constexpr unsigned_double_int
+    operator - ( const unsigned_double_int & a,
+                 const unsigned_double_int & b )
     { unsigned_double_int result ( a.high - b.high, a.low - b.low ) ;
       if ( result.low > a.low )
         -- result.high ;
       return result ; }
 
-  friend unsigned_double_int operator * ( const unsigned_double_int & a,
-                                          const unsigned_double_int & b )
-    { unsigned_double_int result ;
+  friend constexpr unsigned_double_int
+    operator * ( const unsigned_double_int & a,
+                 const unsigned_double_int & b )
+    { unsigned_double_int result ( 0, 0 ) ;
       unsigned_double_multiply ( a.low, b.low, result.high, result.low ) ;
       result.high += a.high * b.low + a.low * b.high ;
       return result ; }
 
-  friend void divmod ( unsigned_double_int a, unsigned_double_int b,
-                       unsigned_double_int & q, unsigned_double_int & r )
+  friend constexpr void
+    divmod ( unsigned_double_int a, unsigned_double_int b,
+             unsigned_double_int & q, unsigned_double_int & r )
     { double_int_positive_divmod ( a, b, q, r ) ; }
 
-  friend unsigned_double_int operator / ( const unsigned_double_int & a,
-                                          const unsigned_double_int & b )
-    { unsigned_double_int q, r ;
+  friend constexpr unsigned_double_int
+    operator / ( const unsigned_double_int & a,
+                 const unsigned_double_int & b )
+    { unsigned_double_int q ( 0, 0 ), r ( 0, 0 ) ;
       divmod ( a, b, q, r ) ;
       return q ; }
 
-  friend unsigned_double_int operator % ( const unsigned_double_int & a,
-                                          const unsigned_double_int & b )
-    { unsigned_double_int q, r ;
+  friend constexpr unsigned_double_int
+    operator % ( const unsigned_double_int & a,
+                 const unsigned_double_int & b )
+    { unsigned_double_int q ( 0, 0 ), r ( 0, 0 ) ;
       divmod ( a, b, q, r ) ;
       return r ; }
 
-  unsigned_double_int & operator += ( const unsigned_double_int & b )
+  constexpr unsigned_double_int & operator += ( const unsigned_double_int & b )
     { low += b.low ;
       if ( low < b.low )
         ++ high ;
       high += b.high ;
       return * this ; }
 
-  unsigned_double_int & operator -= ( const unsigned_double_int & b )
+  constexpr unsigned_double_int & operator -= ( const unsigned_double_int & b )
     { unsigned_digit_type ln ( low - b.low ) ;
       if ( ln > low )
         -- high ;
@@ -1451,85 +1457,88 @@ public:
       high -= b.high ;
       return * this ; }
 
-  unsigned_double_int & operator *= ( const unsigned_double_int & b )
+  constexpr unsigned_double_int & operator *= ( const unsigned_double_int & b )
     { return * this = * this * b ; }
 
-  unsigned_double_int & operator /= ( const unsigned_double_int & b )
+  constexpr unsigned_double_int & operator /= ( const unsigned_double_int & b )
     { return * this = * this / b ; }
 
-  unsigned_double_int & operator %= ( const unsigned_double_int & b )
+  constexpr unsigned_double_int & operator %= ( const unsigned_double_int & b )
     { return * this = * this % b ; }
 
-  unsigned_double_int & operator ++ ( )
+  constexpr unsigned_double_int & operator ++ ( )
     { ++ low ;
       if ( low == 0 )
         ++ high ;
       return * this ; }
 
-  unsigned_double_int operator ++ ( int )
+  constexpr unsigned_double_int operator ++ ( int )
     { unsigned_double_int t ( * this ) ;
       ++ * this ;
       return t ; }
 
-  unsigned_double_int & operator -- ( )
+  constexpr unsigned_double_int & operator -- ( )
     { -- low ;
       if ( low == unsigned_digit_type ( -1 ) )
         -- high ;
       return * this ; }
 
-  unsigned_double_int operator -- ( int )
+  constexpr unsigned_double_int operator -- ( int )
     { unsigned_double_int t ( * this ) ;
       -- * this ;
       return t ; }
 
-  unsigned_double_int operator ~ ( ) const
+  constexpr unsigned_double_int operator ~ ( ) const
     { return unsigned_double_int ( ~ high, ~ low ) ; }
 
-  friend unsigned_double_int operator & ( const unsigned_double_int & a,
-                                          const unsigned_double_int & b )
+  friend constexpr unsigned_double_int
+    operator & ( const unsigned_double_int & a,
+                 const unsigned_double_int & b )
     { return unsigned_double_int ( a.high & b.high, a.low & b.low ) ; }
 
-  friend unsigned_double_int operator | ( const unsigned_double_int & a,
-                                          const unsigned_double_int & b )
+  friend constexpr unsigned_double_int
+    operator | ( const unsigned_double_int & a,
+                 const unsigned_double_int & b )
     { return unsigned_double_int ( a.high | b.high, a.low | b.low ) ; }
 
-  friend unsigned_double_int operator ^ ( const unsigned_double_int & a,
-                                          const unsigned_double_int & b )
+  friend constexpr unsigned_double_int
+    operator ^ ( const unsigned_double_int & a,
+                 const unsigned_double_int & b )
     { return unsigned_double_int ( a.high ^ b.high, a.low ^ b.low ) ; }
 
-  unsigned_double_int & operator &= ( const unsigned_double_int & b )
+  constexpr unsigned_double_int & operator &= ( const unsigned_double_int & b )
     { high &= b.high ;
       low &= b.low ;
       return * this ; }
 
-  unsigned_double_int & operator |= ( const unsigned_double_int & b )
+  constexpr unsigned_double_int & operator |= ( const unsigned_double_int & b )
     { high |= b.high ;
       low |= b.low ;
       return * this ; }
 
-  unsigned_double_int & operator ^= ( const unsigned_double_int & b )
+  constexpr unsigned_double_int & operator ^= ( const unsigned_double_int & b )
     { high ^= b.high ;
       low ^= b.low ;
       return * this ; }
 
-  unsigned_double_int operator << ( sint n ) const
+  constexpr unsigned_double_int operator << ( sint n ) const
     { return double_int_shift_left ( * this, n ) ; }
 
-  unsigned_double_int operator >> ( sint n ) const
+  constexpr unsigned_double_int operator >> ( sint n ) const
     { return double_int_unsigned_shift_right ( * this, n ) ; }
 
-  unsigned_double_int & operator <<= ( sint n )
+  constexpr unsigned_double_int & operator <<= ( sint n )
     { return * this = * this << n ; }
 
-  unsigned_double_int & operator >>= ( sint n )
+  constexpr unsigned_double_int & operator >>= ( sint n )
     { return * this = * this >> n ; }
 
-  friend bool operator == ( const unsigned_double_int & a,
-                            const unsigned_double_int & b )
+  friend constexpr bool operator == ( const unsigned_double_int & a,
+                                      const unsigned_double_int & b )
     { return a.high == b.high  &&  a.low == b.low ; }
 
-  friend bool operator < ( const unsigned_double_int & a,
-                           const unsigned_double_int & b )
+  friend constexpr bool operator < ( const unsigned_double_int & a,
+                                     const unsigned_double_int & b )
     { return a.high < b.high  ||  ( a.high == b.high  &&  a.low < b.low ) ; }
 
   template < class CharT, class CharTraits >
@@ -1569,10 +1578,10 @@ public:
   static constexpr bool has_double_size_type = false ;
   typedef void double_size_type ;
 
-  static unsigned_double_int < T > min ( )
+  static constexpr unsigned_double_int < T > min ( )
     { return unsigned_double_int < T > :: min ( ) ; }
 
-  static unsigned_double_int < T > max ( )
+  static constexpr unsigned_double_int < T > max ( )
     { return unsigned_double_int < T > :: max ( ) ; }
 
 } ;
@@ -1633,7 +1642,7 @@ class range_rnd_static_generator < unsigned_double_int < T > > :
 //
 
 template < class T >
-inline bool is_negative ( const unsigned_double_int < T > & x )
+constexpr bool is_negative ( const unsigned_double_int < T > & x )
 
 {
 return false ;
@@ -1643,7 +1652,7 @@ return false ;
 //
 
 template < class T >
-inline bool is_high_bit_set ( const unsigned_double_int < T > & x )
+constexpr bool is_high_bit_set ( const unsigned_double_int < T > & x )
 
 {
 return x.is_high_bit_set ( ) ;
@@ -1663,8 +1672,8 @@ return hamming_weight ( x.high ) + hamming_weight ( x.low ) ;
 //
 
 template < class T >
-inline unsigned_double_int < T >
-         signed_shift_right ( const unsigned_double_int < T > & x, sint n )
+constexpr unsigned_double_int < T >
+            signed_shift_right ( const unsigned_double_int < T > & x, sint n )
 
 {
 return double_int_signed_shift_right ( x, n ) ;
@@ -1674,8 +1683,8 @@ return double_int_signed_shift_right ( x, n ) ;
 //
 
 template < class T >
-inline unsigned_double_int < T >
-         unsigned_shift_right ( const unsigned_double_int < T > & x, sint n )
+constexpr unsigned_double_int < T >
+            unsigned_shift_right ( const unsigned_double_int < T > & x, sint n )
 
 {
 return double_int_unsigned_shift_right ( x, n ) ;
@@ -1685,7 +1694,7 @@ return double_int_unsigned_shift_right ( x, n ) ;
 //
 
 template < class T >
-inline sint exponent ( const unsigned_double_int < T > & x )
+constexpr sint exponent ( const unsigned_double_int < T > & x )
 
 {
 return x.exponent ( ) ;
@@ -1764,7 +1773,7 @@ class type_converter < unsigned_double_int < T >, signed_double_int < T > >
 {
 public:
 
-  static signed_double_int < T >
+  static constexpr signed_double_int < T >
     operate ( const unsigned_double_int < T > & x )
     { return signed_double_int < T > ( x.high, x.low ) ; }
 
@@ -1781,7 +1790,7 @@ class type_converter
 {
 public:
 
-  static typename signed_double_int < T > :: unsigned_digit_type
+  static constexpr typename signed_double_int < T > :: unsigned_digit_type
     operate ( const signed_double_int < T > & x )
     { return x.low ; }
 
@@ -1798,7 +1807,7 @@ class type_converter
 {
 public:
 
-  static typename unsigned_double_int < T > :: unsigned_digit_type
+  static constexpr typename unsigned_double_int < T > :: unsigned_digit_type
     operate ( const unsigned_double_int < T > & x )
     { return x.low ; }
 
@@ -1820,7 +1829,7 @@ class from_double_int_type_converter < DoubleInt, Destination, false >
 {
 public:
 
-  static Destination operate ( const DoubleInt & x )
+  static constexpr Destination operate ( const DoubleInt & x )
     { return convert_to < Destination > ( x.low ) ; }
 
 } ;
@@ -1880,7 +1889,7 @@ class to_double_int_type_converter < Source, DoubleInt, false >
 {
 public:
 
-  static DoubleInt operate ( const Source & x )
+  static constexpr DoubleInt operate ( const Source & x )
     { return DoubleInt ( x ) ; }
 
 } ;
@@ -0,0 +1,915 @@
+// Copyright Ivan Stanojevic 2025.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+
+
+
+#ifndef __FIXEDBATCH_H
+
+#define __FIXEDBATCH_H
+
+
+
+#include "cstddef.h"
+#include "cstdint.h"
+#include "type_traits.h"
+#include "algorithm.h"
+
+#include "numbase.h"
+#include "fixedpoint.h"
+#include "cpufeat.h"
+
+
+
+// *** FIXED_POINT_WIDE_ACCUMULATOR ***
+
+
+// 128 bit two's complement accumulator for exact sums of products of
+// fixed point numbers with at most 32 bits.
+
+class fixed_point_wide_accumulator
+
+{
+public:
+
+  fixed_point_wide_accumulator ( ) :
+    high ( 0 ),
+    low ( 0 )
+    { }
+
+  // pre: 0 <= shift < 64
+  //
+  // adds x * 2 ^ shift
+
+  void add ( uint64_t x, sint shift = 0 )
+    { uint64_t l ( x << shift ),
+               h ( shift == 0 ? 0 : x >> ( 64 - shift ) ) ;
+      low += l ;
+      high += h + ( low < l ) ; }
+
+  // pre: 0 <= shift < 64
+  //
+  // subtracts x * 2 ^ shift
+
+  void subtract ( uint64_t x, sint shift = 0 )
+    { uint64_t l ( x << shift ),
+               h ( shift == 0 ? 0 : x >> ( 64 - shift ) ),
+               old_low ( low ) ;
+      low -= l ;
+      high -= h + ( low > old_low ) ; }
+
+  void add_signed ( int64_t x )
+    { uint64_t l ( x ) ;
+      low += l ;
+      high += ( x < 0 ? uint64_t ( -1 ) : 0 ) + ( low < l ) ; }
+
+  // returns: accumulated sum divided by 2 ^ FractionalBits, rounded
+  //          like signed_fixed_point multiplication (half away from zero)
+  //          and truncated to the bits of T
+
+  template < class T, sint FractionalBits >
+  signed_fixed_point < T, FractionalBits > rounded ( ) const ;
+
+private:
+
+  uint64_t high, low ;
+
+} ;
+
+
+//
+
+template < class T, sint FractionalBits >
+signed_fixed_point < T, FractionalBits >
+  fixed_point_wide_accumulator :: rounded ( ) const
+
+{
+typedef signed_fixed_point < T, FractionalBits > fixed_point_type ;
+typedef typename fixed_point_type :: unsigned_value_type unsigned_value_type ;
+
+static_assert (    fixed_point_type :: bit_size <= 32,
+                "Wide accumulator supports at most 32 bit fixed point." ) ;
+
+bool negative ( ( high >> 63 ) != 0 ) ;
+
+uint64_t h ( high ), l ( low ) ;
+
+if ( negative )
+  {
+  l = - l ;
+  h = ~ h + ( l == 0 ) ;
+  }
+
+uint64_t half ( uint64_t ( 1 ) << ( FractionalBits - 1 ) ) ;
+
+l += half ;
+if ( l < half )
+  ++ h ;
+
+unsigned_value_type
+  r ( ( l >> FractionalBits ) | ( h << ( 64 - FractionalBits ) ) ) ;
+
+return fixed_point_type :: from_raw_data
+         ( unsigned_value_type ( negative ? - r : r ) ) ;
+}
+
+
+
+// *** FIXED_POINT_BATCH_KERNELS ***
+
+
+// Element bit size for which SIMD kernels exist, 0 if none.
+
+template < class T >
+constexpr sint fixed_point_simd_element_bit_size ( )
+
+{
+#ifdef __x86_simd__
+  return      is_integral < T > :: value
+          &&  (    numeric_traits < T > :: bit_size == 16
+               ||  numeric_traits < T > :: bit_size == 32 )
+         ? numeric_traits < T > :: bit_size
+         : 0 ;
+#else
+  return 0 ;
+#endif
+}
+
+
+//
+
+template < class T,
+           sint FractionalBits,
+           sint ElementBitSize = fixed_point_simd_element_bit_size < T > ( ) >
+class fixed_point_batch_kernels ;
+
+
+// Kernels used when no SIMD kernels exist for the element type, and for
+// the elements left over by the SIMD kernels.
+
+template < class T, sint FractionalBits >
+class fixed_point_batch_kernels < T, FractionalBits, 0 >
+
+{
+public:
+
+  typedef signed_fixed_point < T, FractionalBits > fixed_point_type ;
+
+  static void add ( const fixed_point_type * a,
+                    const fixed_point_type * b,
+                    fixed_point_type * result,
+                    size_t n )
+    { for ( size_t i = 0 ; i < n ; ++ i )
+        result [ i ] = a [ i ] + b [ i ] ; }
+
+  static void subtract ( const fixed_point_type * a,
+                         const fixed_point_type * b,
+                         fixed_point_type * result,
+                         size_t n )
+    { for ( size_t i = 0 ; i < n ; ++ i )
+        result [ i ] = a [ i ] - b [ i ] ; }
+
+  static void multiply ( const fixed_point_type * a,
+                         const fixed_point_type * b,
+                         fixed_point_type * result,
+                         size_t n )
+    { for ( size_t i = 0 ; i < n ; ++ i )
+        result [ i ] = a [ i ] * b [ i ] ; }
+
+  static void multiply_accumulate ( const fixed_point_type * a,
+                                    const fixed_point_type * b,
+                                    fixed_point_type * result,
+                                    size_t n )
+    { for ( size_t i = 0 ; i < n ; ++ i )
+        result [ i ] += a [ i ] * b [ i ] ; }
+
+  static void inner_product ( const fixed_point_type * a,
+                              const fixed_point_type * b,
+                              size_t n,
+                              fixed_point_wide_accumulator & s )
+    { for ( size_t i = 0 ; i < n ; ++ i )
+        s.add_signed (   int64_t ( a [ i ] . signed_data ( ) )
+                       * int64_t ( b [ i ] . signed_data ( ) ) ) ; }
+
+} ;
+
+
+#ifdef __x86_simd__
+
+
+// SSE2 and AVX2 kernels, specialized for 16 and 32 bit elements.
+//
+// Multiplication follows signed_fixed_point :: multiply: the product of
+// the absolute values is rounded by adding half of the last fractional
+// bit and shifting right, and the sign is applied afterwards.
+//
+// Inner product lane sums are kept in 64 bit lanes as biased unsigned
+// values and moved to the wide accumulator every simd_block_size
+// elements, so that they can not overflow.
+
+template < class T, sint FractionalBits, sint ElementBitSize >
+class fixed_point_simd_kernels ;
+
+
+//
+
+template < class T, sint FractionalBits >
+class fixed_point_simd_kernels < T, FractionalBits, 16 >
+
+{
+public:
+
+  typedef signed_fixed_point < T, FractionalBits > fixed_point_type ;
+
+  typedef fixed_point_batch_kernels < T, FractionalBits, 0 > scalar_kernels ;
+
+  static constexpr size_t sse2_lanes = 8 ;
+  static constexpr size_t avx2_lanes = 16 ;
+
+  static constexpr size_t simd_block_size = size_t ( 1 ) << 24 ;
+
+  __sse2_function__
+  static __m128i sse2_load ( const fixed_point_type * p )
+    { return _mm_loadu_si128 ( reinterpret_cast < const __m128i * > ( p ) ) ; }
+
+  __sse2_function__
+  static void sse2_store ( fixed_point_type * p, __m128i x )
+    { _mm_storeu_si128 ( reinterpret_cast < __m128i * > ( p ), x ) ; }
+
+  __sse2_function__
+  static __m128i sse2_multiply ( __m128i x, __m128i y )
+    { __m128i half ( _mm_set1_epi32 ( 1 << ( FractionalBits - 1 ) ) ),
+              sx ( _mm_srai_epi16 ( x, 15 ) ),
+              sy ( _mm_srai_epi16 ( y, 15 ) ),
+              ax ( _mm_sub_epi16 ( _mm_xor_si128 ( x, sx ), sx ) ),
+              ay ( _mm_sub_epi16 ( _mm_xor_si128 ( y, sy ), sy ) ),
+              l ( _mm_mullo_epi16 ( ax, ay ) ),
+              h ( _mm_mulhi_epu16 ( ax, ay ) ),
+              r0 ( _mm_srli_epi32
+                     ( _mm_add_epi32 ( _mm_unpacklo_epi16 ( l, h ), half ),
+                       FractionalBits ) ),
+              r1 ( _mm_srli_epi32
+                     ( _mm_add_epi32 ( _mm_unpackhi_epi16 ( l, h ), half ),
+                       FractionalBits ) ),
+              r ( _mm_packs_epi32
+                    ( _mm_srai_epi32 ( _mm_slli_epi32 ( r0, 16 ), 16 ),
+                      _mm_srai_epi32 ( _mm_slli_epi32 ( r1, 16 ), 16 ) ) ),
+              s ( _mm_xor_si128 ( sx, sy ) ) ;
+      return _mm_sub_epi16 ( _mm_xor_si128 ( r, s ), s ) ; }
+
+  __sse2_function__
+  static void sse2_add ( const fixed_point_type * a,
+                         const fixed_point_type * b,
+                         fixed_point_type * result,
+                         size_t n )
+    { size_t i ( 0 ) ;
+      for ( ; i + sse2_lanes <= n ; i += sse2_lanes )
+        sse2_store ( result + i,
+                     _mm_add_epi16 ( sse2_load ( a + i ),
+                                     sse2_load ( b + i ) ) ) ;
+      scalar_kernels :: add ( a + i, b + i, result + i, n - i ) ; }
+
+  __sse2_function__
+  static void sse2_subtract ( const fixed_point_type * a,
+                              const fixed_point_type * b,
+                              fixed_point_type * result,
+                              size_t n )
+    { size_t i ( 0 ) ;
+      for ( ; i + sse2_lanes <= n ; i += sse2_lanes )
+        sse2_store ( result + i,
+                     _mm_sub_epi16 ( sse2_load ( a + i ),
+                                     sse2_load ( b + i ) ) ) ;
+      scalar_kernels :: subtract ( a + i, b + i, result + i, n - i ) ; }
+
+  __sse2_function__
+  static void sse2_multiply ( const fixed_point_type * a,
+                              const fixed_point_type * b,
+                              fixed_point_type * result,
+                              size_t n )
+    { size_t i ( 0 ) ;
+      for ( ; i + sse2_lanes <= n ; i += sse2_lanes )
+        sse2_store ( result + i,
+                     sse2_multiply ( sse2_load ( a + i ),
+                                     sse2_load ( b + i ) ) ) ;
+      scalar_kernels :: multiply ( a + i, b + i, result + i, n - i ) ; }
+
+  __sse2_function__
+  static void sse2_multiply_accumulate ( const fixed_point_type * a,
+                                         const fixed_point_type * b,
+                                         fixed_point_type * result,
+                                         size_t n )
+    { size_t i ( 0 ) ;
+      for ( ; i + sse2_lanes <= n ; i += sse2_lanes )
+        sse2_store ( result + i,
+                     _mm_add_epi16 ( sse2_load ( result + i ),
+                                     sse2_multiply ( sse2_load ( a + i ),
+                                                     sse2_load ( b + i ) ) ) ) ;
+      scalar_kernels :: multiply_accumulate
+                          ( a + i, b + i, result + i, n - i ) ; }
+
+  __sse2_function__
+  static void sse2_inner_product ( const fixed_point_type * a,
+                                   const fixed_point_type * b,
+                                   size_t n,
+                                   fixed_point_wide_accumulator & s )
+    { __m128i bias ( _mm_set1_epi32 ( INT32_MIN ) ),
+              zero ( _mm_setzero_si128 ( ) ) ;
+      size_t i ( 0 ) ;
+      while ( i + sse2_lanes <= n )
+        { size_t block_end
+            ( i + min ( n - i, simd_block_size ) / sse2_lanes * sse2_lanes ) ;
+          __m128i sum ( _mm_setzero_si128 ( ) ) ;
+          for ( size_t j = i ; j < block_end ; j += sse2_lanes )
+            { __m128i x ( sse2_load ( a + j ) ),
+                      y ( sse2_load ( b + j ) ),
+                      l ( _mm_mullo_epi16 ( x, y ) ),
+                      h ( _mm_mulhi_epi16 ( x, y ) ),
+                      p0 ( _mm_xor_si128 ( _mm_unpacklo_epi16 ( l, h ),
+                                           bias ) ),
+                      p1 ( _mm_xor_si128 ( _mm_unpackhi_epi16 ( l, h ),
+                                           bias ) ) ;
+              sum = _mm_add_epi64 ( sum, _mm_unpacklo_epi32 ( p0, zero ) ) ;
+              sum = _mm_add_epi64 ( sum, _mm_unpackhi_epi32 ( p0, zero ) ) ;
+              sum = _mm_add_epi64 ( sum, _mm_unpacklo_epi32 ( p1, zero ) ) ;
+              sum = _mm_add_epi64 ( sum, _mm_unpackhi_epi32 ( p1, zero ) ) ; }
+          uint64_t lanes [ 2 ] = { } ;
+          _mm_storeu_si128 ( reinterpret_cast < __m128i * > ( lanes ), sum ) ;
+          s.add ( lanes [ 0 ] ) ;
+          s.add ( lanes [ 1 ] ) ;
+          s.subtract ( block_end - i, 31 ) ;
+          i = block_end ; }
+      scalar_kernels :: inner_product ( a + i, b + i, n - i, s ) ; }
+
+  __avx2_function__
+  static __m256i avx2_load ( const fixed_point_type * p )
+    { return _mm256_loadu_si256
+               ( reinterpret_cast < const __m256i * > ( p ) ) ; }
+
+  __avx2_function__
+  static void avx2_store ( fixed_point_type * p, __m256i x )
+    { _mm256_storeu_si256 ( reinterpret_cast < __m256i * > ( p ), x ) ; }
+
+  __avx2_function__
+  static __m256i avx2_multiply ( __m256i x, __m256i y )
+    { __m256i half ( _mm256_set1_epi32 ( 1 << ( FractionalBits - 1 ) ) ),
+              ax ( _mm256_abs_epi16 ( x ) ),
+              ay ( _mm256_abs_epi16 ( y ) ),
+              l ( _mm256_mullo_epi16 ( ax, ay ) ),
+              h ( _mm256_mulhi_epu16 ( ax, ay ) ),
+              r0 ( _mm256_srli_epi32
+                     ( _mm256_add_epi32 ( _mm256_unpacklo_epi16 ( l, h ),
+                                          half ),
+                       FractionalBits ) ),
+              r1 ( _mm256_srli_epi32
+                     ( _mm256_add_epi32 ( _mm256_unpackhi_epi16 ( l, h ),
+                                          half ),
+                       FractionalBits ) ),
+              r ( _mm256_packs_epi32
+                    ( _mm256_srai_epi32 ( _mm256_slli_epi32 ( r0, 16 ), 16 ),
+                      _mm256_srai_epi32 ( _mm256_slli_epi32 ( r1, 16 ),
+                                          16 ) ) ),
+              s ( _mm256_srai_epi16 ( _mm256_xor_si256 ( x, y ), 15 ) ) ;
+      return _mm256_sub_epi16 ( _mm256_xor_si256 ( r, s ), s ) ; }
+
+  __avx2_function__
+  static void avx2_add ( const fixed_point_type * a,
+                         const fixed_point_type * b,
+                         fixed_point_type * result,
+                         size_t n )
+    { size_t i ( 0 ) ;
+      for ( ; i + avx2_lanes <= n ; i += avx2_lanes )
+        avx2_store ( result + i,
+                     _mm256_add_epi16 ( avx2_load ( a + i ),
+                                        avx2_load ( b + i ) ) ) ;
+      scalar_kernels :: add ( a + i, b + i, result + i, n - i ) ; }
+
+  __avx2_function__
+  static void avx2_subtract ( const fixed_point_type * a,
+                              const fixed_point_type * b,
+                              fixed_point_type * result,
+                              size_t n )
+    { size_t i ( 0 ) ;
+      for ( ; i + avx2_lanes <= n ; i += avx2_lanes )
+        avx2_store ( result + i,
+                     _mm256_sub_epi16 ( avx2_load ( a + i ),
+                                        avx2_load ( b + i ) ) ) ;
+      scalar_kernels :: subtract ( a + i, b + i, result + i, n - i ) ; }
+
+  __avx2_function__
+  static void avx2_multiply ( const fixed_point_type * a,
+                              const fixed_point_type * b,
+                              fixed_point_type * result,
+                              size_t n )
+    { size_t i ( 0 ) ;
+      for ( ; i + avx2_lanes <= n ; i += avx2_lanes )
+        avx2_store ( result + i,
+                     avx2_multiply ( avx2_load ( a + i ),
+                                     avx2_load ( b + i ) ) ) ;
+      scalar_kernels :: multiply ( a + i, b + i, result + i, n - i ) ; }
+
+  __avx2_function__
+  static void avx2_multiply_accumulate ( const fixed_point_type * a,
+                                         const fixed_point_type * b,
+                                         fixed_point_type * result,
+                                         size_t n )
+    { size_t i ( 0 ) ;
+      for ( ; i + avx2_lanes <= n ; i += avx2_lanes )
+        avx2_store ( result + i,
+                     _mm256_add_epi16
+                       ( avx2_load ( result + i ),
+                         avx2_multiply ( avx2_load ( a + i ),
+                                         avx2_load ( b + i ) ) ) ) ;
+      scalar_kernels :: multiply_accumulate
+                          ( a + i, b + i, result + i, n - i ) ; }
+
+  __avx2_function__
+  static void avx2_inner_product ( const fixed_point_type * a,
+                                   const fixed_point_type * b,
+                                   size_t n,
+                                   fixed_point_wide_accumulator & s )
+    { __m256i bias ( _mm256_set1_epi32 ( INT32_MIN ) ),
+              zero ( _mm256_setzero_si256 ( ) ) ;
+      size_t i ( 0 ) ;
+      while ( i + avx2_lanes <= n )
+        { size_t block_end
+            ( i + min ( n - i, simd_block_size ) / avx2_lanes * avx2_lanes ) ;
+          __m256i sum ( _mm256_setzero_si256 ( ) ) ;
+          for ( size_t j = i ; j < block_end ; j += avx2_lanes )
+            { __m256i x ( avx2_load ( a + j ) ),
+                      y ( avx2_load ( b + j ) ),
+                      l ( _mm256_mullo_epi16 ( x, y ) ),
+                      h ( _mm256_mulhi_epi16 ( x, y ) ),
+                      p0 ( _mm256_xor_si256 ( _mm256_unpacklo_epi16 ( l, h ),
+                                              bias ) ),
+                      p1 ( _mm256_xor_si256 ( _mm256_unpackhi_epi16 ( l, h ),
+                                              bias ) ) ;
+              sum = _mm256_add_epi64 ( sum,
+                                       _mm256_unpacklo_epi32 ( p0, zero ) ) ;
+              sum = _mm256_add_epi64 ( sum,
+                                       _mm256_unpackhi_epi32 ( p0, zero ) ) ;
+              sum = _mm256_add_epi64 ( sum,
+                                       _mm256_unpacklo_epi32 ( p1, zero ) ) ;
+              sum = _mm256_add_epi64 ( sum,
+                                       _mm256_unpackhi_epi32 ( p1, zero ) ) ; }
+          uint64_t lanes [ 4 ] = { } ;
+          _mm256_storeu_si256 ( reinterpret_cast < __m256i * > ( lanes ),
+                                sum ) ;
+          for ( sint k = 0 ; k < 4 ; ++ k )
+            s.add ( lanes [ k ] ) ;
+          s.subtract ( block_end - i, 31 ) ;
+          i = block_end ; }
+      scalar_kernels :: inner_product ( a + i, b + i, n - i, s ) ; }
+
+} ;
+
+
+//
+
+template < class T, sint FractionalBits >
+class fixed_point_simd_kernels < T, FractionalBits, 32 >
+
+{
+public:
+
+  typedef signed_fixed_point < T, FractionalBits > fixed_point_type ;
+
+  typedef fixed_point_batch_kernels < T, FractionalBits, 0 > scalar_kernels ;
+
+  static constexpr size_t sse2_lanes = 4 ;
+  static constexpr size_t avx2_lanes = 8 ;
+
+  static constexpr size_t simd_block_size = size_t ( 1 ) << 24 ;
+
+  __sse2_function__
+  static __m128i sse2_load ( const fixed_point_type * p )
+    { return _mm_loadu_si128 ( reinterpret_cast < const __m128i * > ( p ) ) ; }
+
+  __sse2_function__
+  static void sse2_store ( fixed_point_type * p, __m128i x )
+    { _mm_storeu_si128 ( reinterpret_cast < __m128i * > ( p ), x ) ; }
+
+  __sse2_function__
+  static __m128i sse2_multiply ( __m128i x, __m128i y )
+    { __m128i half ( _mm_set1_epi64x
+                       ( int64_t ( 1 ) << ( FractionalBits - 1 ) ) ),
+              low_mask ( _mm_set1_epi64x ( 0xFFFFFFFF ) ),
+              sx ( _mm_srai_epi32 ( x, 31 ) ),
+              sy ( _mm_srai_epi32 ( y, 31 ) ),
+              ax ( _mm_sub_epi32 ( _mm_xor_si128 ( x, sx ), sx ) ),
+              ay ( _mm_sub_epi32 ( _mm_xor_si128 ( y, sy ), sy ) ),
+              r0 ( _mm_srli_epi64
+                     ( _mm_add_epi64 ( _mm_mul_epu32 ( ax, ay ), half ),
+                       FractionalBits ) ),
+              r1 ( _mm_srli_epi64
+                     ( _mm_add_epi64
+                         ( _mm_mul_epu32 ( _mm_srli_epi64 ( ax, 32 ),
+                                           _mm_srli_epi64 ( ay, 32 ) ),
+                           half ),
+                       FractionalBits ) ),
+              r ( _mm_or_si128 ( _mm_and_si128 ( r0, low_mask ),
+                                 _mm_slli_epi64 ( r1, 32 ) ) ),
+              s ( _mm_xor_si128 ( sx, sy ) ) ;
+      return _mm_sub_epi32 ( _mm_xor_si128 ( r, s ), s ) ; }
+
+  __sse2_function__
+  static void sse2_add ( const fixed_point_type * a,
+                         const fixed_point_type * b,
+                         fixed_point_type * result,
+                         size_t n )
+    { size_t i ( 0 ) ;
+      for ( ; i + sse2_lanes <= n ; i += sse2_lanes )
+        sse2_store ( result + i,
+                     _mm_add_epi32 ( sse2_load ( a + i ),
+                                     sse2_load ( b + i ) ) ) ;
+      scalar_kernels :: add ( a + i, b + i, result + i, n - i ) ; }
+
+  __sse2_function__
+  static void sse2_subtract ( const fixed_point_type * a,
+                              const fixed_point_type * b,
+                              fixed_point_type * result,
+                              size_t n )
+    { size_t i ( 0 ) ;
+      for ( ; i + sse2_lanes <= n ; i += sse2_lanes )
+        sse2_store ( result + i,
+                     _mm_sub_epi32 ( sse2_load ( a + i ),
+                                     sse2_load ( b + i ) ) ) ;
+      scalar_kernels :: subtract ( a + i, b + i, result + i, n - i ) ; }
+
+  __sse2_function__
+  static void sse2_multiply ( const fixed_point_type * a,
+                              const fixed_point_type * b,
+                              fixed_point_type * result,
+                              size_t n )
+    { size_t i ( 0 ) ;
+      for ( ; i + sse2_lanes <= n ; i += sse2_lanes )
+        sse2_store ( result + i,
+                     sse2_multiply ( sse2_load ( a + i ),
+                                     sse2_load ( b + i ) ) ) ;
+      scalar_kernels :: multiply ( a + i, b + i, result + i, n - i ) ; }
+
+  __sse2_function__
+  static void sse2_multiply_accumulate ( const fixed_point_type * a,
+                                         const fixed_point_type * b,
+                                         fixed_point_type * result,
+                                         size_t n )
+    { size_t i ( 0 ) ;
+      for ( ; i + sse2_lanes <= n ; i += sse2_lanes )
+        sse2_store ( result + i,
+                     _mm_add_epi32 ( sse2_load ( result + i ),
+                                     sse2_multiply ( sse2_load ( a + i ),
+                                                     sse2_load ( b + i ) ) ) ) ;
+      scalar_kernels :: multiply_accumulate
+                          ( a + i, b + i, result + i, n - i ) ; }
+
+  // SSE2 has only unsigned 32 x 32 bit multiplication; signed products
+  // are obtained by subtracting ( x < 0 ? y : 0 ) + ( y < 0 ? x : 0 )
+  // from their high halves.
+
+  __sse2_function__
+  static void sse2_inner_product ( const fixed_point_type * a,
+                                   const fixed_point_type * b,
+                                   size_t n,
+                                   fixed_point_wide_accumulator & s )
+    { __m128i bias ( _mm_set1_epi64x ( INT64_MIN ) ),
+              low_mask ( _mm_set1_epi64x ( 0xFFFFFFFF ) ),
+              high_mask ( _mm_slli_epi64 ( low_mask, 32 ) ) ;
+      size_t i ( 0 ) ;
+      while ( i + sse2_lanes <= n )
+        { size_t block_end
+            ( i + min ( n - i, simd_block_size ) / sse2_lanes * sse2_lanes ) ;
+          __m128i low_sum ( _mm_setzero_si128 ( ) ),
+                  high_sum ( _mm_setzero_si128 ( ) ) ;
+          for ( size_t j = i ; j < block_end ; j += sse2_lanes )
+            { __m128i x ( sse2_load ( a + j ) ),
+                      y ( sse2_load ( b + j ) ),
+                      c ( _mm_add_epi32
+                            ( _mm_and_si128 ( _mm_srai_epi32 ( x, 31 ), y ),
+                              _mm_and_si128 ( _mm_srai_epi32 ( y, 31 ), x ) ) ),
+                      p0 ( _mm_sub_epi64 ( _mm_mul_epu32 ( x, y ),
+                                           _mm_slli_epi64 ( c, 32 ) ) ),
+                      p1 ( _mm_sub_epi64
+                             ( _mm_mul_epu32 ( _mm_srli_epi64 ( x, 32 ),
+                                               _mm_srli_epi64 ( y, 32 ) ),
+                               _mm_and_si128 ( c, high_mask ) ) ) ;
+              low_sum = _mm_add_epi64 ( low_sum,
+                                        _mm_and_si128 ( p0, low_mask ) ) ;
+              low_sum = _mm_add_epi64 ( low_sum,
+                                        _mm_and_si128 ( p1, low_mask ) ) ;
+              high_sum = _mm_add_epi64
+                           ( high_sum,
+                             _mm_srli_epi64 ( _mm_xor_si128 ( p0, bias ),
+                                              32 ) ) ;
+              high_sum = _mm_add_epi64
+                           ( high_sum,
+                             _mm_srli_epi64 ( _mm_xor_si128 ( p1, bias ),
+                                              32 ) ) ; }
+          uint64_t lanes [ 4 ] = { } ;
+          _mm_storeu_si128 ( reinterpret_cast < __m128i * > ( lanes ),
+                             low_sum ) ;
+          _mm_storeu_si128 ( reinterpret_cast < __m128i * > ( lanes + 2 ),
+                             high_sum ) ;
+          s.add ( lanes [ 0 ] ) ;
+          s.add ( lanes [ 1 ] ) ;
+          s.add ( lanes [ 2 ], 32 ) ;
+          s.add ( lanes [ 3 ], 32 ) ;
+          s.subtract ( block_end - i, 63 ) ;
+          i = block_end ; }
+      scalar_kernels :: inner_product ( a + i, b + i, n - i, s ) ; }
+
+  __avx2_function__
+  static __m256i avx2_load ( const fixed_point_type * p )
+    { return _mm256_loadu_si256
+               ( reinterpret_cast < const __m256i * > ( p ) ) ; }
+
+  __avx2_function__
+  static void avx2_store ( fixed_point_type * p, __m256i x )
+    { _mm256_storeu_si256 ( reinterpret_cast < __m256i * > ( p ), x ) ; }
+
+  __avx2_function__
+  static __m256i avx2_multiply ( __m256i x, __m256i y )
+    { __m256i half ( _mm256_set1_epi64x
+                       ( int64_t ( 1 ) << ( FractionalBits - 1 ) ) ),
+              ax ( _mm256_abs_epi32 ( x ) ),
+              ay ( _mm256_abs_epi32 ( y ) ),
+              r0 ( _mm256_srli_epi64
+                     ( _mm256_add_epi64 ( _mm256_mul_epu32 ( ax, ay ), half ),
+                       FractionalBits ) ),
+              r1 ( _mm256_srli_epi64
+                     ( _mm256_add_epi64
+                         ( _mm256_mul_epu32 ( _mm256_srli_epi64 ( ax, 32 ),
+                                              _mm256_srli_epi64 ( ay, 32 ) ),
+                           half ),
+                       FractionalBits ) ),
+              r ( _mm256_blend_epi32 ( r0, _mm256_slli_epi64 ( r1, 32 ),
+                                       0xAA ) ),
+              s ( _mm256_srai_epi32 ( _mm256_xor_si256 ( x, y ), 31 ) ) ;
+      return _mm256_sub_epi32 ( _mm256_xor_si256 ( r, s ), s ) ; }
+
+  __avx2_function__
+  static void avx2_add ( const fixed_point_type * a,
+                         const fixed_point_type * b,
+                         fixed_point_type * result,
+                         size_t n )
+    { size_t i ( 0 ) ;
+      for ( ; i + avx2_lanes <= n ; i += avx2_lanes )
+        avx2_store ( result + i,
+                     _mm256_add_epi32 ( avx2_load ( a + i ),
+                                        avx2_load ( b + i ) ) ) ;
+      scalar_kernels :: add ( a + i, b + i, result + i, n - i ) ; }
+
+  __avx2_function__
+  static void avx2_subtract ( const fixed_point_type * a,
+                              const fixed_point_type * b,
+                              fixed_point_type * result,
+                              size_t n )
+    { size_t i ( 0 ) ;
+      for ( ; i + avx2_lanes <= n ; i += avx2_lanes )
+        avx2_store ( result + i,
+                     _mm256_sub_epi32 ( avx2_load ( a + i ),
+                                        avx2_load ( b + i ) ) ) ;
+      scalar_kernels :: subtract ( a + i, b + i, result + i, n - i ) ; }
+
+  __avx2_function__
+  static void avx2_multiply ( const fixed_point_type * a,
+                              const fixed_point_type * b,
+                              fixed_point_type * result,
+                              size_t n )
+    { size_t i ( 0 ) ;
+      for ( ; i + avx2_lanes <= n ; i += avx2_lanes )
+        avx2_store ( result + i,
+                     avx2_multiply ( avx2_load ( a + i ),
+                                     avx2_load ( b + i ) ) ) ;
+      scalar_kernels :: multiply ( a + i, b + i, result + i, n - i ) ; }
+
+  __avx2_function__
+  static void avx2_multiply_accumulate ( const fixed_point_type * a,
+                                         const fixed_point_type * b,
+                                         fixed_point_type * result,
+                                         size_t n )
+    { size_t i ( 0 ) ;
+      for ( ; i + avx2_lanes <= n ; i += avx2_lanes )
+        avx2_store ( result + i,
+                     _mm256_add_epi32
+                       ( avx2_load ( result + i ),
+                         avx2_multiply ( avx2_load ( a + i ),
+                                         avx2_load ( b + i ) ) ) ) ;
+      scalar_kernels :: multiply_accumulate
+                          ( a + i, b + i, result + i, n - i ) ; }
+
+  __avx2_function__
+  static void avx2_inner_product ( const fixed_point_type * a,
+                                   const fixed_point_type * b,
+                                   size_t n,
+                                   fixed_point_wide_accumulator & s )
+    { __m256i bias ( _mm256_set1_epi64x ( INT64_MIN ) ),
+              low_mask ( _mm256_set1_epi64x ( 0xFFFFFFFF ) ) ;
+      size_t i ( 0 ) ;
+      while ( i + avx2_lanes <= n )
+        { size_t block_end
+            ( i + min ( n - i, simd_block_size ) / avx2_lanes * avx2_lanes ) ;
+          __m256i low_sum ( _mm256_setzero_si256 ( ) ),
+                  high_sum ( _mm256_setzero_si256 ( ) ) ;
+          for ( size_t j = i ; j < block_end ; j += avx2_lanes )
+            { __m256i x ( avx2_load ( a + j ) ),
+                      y ( avx2_load ( b + j ) ),
+                      p0 ( _mm256_mul_epi32 ( x, y ) ),
+                      p1 ( _mm256_mul_epi32 ( _mm256_srli_epi64 ( x, 32 ),
+                                              _mm256_srli_epi64 ( y, 32 ) ) ) ;
+              low_sum = _mm256_add_epi64
+                          ( low_sum, _mm256_and_si256 ( p0, low_mask ) ) ;
+              low_sum = _mm256_add_epi64
+                          ( low_sum, _mm256_and_si256 ( p1, low_mask ) ) ;
+              high_sum = _mm256_add_epi64
+                           ( high_sum,
+                             _mm256_srli_epi64 ( _mm256_xor_si256 ( p0, bias ),
+                                                 32 ) ) ;
+              high_sum = _mm256_add_epi64
+                           ( high_sum,
+                             _mm256_srli_epi64 ( _mm256_xor_si256 ( p1, bias ),
+                                                 32 ) ) ; }
+          uint64_t lanes [ 8 ] = { } ;
+          _mm256_storeu_si256 ( reinterpret_cast < __m256i * > ( lanes ),
+                                low_sum ) ;
+          _mm256_storeu_si256 ( reinterpret_cast < __m256i * > ( lanes + 4 ),
+                                high_sum ) ;
+          for ( sint k = 0 ; k < 4 ; ++ k )
+            { s.add ( lanes [ k ] ) ;
+              s.add ( lanes [ k + 4 ], 32 ) ; }
+          s.subtract ( block_end - i, 63 ) ;
+          i = block_end ; }
+      scalar_kernels :: inner_product ( a + i, b + i, n - i, s ) ; }
+
+} ;
+
+
+// Chooses the best kernels supported by the processor at run time.
+
+template < class T, sint FractionalBits, sint ElementBitSize >
+class fixed_point_batch_kernels
+
+{
+public:
+
+  typedef signed_fixed_point < T, FractionalBits > fixed_point_type ;
+
+  typedef fixed_point_batch_kernels < T, FractionalBits, 0 > scalar_kernels ;
+
+  typedef fixed_point_simd_kernels < T, FractionalBits, ElementBitSize >
+            simd_kernels ;
+
+  static_assert ( sizeof ( fixed_point_type ) == sizeof ( T ),
+                  "Fixed point values must not be padded." ) ;
+
+  static void add ( const fixed_point_type * a,
+                    const fixed_point_type * b,
+                    fixed_point_type * result,
+                    size_t n )
+    { if ( cpu_has_avx2 ( ) )
+        simd_kernels :: avx2_add ( a, b, result, n ) ;
+      else if ( cpu_has_sse2 ( ) )
+        simd_kernels :: sse2_add ( a, b, result, n ) ;
+      else
+        scalar_kernels :: add ( a, b, result, n ) ; }
+
+  static void subtract ( const fixed_point_type * a,
+                         const fixed_point_type * b,
+                         fixed_point_type * result,
+                         size_t n )
+    { if ( cpu_has_avx2 ( ) )
+        simd_kernels :: avx2_subtract ( a, b, result, n ) ;
+      else if ( cpu_has_sse2 ( ) )
+        simd_kernels :: sse2_subtract ( a, b, result, n ) ;
+      else
+        scalar_kernels :: subtract ( a, b, result, n ) ; }
+
+  static void multiply ( const fixed_point_type * a,
+                         const fixed_point_type * b,
+                         fixed_point_type * result,
+                         size_t n )
+    { if ( cpu_has_avx2 ( ) )
+        simd_kernels :: avx2_multiply ( a, b, result, n ) ;
+      else if ( cpu_has_sse2 ( ) )
+        simd_kernels :: sse2_multiply ( a, b, result, n ) ;
+      else
+        scalar_kernels :: multiply ( a, b, result, n ) ; }
+
+  static void multiply_accumulate ( const fixed_point_type * a,
+                                    const fixed_point_type * b,
+                                    fixed_point_type * result,
+                                    size_t n )
+    { if ( cpu_has_avx2 ( ) )
+        simd_kernels :: avx2_multiply_accumulate ( a, b, result, n ) ;
+      else if ( cpu_has_sse2 ( ) )
+        simd_kernels :: sse2_multiply_accumulate ( a, b, result, n ) ;
+      else
+        scalar_kernels :: multiply_accumulate ( a, b, result, n ) ; }
+
+  static void inner_product ( const fixed_point_type * a,
+                              const fixed_point_type * b,
+                              size_t n,
+                              fixed_point_wide_accumulator & s )
+    { if ( cpu_has_avx2 ( ) )
+        simd_kernels :: avx2_inner_product ( a, b, n, s ) ;
+      else if ( cpu_has_sse2 ( ) )
+        simd_kernels :: sse2_inner_product ( a, b, n, s ) ;
+      else
+        scalar_kernels :: inner_product ( a, b, n, s ) ; }
+
+} ;
+
+
+#endif
+
+
+
+// *** BATCH OPERATIONS ***
+
+
+// Operations on n consecutive elements. Results are identical to those
+// of the corresponding signed_fixed_point operators applied element by
+// element; result may be the same array as a or b.
+
+
+//
+
+template < class T, sint FractionalBits >
+inline void
+  batch_add ( const signed_fixed_point < T, FractionalBits > * a,
+              const signed_fixed_point < T, FractionalBits > * b,
+              signed_fixed_point < T, FractionalBits > * result,
+              size_t n )
+
+{
+fixed_point_batch_kernels < T, FractionalBits > ::
+  add ( a, b, result, n ) ;
+}
+
+
+//
+
+template < class T, sint FractionalBits >
+inline void
+  batch_subtract ( const signed_fixed_point < T, FractionalBits > * a,
+                   const signed_fixed_point < T, FractionalBits > * b,
+                   signed_fixed_point < T, FractionalBits > * result,
+                   size_t n )
+
+{
+fixed_point_batch_kernels < T, FractionalBits > ::
+  subtract ( a, b, result, n ) ;
+}
+
+
+//
+
+template < class T, sint FractionalBits >
+inline void
+  batch_multiply ( const signed_fixed_point < T, FractionalBits > * a,
+                   const signed_fixed_point < T, FractionalBits > * b,
+                   signed_fixed_point < T, FractionalBits > * result,
+                   size_t n )
+
+{
+fixed_point_batch_kernels < T, FractionalBits > ::
+  multiply ( a, b, result, n ) ;
+}
+
+
+// result [ i ] += a [ i ] * b [ i ]
+
+template < class T, sint FractionalBits >
+inline void
+  batch_multiply_accumulate
+    ( const signed_fixed_point < T, FractionalBits > * a,
+      const signed_fixed_point < T, FractionalBits > * b,
+      signed_fixed_point < T, FractionalBits > * result,
+      size_t n )
+
+{
+fixed_point_batch_kernels < T, FractionalBits > ::
+  multiply_accumulate ( a, b, result, n ) ;
+}
+
+
+// Products are summed exactly in a wide accumulator, and the sum is
+// rounded once, like a single multiplication.
+
+template < class T, sint FractionalBits >
+inline signed_fixed_point < T, FractionalBits >
+  batch_inner_product ( const signed_fixed_point < T, FractionalBits > * a,
+                        const signed_fixed_point < T, FractionalBits > * b,
+                        size_t n )
+
+{
+fixed_point_wide_accumulator s ;
+
+fixed_point_batch_kernels < T, FractionalBits > ::
+  inner_product ( a, b, n, s ) ;
+
+return s.rounded < T, FractionalBits > ( ) ;
+}
+
+
+
+#endif
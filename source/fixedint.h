@@ -0,0 +1,1929 @@
+// Copyright Ivan Stanojevic 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+
+
+
+#ifndef __FIXEDINT_H
+
+#define __FIXEDINT_H
+
+
+
+#include "cassert.h"
+#include "ios.h"
+#include "istream.h"
+#include "ostream.h"
+#include "vector.h"
+#include "array.h"
+#include "utility.h"
+
+#include "numbase.h"
+#include "rnd.h"
+#include "typeconv.h"
+
+
+
+// *** FORWARD DECLARATIONS ***
+
+
+//
+
+template < sint N, class Word >
+class fixed_int ;
+
+template < sint N, class Word >
+class fixed_uint ;
+
+
+//
+
+template < sint N, class Word >
+constexpr bool is_negative ( const fixed_int < N, Word > & x ) ;
+
+template < sint N, class Word >
+constexpr bool is_high_bit_set ( const fixed_int < N, Word > & x ) ;
+
+template < sint N, class Word >
+sint hamming_weight ( const fixed_int < N, Word > & x ) ;
+
+template < sint N, class Word >
+constexpr fixed_int < N, Word >
+  signed_shift_right ( const fixed_int < N, Word > & x, sint n ) ;
+
+template < sint N, class Word >
+constexpr fixed_int < N, Word >
+  unsigned_shift_right ( const fixed_int < N, Word > & x, sint n ) ;
+
+template < sint N, class Word >
+constexpr sint exponent ( const fixed_int < N, Word > & x ) ;
+
+template < sint N, class Word >
+fixed_int < N, Word > reverse ( const fixed_int < N, Word > & x ) ;
+
+template < sint N, class Word >
+constexpr void normalize_gcd ( fixed_int < N, Word > & gcd ) ;
+
+template < sint N, class Word >
+constexpr void normalize_gcd_ext ( fixed_int < N, Word > & c,
+                                   fixed_int < N, Word > & d,
+                                   fixed_int < N, Word > & gcd ) ;
+
+template < sint N, class Word >
+constexpr void normalize_fraction ( fixed_int < N, Word > & a,
+                                    fixed_int < N, Word > & b ) ;
+
+
+//
+
+template < sint N, class Word >
+constexpr bool is_negative ( const fixed_uint < N, Word > & x ) ;
+
+template < sint N, class Word >
+constexpr bool is_high_bit_set ( const fixed_uint < N, Word > & x ) ;
+
+template < sint N, class Word >
+sint hamming_weight ( const fixed_uint < N, Word > & x ) ;
+
+template < sint N, class Word >
+constexpr fixed_uint < N, Word >
+  signed_shift_right ( const fixed_uint < N, Word > & x, sint n ) ;
+
+template < sint N, class Word >
+constexpr fixed_uint < N, Word >
+  unsigned_shift_right ( const fixed_uint < N, Word > & x, sint n ) ;
+
+template < sint N, class Word >
+constexpr sint exponent ( const fixed_uint < N, Word > & x ) ;
+
+template < sint N, class Word >
+fixed_uint < N, Word > reverse ( const fixed_uint < N, Word > & x ) ;
+
+
+
+// *** FIXED_INT DIGIT KERNELS ***
+
+
+// returns: number of significant digits of ( x [ n - 1 ], ... , x [ 0 ] )
+
+template < class Digit >
+constexpr sint fixed_int_digits_size ( const Digit * x, sint n )
+
+{
+while ( n > 0  &&  x [ n - 1 ] == 0 )
+  -- n ;
+
+return n ;
+}
+
+
+// pre: rn <= 2 * n
+//
+// post: ( r [ rn - 1 ], ... , r [ 0 ] ) = ( a * b ) mod B ^ rn
+
+template < class Digit >
+constexpr void fixed_int_digits_multiply ( const Digit * a, const Digit * b,
+                                           sint n, Digit * r, sint rn )
+
+{
+for ( sint i = 0 ; i < rn ; ++ i )
+  r [ i ] = 0 ;
+
+for ( sint i = 0 ; i < n  &&  i < rn ; ++ i )
+  if ( a [ i ] != 0 )
+    {
+    Digit c ( 0 ) ;
+    sint j ( 0 ) ;
+
+    for ( j = 0 ; j < n  &&  i + j < rn ; ++ j )
+      {
+      Digit h ( 0 ), l ( 0 ) ;
+      unsigned_double_multiply ( a [ i ], b [ j ], h, l ) ;
+
+      l += c ;
+      if ( l < c )
+        ++ h ;
+
+      r [ i + j ] += l ;
+      if ( r [ i + j ] < l )
+        ++ h ;
+
+      c = h ;
+      }
+
+    if ( i + j < rn )
+      r [ i + j ] = c ;
+    }
+}
+
+
+// pre: n > 0
+//      v [ n - 1 ] >= 1 << ( bit_size ( Digit ) - 1 )
+//      ( u [ m + n ], ... , u [ m ] ) < ( v [ n - 1 ], ... , v [ 0 ] )
+//
+// post: ( q [ m ], ... , q [ 0 ] ) = u / v
+//       ( u [ n - 1 ], ... , u [ 0 ] ) = u % v
+
+template < class Digit >
+constexpr void fixed_int_digits_divmod ( Digit * u, sint m,
+                                         const Digit * v, sint n,
+                                         Digit * q )
+
+{
+for ( sint j = m ; j >= 0 ; -- j )
+  {
+  Digit * uj = u + j ;
+
+  Digit
+    qh (   uj [ n ] == v [ n - 1 ]
+         ? Digit ( -1 )
+         : unsigned_double_divide ( uj [ n ], uj [ n - 1 ], v [ n - 1 ] ) ) ;
+
+  Digit mc ( 0 ), bc ( 0 ) ;
+
+  for ( sint i = 0 ; i < n ; ++ i )
+    {
+    Digit ph ( 0 ), pl ( 0 ) ;
+    unsigned_double_multiply ( qh, v [ i ], ph, pl ) ;
+
+    pl += mc ;
+    if ( pl < mc )
+      ++ ph ;
+    mc = ph ;
+
+    Digit d ( uj [ i ] - pl ) ;
+    Digit nbc ( d > uj [ i ] ? 1 : 0 ) ;
+    uj [ i ] = d - bc ;
+    if ( uj [ i ] > d )
+      ++ nbc ;
+    bc = nbc ;
+    }
+
+  bool negative ( uj [ n ] < mc ) ;
+  uj [ n ] -= mc ;
+  if ( uj [ n ] < bc )
+    negative = true ;
+  uj [ n ] -= bc ;
+
+  while ( negative )
+    {
+    -- qh ;
+
+    Digit c ( 0 ) ;
+
+    for ( sint i = 0 ; i < n ; ++ i )
+      {
+      Digit s ( uj [ i ] + c ) ;
+      c = s < c ? 1 : 0 ;
+      uj [ i ] = s + v [ i ] ;
+      if ( uj [ i ] < s )
+        ++ c ;
+      }
+
+    Digit t ( uj [ n ] + c ) ;
+    if ( t < uj [ n ] )
+      negative = false ;
+    uj [ n ] = t ;
+    }
+
+  q [ j ] = qh ;
+  }
+}
+
+
+
+// *** FIXED_INT ARITHMETIC ***
+
+
+//
+
+template < class FixedInt >
+constexpr void fixed_int_add ( FixedInt & a, const FixedInt & b )
+
+{
+typedef typename FixedInt :: unsigned_digit_type unsigned_digit_type ;
+
+unsigned_digit_type c ( 0 ) ;
+
+for ( sint i = 0 ; i < FixedInt :: digit_number ; ++ i )
+  {
+  unsigned_digit_type s ( a.digits [ i ] + c ) ;
+  c = s < c ? 1 : 0 ;
+  a.digits [ i ] = s + b.digits [ i ] ;
+  if ( a.digits [ i ] < s )
+    ++ c ;
+  }
+}
+
+
+//
+
+template < class FixedInt >
+constexpr void fixed_int_subtract ( FixedInt & a, const FixedInt & b )
+
+{
+typedef typename FixedInt :: unsigned_digit_type unsigned_digit_type ;
+
+unsigned_digit_type c ( 0 ) ;
+
+for ( sint i = 0 ; i < FixedInt :: digit_number ; ++ i )
+  {
+  unsigned_digit_type d ( a.digits [ i ] - c ) ;
+  c = d > a.digits [ i ] ? 1 : 0 ;
+  a.digits [ i ] = d - b.digits [ i ] ;
+  if ( a.digits [ i ] > d )
+    ++ c ;
+  }
+}
+
+
+//
+
+template < class FixedInt >
+constexpr void fixed_int_increment ( FixedInt & x )
+
+{
+for ( sint i = 0 ; i < FixedInt :: digit_number ; ++ i )
+  if ( ++ x.digits [ i ] != 0 )
+    break ;
+}
+
+
+//
+
+template < class FixedInt >
+constexpr void fixed_int_decrement ( FixedInt & x )
+
+{
+typedef typename FixedInt :: unsigned_digit_type unsigned_digit_type ;
+
+for ( sint i = 0 ; i < FixedInt :: digit_number ; ++ i )
+  if ( x.digits [ i ] -- != unsigned_digit_type ( 0 ) )
+    break ;
+}
+
+
+//
+
+template < class FixedInt >
+constexpr FixedInt fixed_int_multiply ( const FixedInt & a, const FixedInt & b )
+
+{
+FixedInt result ( typename FixedInt :: unsigned_digit_type ( 0 ) ) ;
+
+fixed_int_digits_multiply ( a.digits.data ( ), b.digits.data ( ),
+                            FixedInt :: digit_number,
+                            result.digits.data ( ),
+                            FixedInt :: digit_number ) ;
+
+return result ;
+}
+
+
+//
+
+template < class FixedInt >
+constexpr bool fixed_int_unsigned_less ( const FixedInt & a,
+                                         const FixedInt & b,
+                                         sint n )
+
+{
+for ( sint i = n - 1 ; i >= 0 ; -- i )
+  if ( a.digits [ i ] != b.digits [ i ] )
+    return a.digits [ i ] < b.digits [ i ] ;
+
+return false ;
+}
+
+
+
+// *** FIXED_INT SHIFTS ***
+
+
+//
+
+template < class FixedInt >
+constexpr FixedInt fixed_int_shift_left ( const FixedInt & x, sint n )
+
+{
+assert (    n >= 0
+         &&  n < FixedInt :: digit_number * FixedInt :: digit_bit_size ) ;
+
+const sint digit_shift = n / FixedInt :: digit_bit_size,
+           bit_shift = n % FixedInt :: digit_bit_size ;
+
+FixedInt result ( typename FixedInt :: unsigned_digit_type ( 0 ) ) ;
+
+for ( sint i = FixedInt :: digit_number - 1 ; i >= digit_shift ; -- i )
+  {
+  result.digits [ i ] = x.digits [ i - digit_shift ] << bit_shift ;
+  if ( bit_shift != 0  &&  i > digit_shift )
+    result.digits [ i ] |=    x.digits [ i - digit_shift - 1 ]
+                           >> ( FixedInt :: digit_bit_size - bit_shift ) ;
+  }
+
+for ( sint i = 0 ; i < digit_shift ; ++ i )
+  result.digits [ i ] = 0 ;
+
+return result ;
+}
+
+
+//
+
+template < class FixedInt >
+constexpr FixedInt
+  fixed_int_shift_right ( const FixedInt & x,
+                          sint n,
+                          typename FixedInt :: unsigned_digit_type prefix )
+
+{
+assert (    n >= 0
+         &&  n < FixedInt :: digit_number * FixedInt :: digit_bit_size ) ;
+
+const sint digit_shift = n / FixedInt :: digit_bit_size,
+           bit_shift = n % FixedInt :: digit_bit_size ;
+
+FixedInt result ( typename FixedInt :: unsigned_digit_type ( 0 ) ) ;
+
+for ( sint i = 0 ; i < FixedInt :: digit_number ; ++ i )
+  {
+  sint j = i + digit_shift ;
+
+  typename FixedInt :: unsigned_digit_type
+    low ( j < FixedInt :: digit_number ? x.digits [ j ] : prefix ) ;
+
+  if ( bit_shift == 0 )
+    result.digits [ i ] = low ;
+  else
+    result.digits [ i ] =   (    j + 1 < FixedInt :: digit_number
+                               ? x.digits [ j + 1 ]
+                               : prefix )
+                            << ( FixedInt :: digit_bit_size - bit_shift )
+                          | low >> bit_shift ;
+  }
+
+return result ;
+}
+
+
+//
+
+template < class FixedInt >
+constexpr FixedInt fixed_int_signed_shift_right ( const FixedInt & x, sint n )
+
+{
+return fixed_int_shift_right ( x, n, x.is_high_bit_set ( ) ? -1 : 0 ) ;
+}
+
+
+//
+
+template < class FixedInt >
+constexpr FixedInt fixed_int_unsigned_shift_right ( const FixedInt & x, sint n )
+
+{
+return fixed_int_shift_right ( x, n, 0 ) ;
+}
+
+
+
+// *** FIXED_INT_POSITIVE_DIVMOD ***
+
+
+// pre: a >= 0
+//      b > 0
+//
+// post: q = a / b
+//       r = a % b
+
+template < class FixedInt >
+constexpr void fixed_int_positive_divmod ( FixedInt a, FixedInt b,
+                                           FixedInt & q, FixedInt & r )
+
+{
+typedef typename FixedInt :: unsigned_digit_type unsigned_digit_type ;
+
+const sint digit_number = FixedInt :: digit_number ;
+
+sint an = fixed_int_digits_size ( a.digits.data ( ), digit_number ),
+     bn = fixed_int_digits_size ( b.digits.data ( ), digit_number ) ;
+
+assert ( bn > 0 ) ;
+
+if ( an < bn )
+  {
+  q = 0 ;
+  r = a ;
+  return ;
+  }
+
+sint bit_shift = FixedInt :: digit_bit_size - exponent ( b.digits [ bn - 1 ] ) ;
+
+array < unsigned_digit_type, digit_number + 1 > u = { } ;
+
+{
+FixedInt as ( fixed_int_shift_left ( a, bit_shift ) ) ;
+
+for ( sint i = 0 ; i < digit_number ; ++ i )
+  u [ i ] = as.digits [ i ] ;
+
+u [ digit_number ] =   bit_shift == 0
+                     ? 0
+                     :    a.digits [ digit_number - 1 ]
+                       >> ( FixedInt :: digit_bit_size - bit_shift ) ;
+}
+
+b = fixed_int_shift_left ( b, bit_shift ) ;
+
+q = 0 ;
+
+fixed_int_digits_divmod ( u.data ( ), an - bn,
+                          b.digits.data ( ), bn,
+                          q.digits.data ( ) ) ;
+
+r = 0 ;
+
+for ( sint i = 0 ; i < bn ; ++ i )
+  r.digits [ i ] = u [ i ] ;
+
+r = fixed_int_unsigned_shift_right ( r, bit_shift ) ;
+}
+
+
+
+// *** FIXED_INT FLOATING POINT ***
+
+
+//
+
+template < class FloatingPoint, class FixedInt >
+inline FloatingPoint fixed_int_positive_to_floating_point ( const FixedInt & x )
+
+{
+FloatingPoint result ( 0 ) ;
+
+for ( sint i = FixedInt :: digit_number - 1 ; i >= 0 ; -- i )
+  result =   ldexp ( result, FixedInt :: digit_bit_size )
+           + convert_to < FloatingPoint > ( x.digits [ i ] ) ;
+
+return result ;
+}
+
+
+//
+
+template < class FixedInt, class FloatingPoint >
+inline FixedInt fixed_int_from_positive_floating_point ( FloatingPoint x )
+
+{
+FixedInt result ;
+
+for ( sint i = FixedInt :: digit_number - 1 ; i >= 0 ; -- i )
+  {
+  FloatingPoint d ( trunc ( ldexp ( x, - FixedInt :: digit_bit_size * i ) ) ) ;
+  result.digits [ i ] =
+    convert_to < typename FixedInt :: unsigned_digit_type > ( d ) ;
+  x -= ldexp ( d, FixedInt :: digit_bit_size * i ) ;
+  }
+
+return result ;
+}
+
+
+
+// *** FIXED_INT STREAMING ***
+
+
+//
+
+template < class CharT, class CharTraits, class FixedInt >
+basic_ostream < CharT, CharTraits > &
+  output_fixed_int ( basic_ostream < CharT, CharTraits > & o, FixedInt x )
+
+{
+bool negative = is_negative ( x ) ;
+
+if ( negative )
+  x = - x ;
+
+vector < CharT > text ;
+
+do
+  {
+  FixedInt d ;
+  fixed_int_positive_divmod ( x, FixedInt ( 10 ), x, d ) ;
+  text.push_back ( convert_to < CharT > ( d ) + CharT ( '0' ) ) ;
+  }
+while ( x != 0 ) ;
+
+if ( negative )
+  text.push_back ( CharT ( '-' ) ) ;
+
+reverse ( text.begin ( ), text.end ( ) ) ;
+
+return o.write ( text.data ( ), text.size ( ) ) ;
+}
+
+
+//
+
+template < class CharT, class CharTraits, class FixedInt >
+basic_istream < CharT, CharTraits > &
+  input_fixed_int ( basic_istream < CharT, CharTraits > & i, FixedInt & x )
+
+{
+ios_base :: fmtflags start_flags = i.flags ( ) ;
+i.setf ( ios_base :: skipws ) ;
+
+FixedInt y ( 0 ) ;
+
+bool negative ;
+CharT c ;
+
+i >> c ;
+if ( ! i.good ( ) )
+  goto error_end ;
+
+i.unsetf ( ios_base :: skipws ) ;
+
+if ( c == CharT ( '-' ) )
+  {
+  negative = true ;
+  i >> c ;
+  if ( ! i.good ( ) )
+    goto error_end ;
+  }
+else
+  negative = false ;
+
+if ( c < CharT ( '0' )  ||  c > CharT ( '9' ) )
+  {
+  i.putback ( c ) ;
+  i.setstate ( ios_base :: failbit ) ;
+  goto error_end ;
+  }
+
+do
+  {
+  y = y * 10 + ( c - CharT ( '0' ) ) ;
+
+  i >> c ;
+  if ( i.eof ( ) )
+    goto ok_end ;
+  if ( ! i.good ( ) )
+    goto error_end ;
+  }
+while ( c >= CharT ( '0' )  &&  c <= CharT ( '9' ) ) ;
+i.putback ( c ) ;
+
+ok_end:
+
+if ( negative )
+  x = - y ;
+else
+  x = y ;
+
+error_end:
+
+i.flags ( start_flags ) ;
+return i ;
+}
+
+
+
+// *** FIXED_INT_UNSIGNED_DOUBLE_MULTIPLIER ***
+
+
+template < class FixedInt >
+class fixed_int_unsigned_double_multiplier
+
+{
+public:
+
+  static constexpr void operate ( const FixedInt & a, const FixedInt & b,
+                                  FixedInt & h, FixedInt & l ) ;
+
+} ;
+
+
+//
+
+template < class FixedInt >
+constexpr void fixed_int_unsigned_double_multiplier < FixedInt > ::
+                 operate ( const FixedInt & a, const FixedInt & b,
+                           FixedInt & h, FixedInt & l )
+
+{
+const sint digit_number = FixedInt :: digit_number ;
+
+array < typename FixedInt :: unsigned_digit_type, 2 * digit_number > r = { } ;
+
+fixed_int_digits_multiply ( a.digits.data ( ), b.digits.data ( ),
+                            digit_number,
+                            r.data ( ), 2 * digit_number ) ;
+
+for ( sint i = 0 ; i < digit_number ; ++ i )
+  {
+  l.digits [ i ] = r [ i ] ;
+  h.digits [ i ] = r [ i + digit_number ] ;
+  }
+}
+
+
+
+// *** FIXED_INT_UNSIGNED_DOUBLE_DIVIDER ***
+
+
+template < class FixedInt >
+class fixed_int_unsigned_double_divider
+
+{
+public:
+
+  static constexpr FixedInt operate ( const FixedInt & h,
+                                      const FixedInt & l,
+                                      const FixedInt & b ) ;
+
+} ;
+
+
+//
+
+template < class FixedInt >
+constexpr FixedInt fixed_int_unsigned_double_divider < FixedInt > ::
+                     operate ( const FixedInt & h,
+                               const FixedInt & l,
+                               const FixedInt & b )
+
+{
+const sint digit_number = FixedInt :: digit_number ;
+
+array < typename FixedInt :: unsigned_digit_type, 2 * digit_number + 1 > u =
+  { } ;
+array < typename FixedInt :: unsigned_digit_type, digit_number + 1 > q = { } ;
+
+for ( sint i = 0 ; i < digit_number ; ++ i )
+  {
+  u [ i ] = l.digits [ i ] ;
+  u [ i + digit_number ] = h.digits [ i ] ;
+  }
+
+u [ 2 * digit_number ] = 0 ;
+
+fixed_int_digits_divmod ( u.data ( ), digit_number,
+                          b.digits.data ( ), digit_number,
+                          q.data ( ) ) ;
+
+FixedInt result ( typename FixedInt :: unsigned_digit_type ( 0 ) ) ;
+
+for ( sint i = 0 ; i < digit_number ; ++ i )
+  result.digits [ i ] = q [ i ] ;
+
+return result ;
+}
+
+
+
+// *** FIXED_INT_RND_STATIC_GENERATOR ***
+
+
+template < class FixedInt >
+class fixed_int_rnd_static_generator
+
+{
+public:
+
+  static FixedInt operate ( )
+    { FixedInt result ;
+      for ( auto & d : result.digits )
+        d = rnd < typename FixedInt :: unsigned_digit_type > ( ) ;
+      return result ; }
+
+} ;
+
+
+
+// *** FIXED_INT ***
+
+
+template < sint N, class Word = uint >
+class fixed_int
+
+{
+public:
+
+  typedef typename numeric_traits < Word > :: signed_type signed_digit_type ;
+  typedef typename numeric_traits < Word > :: unsigned_type
+            unsigned_digit_type ;
+
+  static constexpr sint digit_number = N ;
+
+  static constexpr sint
+    digit_bit_size = numeric_traits < unsigned_digit_type > :: bit_size ;
+
+private:
+
+  static_assert ( digit_number > 0, "Illegal digit number." ) ;
+
+  constexpr sint positive_exponent ( ) const
+    { sint n = fixed_int_digits_size ( digits.data ( ), N ) ;
+      return   n == 0
+             ? 0
+             : :: exponent ( digits [ n - 1 ] ) + ( n - 1 ) * digit_bit_size ; }
+
+public:
+
+  array < unsigned_digit_type, N > digits ;
+
+  fixed_int ( )
+    { }
+
+  explicit constexpr
+    fixed_int ( const array < unsigned_digit_type, N > & i_digits ) :
+    digits ( i_digits )
+    { }
+
+  constexpr fixed_int ( const signed_digit_type & x ) :
+    digits ( )
+    { for ( sint i = 1 ; i < N ; ++ i )
+        digits [ i ] = x >= 0 ? 0 : -1 ;
+      digits [ 0 ] = x ; }
+
+  constexpr fixed_int ( const unsigned_digit_type & x ) :
+    digits ( )
+    { digits [ 0 ] = x ; }
+
+  template < class S >
+  constexpr fixed_int ( const S & x,
+                        typename implicit_conversion_test
+                                   < S, unsigned_digit_type > :: result =
+                          implicit_conversion_allowed ) :
+    digits ( )
+    { if ( numeric_traits < S > :: is_signed  &&  is_negative ( x ) )
+        for ( sint i = 1 ; i < N ; ++ i )
+          digits [ i ] = -1 ;
+      digits [ 0 ] = x ; }
+
+  static constexpr fixed_int min ( )
+    { fixed_int result ( 0 ) ;
+      result.digits [ N - 1 ] =
+        numeric_traits < signed_digit_type > :: min ( ) ;
+      return result ; }
+
+  static constexpr fixed_int max ( )
+    { fixed_int result ( -1 ) ;
+      result.digits [ N - 1 ] =
+        numeric_traits < signed_digit_type > :: max ( ) ;
+      return result ; }
+
+  constexpr bool is_high_bit_set ( ) const
+    { return :: is_high_bit_set ( digits [ N - 1 ] ) ; }
+
+  constexpr sint exponent ( ) const
+    { return   is_high_bit_set ( )
+             ? ( - * this ).positive_exponent ( )
+             : positive_exponent ( ) ; }
+
+  template < class FloatingPoint >
+  FloatingPoint to_floating_point ( ) const
+    { return   is_high_bit_set ( )
+             ? - fixed_int_positive_to_floating_point < FloatingPoint >
+                   ( - * this )
+             : fixed_int_positive_to_floating_point < FloatingPoint >
+                 ( * this ) ; }
+
+  template < class FloatingPoint >
+  static fixed_int from_floating_point ( const FloatingPoint & x )
+    { return   is_negative ( x )
+             ? - fixed_int_from_positive_floating_point < fixed_int > ( - x )
+             : fixed_int_from_positive_floating_point < fixed_int > ( x ) ; }
+
+  constexpr const fixed_int & operator + ( ) const
+    { return * this ; }
+
+  constexpr fixed_int operator - ( ) const
+    { fixed_int result ( ~ * this ) ;
+      fixed_int_increment ( result ) ;
+      return result ; }
+
+  friend constexpr fixed_int
+    operator + ( const fixed_int & a, const fixed_int & b )
+    { fixed_int result ( a ) ;
+      fixed_int_add ( result, b ) ;
+      return result ; }
+
+  friend constexpr fixed_int
+    operator - ( const fixed_int & a, const fixed_int & b )
+    { fixed_int result ( a ) ;
+      fixed_int_subtract ( result, b ) ;
+      return result ; }
+
+  friend constexpr fixed_int
+    operator * ( const fixed_int & a, const fixed_int & b )
+    { return fixed_int_multiply ( a, b ) ; }
+
+  friend constexpr void
+    divmod ( fixed_int a, fixed_int b, fixed_int & q, fixed_int & r )
+    { if ( is_negative ( a ) )
+        if ( is_negative ( b ) )
+          {
+          fixed_int_positive_divmod ( - a, - b, q, r ) ;
+          r = - r ;
+          }
+        else
+          {
+          fixed_int_positive_divmod ( - a, b, q, r ) ;
+          q = - q ;
+          r = - r ;
+          }
+      else
+        if ( is_negative ( b ) )
+          {
+          fixed_int_positive_divmod ( a, - b, q, r ) ;
+          q = - q ;
+          }
+        else
+          fixed_int_positive_divmod ( a, b, q, r ) ; }
+
+  friend constexpr fixed_int
+    operator / ( const fixed_int & a, const fixed_int & b )
+    { fixed_int q ( 0 ), r ( 0 ) ;
+      divmod ( a, b, q, r ) ;
+      return q ; }
+
+  friend constexpr fixed_int
+    operator % ( const fixed_int & a, const fixed_int & b )
+    { fixed_int q ( 0 ), r ( 0 ) ;
+      divmod ( a, b, q, r ) ;
+      return r ; }
+
+  constexpr fixed_int & operator += ( const fixed_int & b )
+    { fixed_int_add ( * this, b ) ;
+      return * this ; }
+
+  constexpr fixed_int & operator -= ( const fixed_int & b )
+    { fixed_int_subtract ( * this, b ) ;
+      return * this ; }
+
+  constexpr fixed_int & operator *= ( const fixed_int & b )
+    { return * this = * this * b ; }
+
+  constexpr fixed_int & operator /= ( const fixed_int & b )
+    { return * this = * this / b ; }
+
+  constexpr fixed_int & operator %= ( const fixed_int & b )
+    { return * this = * this % b ; }
+
+  constexpr fixed_int & operator ++ ( )
+    { fixed_int_increment ( * this ) ;
+      return * this ; }
+
+  constexpr fixed_int operator ++ ( int )
+    { fixed_int t ( * this ) ;
+      ++ * this ;
+      return t ; }
+
+  constexpr fixed_int & operator -- ( )
+    { fixed_int_decrement ( * this ) ;
+      return * this ; }
+
+  constexpr fixed_int operator -- ( int )
+    { fixed_int t ( * this ) ;
+      -- * this ;
+      return t ; }
+
+  constexpr fixed_int operator ~ ( ) const
+    { fixed_int result ( 0 ) ;
+      for ( sint i = 0 ; i < N ; ++ i )
+        result.digits [ i ] = ~ digits [ i ] ;
+      return result ; }
+
+  friend constexpr fixed_int
+    operator & ( const fixed_int & a, const fixed_int & b )
+    { fixed_int result ( a ) ;
+      return result &= b ; }
+
+  friend constexpr fixed_int
+    operator | ( const fixed_int & a, const fixed_int & b )
+    { fixed_int result ( a ) ;
+      return result |= b ; }
+
+  friend constexpr fixed_int
+    operator ^ ( const fixed_int & a, const fixed_int & b )
+    { fixed_int result ( a ) ;
+      return result ^= b ; }
+
+  constexpr fixed_int & operator &= ( const fixed_int & b )
+    { for ( sint i = 0 ; i < N ; ++ i )
+        digits [ i ] &= b.digits [ i ] ;
+      return * this ; }
+
+  constexpr fixed_int & operator |= ( const fixed_int & b )
+    { for ( sint i = 0 ; i < N ; ++ i )
+        digits [ i ] |= b.digits [ i ] ;
+      return * this ; }
+
+  constexpr fixed_int & operator ^= ( const fixed_int & b )
+    { for ( sint i = 0 ; i < N ; ++ i )
+        digits [ i ] ^= b.digits [ i ] ;
+      return * this ; }
+
+  constexpr fixed_int operator << ( sint n ) const
+    { return fixed_int_shift_left ( * this, n ) ; }
+
+  constexpr fixed_int operator >> ( sint n ) const
+    { return fixed_int_signed_shift_right ( * this, n ) ; }
+
+  constexpr fixed_int & operator <<= ( sint n )
+    { return * this = * this << n ; }
+
+  constexpr fixed_int & operator >>= ( sint n )
+    { return * this = * this >> n ; }
+
+  friend constexpr bool operator == ( const fixed_int & a, const fixed_int & b )
+    { for ( sint i = 0 ; i < N ; ++ i )
+        if ( a.digits [ i ] != b.digits [ i ] )
+          return false ;
+      return true ; }
+
+  friend constexpr bool operator < ( const fixed_int & a, const fixed_int & b )
+    { return   a.digits [ N - 1 ] != b.digits [ N - 1 ]
+             ?    convert_to < signed_digit_type > ( a.digits [ N - 1 ] )
+                < convert_to < signed_digit_type > ( b.digits [ N - 1 ] )
+             : fixed_int_unsigned_less ( a, b, N - 1 ) ; }
+
+  template < class CharT, class CharTraits >
+  friend basic_ostream < CharT, CharTraits > &
+    operator << ( basic_ostream < CharT, CharTraits > & o,
+                  const fixed_int & x )
+    { return output_fixed_int ( o, x ) ; }
+
+  template < class CharT, class CharTraits >
+  friend basic_istream < CharT, CharTraits > &
+    operator >> ( basic_istream < CharT, CharTraits > & i,
+                  fixed_int & x )
+    { return input_fixed_int ( i, x ) ; }
+
+} ;
+
+
+
+// *** FIXED_INT NUMERIC_TRAITS ***
+
+
+template < sint N, class Word >
+class numeric_traits < fixed_int < N, Word > >
+
+{
+public:
+
+  static constexpr bool is_floating_point = false ;
+
+  static constexpr bool is_signed = true ;
+
+  typedef fixed_int < N, Word > signed_type ;
+  typedef fixed_uint < N, Word > unsigned_type ;
+
+  static constexpr sint bit_size = numeric_traits < Word > :: bit_size * N ;
+
+  static constexpr bool has_double_size_type = false ;
+  typedef void double_size_type ;
+
+  static constexpr fixed_int < N, Word > min ( )
+    { return fixed_int < N, Word > :: min ( ) ; }
+
+  static constexpr fixed_int < N, Word > max ( )
+    { return fixed_int < N, Word > :: max ( ) ; }
+
+} ;
+
+
+
+// *** FIXED_INT UNSIGNED_DOUBLE_MULTIPLIER ***
+
+
+template < sint N, class Word >
+class unsigned_double_multiplier < fixed_int < N, Word >, false > :
+  public fixed_int_unsigned_double_multiplier < fixed_int < N, Word > >
+
+{
+} ;
+
+
+
+// *** FIXED_INT UNSIGNED_DOUBLE_DIVIDER ***
+
+
+template < sint N, class Word >
+class unsigned_double_divider < fixed_int < N, Word >, false > :
+  public fixed_int_unsigned_double_divider < fixed_int < N, Word > >
+
+{
+} ;
+
+
+
+// *** FIXED_INT RND_STATIC_GENERATOR ***
+
+
+template < sint N, class Word >
+class rnd_static_generator < fixed_int < N, Word > > :
+  public fixed_int_rnd_static_generator < fixed_int < N, Word > >
+
+{
+} ;
+
+
+
+// *** FIXED_INT RANGE_RND_STATIC_GENERATOR ***
+
+
+template < sint N, class Word >
+class range_rnd_static_generator < fixed_int < N, Word > > :
+  public signed_int_range_rnd_static_generator < fixed_int < N, Word > >
+
+{
+} ;
+
+
+
+// *** FIXED_INT GLOBAL INTERFACES ***
+
+
+//
+
+template < sint N, class Word >
+constexpr bool is_negative ( const fixed_int < N, Word > & x )
+
+{
+return x.is_high_bit_set ( ) ;
+}
+
+
+//
+
+template < sint N, class Word >
+constexpr bool is_high_bit_set ( const fixed_int < N, Word > & x )
+
+{
+return x.is_high_bit_set ( ) ;
+}
+
+
+//
+
+template < sint N, class Word >
+inline sint hamming_weight ( const fixed_int < N, Word > & x )
+
+{
+sint result ( 0 ) ;
+
+for ( const auto & d : x.digits )
+  result += hamming_weight ( d ) ;
+
+return result ;
+}
+
+
+//
+
+template < sint N, class Word >
+constexpr fixed_int < N, Word >
+         signed_shift_right ( const fixed_int < N, Word > & x, sint n )
+
+{
+return fixed_int_signed_shift_right ( x, n ) ;
+}
+
+
+//
+
+template < sint N, class Word >
+constexpr fixed_int < N, Word >
+         unsigned_shift_right ( const fixed_int < N, Word > & x, sint n )
+
+{
+return fixed_int_unsigned_shift_right ( x, n ) ;
+}
+
+
+//
+
+template < sint N, class Word >
+constexpr sint exponent ( const fixed_int < N, Word > & x )
+
+{
+return x.exponent ( ) ;
+}
+
+
+//
+
+template < sint N, class Word >
+inline fixed_int < N, Word > reverse ( const fixed_int < N, Word > & x )
+
+{
+fixed_int < N, Word > result ;
+
+for ( sint i = 0 ; i < N ; ++ i )
+  result.digits [ i ] = reverse ( x.digits [ N - 1 - i ] ) ;
+
+return result ;
+}
+
+
+//
+
+template < sint N, class Word >
+constexpr void normalize_gcd ( fixed_int < N, Word > & gcd )
+
+{
+if ( is_negative ( gcd ) )
+  gcd = - gcd ;
+}
+
+
+//
+
+template < sint N, class Word >
+constexpr void normalize_gcd_ext ( fixed_int < N, Word > & c,
+                                   fixed_int < N, Word > & d,
+                                   fixed_int < N, Word > & gcd )
+
+{
+if ( is_negative ( gcd ) )
+  {
+  c = - c ;
+  d = - d ;
+  gcd = - gcd ;
+  }
+}
+
+
+//
+
+template < sint N, class Word >
+constexpr void normalize_fraction ( fixed_int < N, Word > & a,
+                                    fixed_int < N, Word > & b )
+
+{
+if ( is_negative ( b ) )
+  {
+  a = - a ;
+  b = - b ;
+  }
+}
+
+
+
+// *** FIXED_INT IMPLICIT CONVERSION ***
+
+
+//
+
+template < sint N, class Word >
+class implicit_conversion_test
+        < typename fixed_int < N, Word > :: signed_digit_type,
+          fixed_int < N, Word > > :
+  public implicit_conversion_test_ok
+
+{
+} ;
+
+
+//
+
+template < sint N, class Word >
+class implicit_conversion_test
+        < typename fixed_int < N, Word > :: unsigned_digit_type,
+          fixed_int < N, Word > > :
+  public implicit_conversion_test_ok
+
+{
+} ;
+
+
+//
+
+template < class S, sint N, class Word >
+class implicit_conversion_test < S, fixed_int < N, Word > > :
+  public implicit_conversion_test
+           < S, typename fixed_int < N, Word > :: unsigned_digit_type >
+
+{
+} ;
+
+
+
+// *** FIXED_UINT ***
+
+
+template < sint N, class Word = uint >
+class fixed_uint
+
+{
+public:
+
+  typedef typename numeric_traits < Word > :: signed_type signed_digit_type ;
+  typedef typename numeric_traits < Word > :: unsigned_type
+            unsigned_digit_type ;
+
+  static constexpr sint digit_number = N ;
+
+  static constexpr sint
+    digit_bit_size = numeric_traits < unsigned_digit_type > :: bit_size ;
+
+private:
+
+  static_assert ( digit_number > 0, "Illegal digit number." ) ;
+
+public:
+
+  array < unsigned_digit_type, N > digits ;
+
+  fixed_uint ( )
+    { }
+
+  explicit constexpr
+    fixed_uint ( const array < unsigned_digit_type, N > & i_digits ) :
+    digits ( i_digits )
+    { }
+
+  constexpr fixed_uint ( const signed_digit_type & x ) :
+    digits ( )
+    { for ( sint i = 1 ; i < N ; ++ i )
+        digits [ i ] = x >= 0 ? 0 : -1 ;
+      digits [ 0 ] = x ; }
+
+  constexpr fixed_uint ( const unsigned_digit_type & x ) :
+    digits ( )
+    { digits [ 0 ] = x ; }
+
+  constexpr fixed_uint ( const fixed_int < N, Word > & x ) :
+    digits ( x.digits )
+    { }
+
+  template < class S >
+  constexpr fixed_uint ( const S & x,
+                         typename implicit_conversion_test
+                                    < S, unsigned_digit_type > :: result =
+                           implicit_conversion_allowed ) :
+    digits ( )
+    { if ( numeric_traits < S > :: is_signed  &&  is_negative ( x ) )
+        for ( sint i = 1 ; i < N ; ++ i )
+          digits [ i ] = -1 ;
+      digits [ 0 ] = x ; }
+
+  static constexpr fixed_uint min ( )
+    { return 0 ; }
+
+  static constexpr fixed_uint max ( )
+    { return fixed_uint ( -1 ) ; }
+
+  constexpr bool is_high_bit_set ( ) const
+    { return :: is_high_bit_set ( digits [ N - 1 ] ) ; }
+
+  constexpr sint exponent ( ) const
+    { sint n = fixed_int_digits_size ( digits.data ( ), N ) ;
+      return   n == 0
+             ? 0
+             : :: exponent ( digits [ n - 1 ] ) + ( n - 1 ) * digit_bit_size ; }
+
+  template < class FloatingPoint >
+  FloatingPoint to_floating_point ( ) const
+    { return fixed_int_positive_to_floating_point < FloatingPoint >
+               ( * this ) ; }
+
+  template < class FloatingPoint >
+  static fixed_uint from_floating_point ( const FloatingPoint & x )
+    { return   is_negative ( x )
+             ? - fixed_int_from_positive_floating_point < fixed_uint > ( - x )
+             : fixed_int_from_positive_floating_point < fixed_uint > ( x ) ; }
+
+  constexpr const fixed_uint & operator + ( ) const
+    { return * this ; }
+
+  constexpr fixed_uint operator - ( ) const
+    { fixed_uint result ( ~ * this ) ;
+      fixed_int_increment ( result ) ;
+      return result ; }
+
+  friend constexpr fixed_uint
+    operator + ( const fixed_uint & a, const fixed_uint & b )
+    { fixed_uint result ( a ) ;
+      fixed_int_add ( result, b ) ;
+      return result ; }
+
+  friend constexpr fixed_uint
+    operator - ( const fixed_uint & a, const fixed_uint & b )
+    { fixed_uint result ( a ) ;
+      fixed_int_subtract ( result, b ) ;
+      return result ; }
+
+  friend constexpr fixed_uint
+    operator * ( const fixed_uint & a, const fixed_uint & b )
+    { return fixed_int_multiply ( a, b ) ; }
+
+  friend constexpr void divmod ( fixed_uint a, fixed_uint b,
+                                 fixed_uint & q, fixed_uint & r )
+    { fixed_int_positive_divmod ( a, b, q, r ) ; }
+
+  friend constexpr fixed_uint
+    operator / ( const fixed_uint & a, const fixed_uint & b )
+    { fixed_uint q ( 0 ), r ( 0 ) ;
+      divmod ( a, b, q, r ) ;
+      return q ; }
+
+  friend constexpr fixed_uint
+    operator % ( const fixed_uint & a, const fixed_uint & b )
+    { fixed_uint q ( 0 ), r ( 0 ) ;
+      divmod ( a, b, q, r ) ;
+      return r ; }
+
+  constexpr fixed_uint & operator += ( const fixed_uint & b )
+    { fixed_int_add ( * this, b ) ;
+      return * this ; }
+
+  constexpr fixed_uint & operator -= ( const fixed_uint & b )
+    { fixed_int_subtract ( * this, b ) ;
+      return * this ; }
+
+  constexpr fixed_uint & operator *= ( const fixed_uint & b )
+    { return * this = * this * b ; }
+
+  constexpr fixed_uint & operator /= ( const fixed_uint & b )
+    { return * this = * this / b ; }
+
+  constexpr fixed_uint & operator %= ( const fixed_uint & b )
+    { return * this = * this % b ; }
+
+  constexpr fixed_uint & operator ++ ( )
+    { fixed_int_increment ( * this ) ;
+      return * this ; }
+
+  constexpr fixed_uint operator ++ ( int )
+    { fixed_uint t ( * this ) ;
+      ++ * this ;
+      return t ; }
+
+  constexpr fixed_uint & operator -- ( )
+    { fixed_int_decrement ( * this ) ;
+      return * this ; }
+
+  constexpr fixed_uint operator -- ( int )
+    { fixed_uint t ( * this ) ;
+      -- * this ;
+      return t ; }
+
+  constexpr fixed_uint operator ~ ( ) const
+    { fixed_uint result ( 0 ) ;
+      for ( sint i = 0 ; i < N ; ++ i )
+        result.digits [ i ] = ~ digits [ i ] ;
+      return result ; }
+
+  friend constexpr fixed_uint
+    operator & ( const fixed_uint & a, const fixed_uint & b )
+    { fixed_uint result ( a ) ;
+      return result &= b ; }
+
+  friend constexpr fixed_uint
+    operator | ( const fixed_uint & a, const fixed_uint & b )
+    { fixed_uint result ( a ) ;
+      return result |= b ; }
+
+  friend constexpr fixed_uint
+    operator ^ ( const fixed_uint & a, const fixed_uint & b )
+    { fixed_uint result ( a ) ;
+      return result ^= b ; }
+
+  constexpr fixed_uint & operator &= ( const fixed_uint & b )
+    { for ( sint i = 0 ; i < N ; ++ i )
+        digits [ i ] &= b.digits [ i ] ;
+      return * this ; }
+
+  constexpr fixed_uint & operator |= ( const fixed_uint & b )
+    { for ( sint i = 0 ; i < N ; ++ i )
+        digits [ i ] |= b.digits [ i ] ;
+      return * this ; }
+
+  constexpr fixed_uint & operator ^= ( const fixed_uint & b )
+    { for ( sint i = 0 ; i < N ; ++ i )
+        digits [ i ] ^= b.digits [ i ] ;
+      return * this ; }
+
+  constexpr fixed_uint operator << ( sint n ) const
+    { return fixed_int_shift_left ( * this, n ) ; }
+
+  constexpr fixed_uint operator >> ( sint n ) const
+    { return fixed_int_unsigned_shift_right ( * this, n ) ; }
+
+  constexpr fixed_uint & operator <<= ( sint n )
+    { return * this = * this << n ; }
+
+  constexpr fixed_uint & operator >>= ( sint n )
+    { return * this = * this >> n ; }
+
+  friend constexpr bool
+    operator == ( const fixed_uint & a, const fixed_uint & b )
+    { for ( sint i = 0 ; i < N ; ++ i )
+        if ( a.digits [ i ] != b.digits [ i ] )
+          return false ;
+      return true ; }
+
+  friend constexpr bool
+    operator < ( const fixed_uint & a, const fixed_uint & b )
+    { return fixed_int_unsigned_less ( a, b, N ) ; }
+
+  template < class CharT, class CharTraits >
+  friend basic_ostream < CharT, CharTraits > &
+    operator << ( basic_ostream < CharT, CharTraits > & o,
+                  const fixed_uint & x )
+    { return output_fixed_int ( o, x ) ; }
+
+  template < class CharT, class CharTraits >
+  friend basic_istream < CharT, CharTraits > &
+    operator >> ( basic_istream < CharT, CharTraits > & i,
+                  fixed_uint & x )
+    { return input_fixed_int ( i, x ) ; }
+
+} ;
+
+
+
+// *** FIXED_UINT NUMERIC_TRAITS ***
+
+
+template < sint N, class Word >
+class numeric_traits < fixed_uint < N, Word > >
+
+{
+public:
+
+  static constexpr bool is_floating_point = false ;
+
+  static constexpr bool is_signed = false ;
+
+  typedef fixed_int < N, Word > signed_type ;
+  typedef fixed_uint < N, Word > unsigned_type ;
+
+  static constexpr sint bit_size = numeric_traits < Word > :: bit_size * N ;
+
+  static constexpr bool has_double_size_type = false ;
+  typedef void double_size_type ;
+
+  static constexpr fixed_uint < N, Word > min ( )
+    { return fixed_uint < N, Word > :: min ( ) ; }
+
+  static constexpr fixed_uint < N, Word > max ( )
+    { return fixed_uint < N, Word > :: max ( ) ; }
+
+} ;
+
+
+
+// *** FIXED_UINT UNSIGNED_DOUBLE_MULTIPLIER ***
+
+
+template < sint N, class Word >
+class unsigned_double_multiplier < fixed_uint < N, Word >, false > :
+  public fixed_int_unsigned_double_multiplier < fixed_uint < N, Word > >
+
+{
+} ;
+
+
+
+// *** FIXED_UINT UNSIGNED_DOUBLE_DIVIDER ***
+
+
+template < sint N, class Word >
+class unsigned_double_divider < fixed_uint < N, Word >, false > :
+  public fixed_int_unsigned_double_divider < fixed_uint < N, Word > >
+
+{
+} ;
+
+
+
+// *** FIXED_UINT RND_STATIC_GENERATOR ***
+
+
+template < sint N, class Word >
+class rnd_static_generator < fixed_uint < N, Word > > :
+  public fixed_int_rnd_static_generator < fixed_uint < N, Word > >
+
+{
+} ;
+
+
+
+// *** FIXED_UINT RANGE_RND_STATIC_GENERATOR ***
+
+
+template < sint N, class Word >
+class range_rnd_static_generator < fixed_uint < N, Word > > :
+  public unsigned_int_range_rnd_static_generator < fixed_uint < N, Word > >
+
+{
+} ;
+
+
+
+// *** FIXED_UINT GLOBAL INTERFACES ***
+
+
+//
+
+template < sint N, class Word >
+constexpr bool is_negative ( const fixed_uint < N, Word > & x )
+
+{
+return false ;
+}
+
+
+//
+
+template < sint N, class Word >
+constexpr bool is_high_bit_set ( const fixed_uint < N, Word > & x )
+
+{
+return x.is_high_bit_set ( ) ;
+}
+
+
+//
+
+template < sint N, class Word >
+inline sint hamming_weight ( const fixed_uint < N, Word > & x )
+
+{
+sint result ( 0 ) ;
+
+for ( const auto & d : x.digits )
+  result += hamming_weight ( d ) ;
+
+return result ;
+}
+
+
+//
+
+template < sint N, class Word >
+constexpr fixed_uint < N, Word >
+         signed_shift_right ( const fixed_uint < N, Word > & x, sint n )
+
+{
+return fixed_int_signed_shift_right ( x, n ) ;
+}
+
+
+//
+
+template < sint N, class Word >
+constexpr fixed_uint < N, Word >
+         unsigned_shift_right ( const fixed_uint < N, Word > & x, sint n )
+
+{
+return fixed_int_unsigned_shift_right ( x, n ) ;
+}
+
+
+//
+
+template < sint N, class Word >
+constexpr sint exponent ( const fixed_uint < N, Word > & x )
+
+{
+return x.exponent ( ) ;
+}
+
+
+//
+
+template < sint N, class Word >
+inline fixed_uint < N, Word > reverse ( const fixed_uint < N, Word > & x )
+
+{
+fixed_uint < N, Word > result ;
+
+for ( sint i = 0 ; i < N ; ++ i )
+  result.digits [ i ] = reverse ( x.digits [ N - 1 - i ] ) ;
+
+return result ;
+}
+
+
+
+// *** FIXED_UINT IMPLICIT CONVERSION ***
+
+
+//
+
+template < sint N, class Word >
+class implicit_conversion_test
+        < typename fixed_uint < N, Word > :: signed_digit_type,
+          fixed_uint < N, Word > > :
+  public implicit_conversion_test_ok
+
+{
+} ;
+
+
+//
+
+template < sint N, class Word >
+class implicit_conversion_test
+        < typename fixed_uint < N, Word > :: unsigned_digit_type,
+          fixed_uint < N, Word > > :
+  public implicit_conversion_test_ok
+
+{
+} ;
+
+
+//
+
+template < sint N, class Word >
+class implicit_conversion_test
+        < fixed_int < N, Word >, fixed_uint < N, Word > > :
+  public implicit_conversion_test_ok
+
+{
+} ;
+
+
+//
+
+template < class S, sint N, class Word >
+class implicit_conversion_test < S, fixed_uint < N, Word > > :
+  public implicit_conversion_test
+           < S, typename fixed_uint < N, Word > :: unsigned_digit_type >
+
+{
+} ;
+
+
+
+// *** TYPE CONVERSION ***
+
+
+//
+
+template < sint N, class Word >
+class type_converter < fixed_int < N, Word >, fixed_int < N, Word > >
+
+{
+public:
+
+  static constexpr fixed_int < N, Word >
+    operate ( const fixed_int < N, Word > & x )
+    { return x ; }
+
+} ;
+
+
+//
+
+template < sint N, class Word >
+class type_converter < fixed_uint < N, Word >, fixed_uint < N, Word > >
+
+{
+public:
+
+  static constexpr fixed_uint < N, Word >
+    operate ( const fixed_uint < N, Word > & x )
+    { return x ; }
+
+} ;
+
+
+//
+
+template < sint N, class Word >
+class type_converter < fixed_uint < N, Word >, fixed_int < N, Word > >
+
+{
+public:
+
+  static constexpr fixed_int < N, Word >
+    operate ( const fixed_uint < N, Word > & x )
+    { return fixed_int < N, Word > ( x.digits ) ; }
+
+} ;
+
+
+//
+
+template < sint N, class Word >
+class type_converter < fixed_int < N, Word >, fixed_uint < N, Word > >
+
+{
+public:
+
+  static constexpr fixed_uint < N, Word >
+    operate ( const fixed_int < N, Word > & x )
+    { return fixed_uint < N, Word > ( x ) ; }
+
+} ;
+
+
+//
+
+template < sint N, class Word >
+class type_converter
+        < fixed_int < N, Word >,
+          typename fixed_int < N, Word > :: unsigned_digit_type >
+
+{
+public:
+
+  static constexpr typename fixed_int < N, Word > :: unsigned_digit_type
+    operate ( const fixed_int < N, Word > & x )
+    { return x.digits [ 0 ] ; }
+
+} ;
+
+
+//
+
+template < sint N, class Word >
+class type_converter
+        < fixed_uint < N, Word >,
+          typename fixed_uint < N, Word > :: unsigned_digit_type >
+
+{
+public:
+
+  static constexpr typename fixed_uint < N, Word > :: unsigned_digit_type
+    operate ( const fixed_uint < N, Word > & x )
+    { return x.digits [ 0 ] ; }
+
+} ;
+
+
+//
+
+template
+  < class FixedInt, class Destination, bool DestinationIsFloatingPoint >
+class from_fixed_int_type_converter ;
+
+
+//
+
+template < class FixedInt, class Destination >
+class from_fixed_int_type_converter < FixedInt, Destination, false >
+
+{
+public:
+
+  static constexpr Destination operate ( const FixedInt & x )
+    { return convert_to < Destination > ( x.digits [ 0 ] ) ; }
+
+} ;
+
+
+//
+
+template < class FixedInt, class Destination >
+class from_fixed_int_type_converter < FixedInt, Destination, true >
+
+{
+public:
+
+  static Destination operate ( const FixedInt & x )
+    { return x.template to_floating_point < Destination > ( ) ; }
+
+} ;
+
+
+//
+
+template < sint N, class Word, class U >
+class type_converter < fixed_int < N, Word >, U > :
+  public from_fixed_int_type_converter
+           < fixed_int < N, Word >,
+             U,
+             numeric_traits < U > :: is_floating_point >
+
+{
+} ;
+
+
+//
+
+template < sint N, class Word, class U >
+class type_converter < fixed_uint < N, Word >, U > :
+  public from_fixed_int_type_converter
+           < fixed_uint < N, Word >,
+             U,
+             numeric_traits < U > :: is_floating_point >
+
+{
+} ;
+
+
+//
+
+template < class Source, class FixedInt, bool SourceIsFloatingPoint >
+class to_fixed_int_type_converter ;
+
+
+//
+
+template < class Source, class FixedInt >
+class to_fixed_int_type_converter < Source, FixedInt, false >
+
+{
+public:
+
+  static constexpr FixedInt operate ( const Source & x )
+    { return FixedInt ( x ) ; }
+
+} ;
+
+
+//
+
+template < class Source, class FixedInt >
+class to_fixed_int_type_converter < Source, FixedInt, true >
+
+{
+public:
+
+  static FixedInt operate ( const Source & x )
+    { return FixedInt :: from_floating_point ( x ) ; }
+
+} ;
+
+
+//
+
+template < class S, sint N, class Word >
+class type_converter < S, fixed_int < N, Word > > :
+  public to_fixed_int_type_converter
+           < S,
+             fixed_int < N, Word >,
+             numeric_traits < S > :: is_floating_point >
+
+{
+} ;
+
+
+//
+
+template < class S, sint N, class Word >
+class type_converter < S, fixed_uint < N, Word > > :
+  public to_fixed_int_type_converter
+           < S,
+             fixed_uint < N, Word >,
+             numeric_traits < S > :: is_floating_point >
+
+{
+} ;
+
+
+
+#endif
@@ -0,0 +1,788 @@
+// Copyright Ivan Stanojevic 2025.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+
+
+
+#ifndef __FIXEDMATH_H
+
+#define __FIXEDMATH_H
+
+
+
+#include "cstdint.h"
+#include "cassert.h"
+#include "type_traits.h"
+
+#include "numbase.h"
+#include "fixedpoint.h"
+
+
+
+// *** FIXED_POINT_SQRT ***
+
+
+// returns: round ( sqrt ( (hl) ) ), computed by integer Newton iteration
+// post: overflow is set if the rounded root does not fit in U
+
+template < class U >
+U fixed_point_sqrt_kernel ( U h, U l, bool & overflow )
+
+{
+const sint bit_size = numeric_traits < U > :: bit_size ;
+
+overflow = false ;
+
+sint e = h != 0 ? exponent ( h ) + bit_size : exponent ( l ) ;
+
+if ( e == 0 )
+  return U ( 0 ) ;
+
+// y >= floor ( sqrt ( (hl) ) ) initially, and decreases until the
+// iteration stops
+
+U y (   ( e + 1 ) / 2 < bit_size
+      ? U ( U ( 1 ) << ( ( e + 1 ) / 2 ) )
+      : U ( -1 ) ) ;
+
+for ( ; ; )
+  {
+  // (hl) / y >= 1 << bit_size > y
+
+  if ( h >= y )
+    break ;
+
+  sint s = bit_size - exponent ( y ) ;
+
+  U q (   s == 0
+        ? unsigned_double_divide ( h, l, y )
+        : unsigned_double_divide
+            ( U ( ( h << s ) | ( l >> ( bit_size - s ) ) ),
+              U ( l << s ),
+              U ( y << s ) ) ) ;
+
+  U z ( U ( ( y >> 1 ) + ( q >> 1 ) + ( y & q & U ( 1 ) ) ) ) ;
+
+  if ( z >= y )
+    break ;
+
+  y = z ;
+  }
+
+// (hl) - y * y is in [ 0, 2 * y ], and there are no ties
+
+U yh ( 0 ), yl ( 0 ) ;
+unsigned_double_multiply ( y, y, yh, yl ) ;
+
+U rh ( h - yh - ( l < yl ) ),
+  rl ( l - yl ) ;
+
+if ( rh != 0  ||  rl > y )
+  {
+  if ( y == U ( -1 ) )
+    overflow = true ;
+  else
+    ++ y ;
+  }
+
+return y ;
+}
+
+
+// pre: x >= 0
+//
+// returns: sqrt ( x ), correctly rounded
+
+template < class FixedPoint >
+FixedPoint fixed_point_sqrt ( const FixedPoint & x )
+
+{
+typedef typename FixedPoint :: unsigned_value_type unsigned_value_type ;
+
+const sint bit_size = FixedPoint :: bit_size ;
+const sint fractional_bits = FixedPoint :: fractional_bits ;
+
+assert ( ! is_negative ( x ) ) ;
+
+unsigned_value_type d ( x.unsigned_data ( ) ) ;
+
+bool overflow ( false ) ;
+
+unsigned_value_type
+  r ( fixed_point_sqrt_kernel
+        (   fractional_bits < bit_size
+          ? unsigned_value_type ( d >> ( bit_size - fractional_bits ) )
+          : d,
+            fractional_bits < bit_size
+          ? unsigned_value_type ( d << fractional_bits )
+          : unsigned_value_type ( 0 ),
+          overflow ) ) ;
+
+if (    overflow
+     ||  r > numeric_traits < FixedPoint > :: max ( ) . unsigned_data ( ) )
+  return numeric_traits < FixedPoint > :: max ( ) ;
+
+return FixedPoint :: from_raw_data ( r ) ;
+}
+
+
+
+// *** FIXED_POINT_MATH ***
+
+
+// Kernels of the elementary functions of fixed point numbers with at
+// most 32 bits. Intermediate values are 64 bit integers with 62
+// fractional bits unless stated otherwise, which leaves at least 30
+// guard bits, so that results are within one unit in the last place.
+
+class fixed_point_math
+
+{
+public:
+
+  static constexpr sint working_bits = 62 ;
+
+  static constexpr int64_t one = int64_t ( 1 ) << working_bits ;
+
+  // pi / 2
+
+  static constexpr uint64_t pi_2 = UINT64_C(7244019458077122842) ;
+
+  // pi, 60 fractional bits
+
+  static constexpr int64_t pi = INT64_C(3622009729038561421) ;
+
+  // 2 / pi, 64 fractional bits
+
+  static constexpr uint64_t _2_pi = UINT64_C(11743562013128004906) ;
+
+  // log ( 2 ), 58 fractional bits
+
+  static constexpr int64_t log_2 = INT64_C(199786072581291495) ;
+
+  // 48 / 17 and 32 / 17, initial reciprocal approximation
+
+  static constexpr uint64_t _48_17 = UINT64_C(13021231110853801141) ;
+  static constexpr uint64_t _32_17 = UINT64_C(8680820740569200760) ;
+
+  // atan ( 2 ^ -i ) for i < atan_table_size; for larger i it is 2 ^ -i
+  // within the working precision
+
+  static constexpr sint atan_table_size = 21 ;
+
+  static constexpr uint64_t atan_table [ atan_table_size ] =
+    { UINT64_C(3622009729038561421), UINT64_C(2138197195906305897),
+      UINT64_C(1129764675555192497), UINT64_C(573486189672913778),
+      UINT64_C(287855953345232185), UINT64_C(144068303048368715),
+      UINT64_C(72051730834756822), UINT64_C(36028064038054493),
+      UINT64_C(18014306884351854), UINT64_C(9007187801521084),
+      UINT64_C(4503598195715550), UINT64_C(2251799634728303),
+      UINT64_C(1125899884473003), UINT64_C(562949950625109),
+      UINT64_C(281474976361131), UINT64_C(140737488311637),
+      UINT64_C(70368744172203), UINT64_C(35184372088149),
+      UINT64_C(17592186044331), UINT64_C(8796093022197),
+      UINT64_C(4398046511103) } ;
+
+  template < class FixedPoint >
+  static void check_type ( )
+    { static_assert (    FixedPoint :: bit_size <= 32
+                      &&  is_integral
+                            < typename FixedPoint :: unsigned_value_type >
+                              :: value,
+                      "Fixed point type must be builtin with at most "
+                      "32 bits." ) ; }
+
+  template < class FixedPoint >
+  static int64_t data ( const FixedPoint & x )
+    { return   numeric_traits < FixedPoint > :: is_signed
+             ? int64_t ( x.signed_data ( ) )
+             : int64_t ( x.unsigned_data ( ) ) ; }
+
+  // returns: round ( a * b / 2 ^ working_bits )
+
+  static uint64_t unsigned_multiply ( uint64_t a, uint64_t b )
+    { if ( a == 0  ||  b == 0 )
+        return 0 ;
+      uint64_t h ( 0 ), l ( 0 ) ;
+      unsigned_double_multiply ( a, b, h, l ) ;
+      return   ( ( h << ( 64 - working_bits ) ) | ( l >> working_bits ) )
+             + ( ( l >> ( working_bits - 1 ) ) & 1 ) ; }
+
+  static int64_t multiply ( int64_t a, int64_t b )
+    { uint64_t r ( unsigned_multiply ( a < 0 ? - uint64_t ( a ) : a,
+                                       b < 0 ? - uint64_t ( b ) : b ) ) ;
+      return int64_t ( ( a < 0 ) != ( b < 0 ) ? - r : r ) ; }
+
+  // returns: fixed point number with magnitude m, or the extreme value
+  //          of the sign if m is too large
+
+  template < class FixedPoint >
+  static FixedPoint from_magnitude ( uint64_t m, bool negative ) ;
+
+  // returns: v / 2 ^ w rounded to FixedPoint, half away from zero
+  //
+  // pre: w > fractional bits of FixedPoint
+
+  template < class FixedPoint >
+  static FixedPoint result ( int64_t v, sint w )
+    { sint s = w - FixedPoint :: fractional_bits ;
+      assert ( s > 0 ) ;
+      uint64_t m ( v < 0 ? - uint64_t ( v ) : v ) ;
+      return from_magnitude < FixedPoint >
+               ( s > 64 ? 0 : ( ( m >> ( s - 1 ) ) + 1 ) >> 1, v < 0 ) ; }
+
+  static int64_t exp ( int64_t r ) ;
+
+  static int64_t log ( uint64_t m ) ;
+
+  static int64_t sin ( int64_t r ) ;
+
+  static int64_t cos ( int64_t r ) ;
+
+  static int64_t atan ( int64_t x, int64_t y ) ;
+
+  template < class FixedPoint >
+  static int64_t reduce_pi_2 ( const FixedPoint & x, sint & quadrant ) ;
+
+  template < class FixedPoint >
+  static FixedPoint reciprocal ( const FixedPoint & x ) ;
+
+} ;
+
+
+//
+
+template < class FixedPoint >
+FixedPoint fixed_point_math :: from_magnitude ( uint64_t m, bool negative )
+
+{
+typedef typename FixedPoint :: unsigned_value_type unsigned_value_type ;
+
+const FixedPoint max_value ( numeric_traits < FixedPoint > :: max ( ) ) ;
+
+if ( negative )
+  {
+  if ( ! numeric_traits < FixedPoint > :: is_signed )
+    return FixedPoint :: from_raw_data ( unsigned_value_type ( 0 ) ) ;
+
+  if ( m > uint64_t ( max_value.unsigned_data ( ) ) + 1 )
+    return numeric_traits < FixedPoint > :: min ( ) ;
+
+  return FixedPoint :: from_raw_data ( unsigned_value_type ( - m ) ) ;
+  }
+
+if ( m > max_value.unsigned_data ( ) )
+  return max_value ;
+
+return FixedPoint :: from_raw_data ( unsigned_value_type ( m ) ) ;
+}
+
+
+// pre: | r | <= log ( 2 ) / 2
+//
+// returns: exp ( r )
+
+inline int64_t fixed_point_math :: exp ( int64_t r )
+
+{
+int64_t s ( one ), t ( one ) ;
+
+for ( sint n = 1 ; t != 0 ; ++ n )
+  {
+  t = multiply ( t, r ) / n ;
+  s += t ;
+  }
+
+return s ;
+}
+
+
+// pre: 1 <= m < 2
+//
+// returns: log ( m ), as 2 atanh ( ( m - 1 ) / ( m + 1 ) )
+
+inline int64_t fixed_point_math :: log ( uint64_t m )
+
+{
+uint64_t n ( m - one ),
+         d ( m + one ) ;
+
+int64_t s ( unsigned_double_divide ( n >> ( 64 - working_bits ),
+                                     n << working_bits,
+                                     d ) ),
+        s2 ( multiply ( s, s ) ),
+        t ( s ),
+        y ( 0 ) ;
+
+for ( sint i = 1 ; t != 0 ; i += 2 )
+  {
+  y += t / i ;
+  t = multiply ( t, s2 ) ;
+  }
+
+return 2 * y ;
+}
+
+
+// pre: | r | < 1
+//
+// returns: sin ( r )
+
+inline int64_t fixed_point_math :: sin ( int64_t r )
+
+{
+int64_t r2 ( multiply ( r, r ) ),
+        s ( 0 ),
+        t ( r ) ;
+
+for ( sint n = 1 ; t != 0 ; n += 2 )
+  {
+  s += t ;
+  t = - multiply ( t, r2 ) / ( ( n + 1 ) * ( n + 2 ) ) ;
+  }
+
+return s ;
+}
+
+
+// pre: | r | < 1
+//
+// returns: cos ( r )
+
+inline int64_t fixed_point_math :: cos ( int64_t r )
+
+{
+int64_t r2 ( multiply ( r, r ) ),
+        c ( 0 ),
+        t ( one ) ;
+
+for ( sint n = 0 ; t != 0 ; n += 2 )
+  {
+  c += t ;
+  t = - multiply ( t, r2 ) / ( ( n + 1 ) * ( n + 2 ) ) ;
+  }
+
+return c ;
+}
+
+
+// pre: x > 0, | x | < 2 ^ 61, | y | < 2 ^ 61
+//
+// returns: atan ( y / x ), computed by CORDIC vectoring
+
+inline int64_t fixed_point_math :: atan ( int64_t x, int64_t y )
+
+{
+int64_t z ( 0 ) ;
+
+for ( sint i = 0 ; i < working_bits  &&  y != 0 ; ++ i )
+  {
+  int64_t dx ( signed_shift_right ( y, i ) ),
+          dy ( signed_shift_right ( x, i ) ),
+          a (   i < atan_table_size
+              ? int64_t ( atan_table [ i ] )
+              : int64_t ( 1 ) << ( working_bits - i ) ) ;
+
+  if ( y > 0 )
+    {
+    x += dx ;
+    y -= dy ;
+    z += a ;
+    }
+  else
+    {
+    x -= dx ;
+    y += dy ;
+    z -= a ;
+    }
+  }
+
+return z ;
+}
+
+
+// returns: r = x - quadrant * pi / 2, | r | <= pi / 4 within the working
+//          precision, and quadrant modulo 4
+
+template < class FixedPoint >
+int64_t fixed_point_math :: reduce_pi_2 ( const FixedPoint & x,
+                                          sint & quadrant )
+
+{
+const sint fractional_bits = FixedPoint :: fractional_bits ;
+
+int64_t d ( data ( x ) ) ;
+
+uint64_t m ( d < 0 ? - uint64_t ( d ) : d ),
+         h ( 0 ),
+         l ( 0 ) ;
+
+if ( m != 0 )
+  unsigned_double_multiply ( m, _2_pi, h, l ) ;
+
+// k = round ( x * 2 / pi )
+
+uint64_t k ( ( ( h >> ( fractional_bits - 1 ) ) + 1 ) >> 1 ) ;
+
+if ( d < 0 )
+  k = - k ;
+
+quadrant = sint ( k & 3 ) ;
+
+return int64_t (   ( uint64_t ( d ) << ( working_bits - fractional_bits ) )
+                 - k * pi_2 ) ;
+}
+
+
+// returns: 1 / x, rounded like division
+//
+// pre: x != 0
+
+template < class FixedPoint >
+FixedPoint fixed_point_math :: reciprocal ( const FixedPoint & x )
+
+{
+const sint fractional_bits = FixedPoint :: fractional_bits ;
+
+int64_t d ( data ( x ) ) ;
+
+assert ( d != 0 ) ;
+
+uint64_t a ( d < 0 ? - uint64_t ( d ) : d ) ;
+
+sint e = exponent ( a ) ;
+
+// m = a / 2 ^ e is in [ 1 / 2, 1 ), and y converges quadratically to
+// 1 / m from an initial error below 1 / 17
+
+uint64_t m ( a << ( working_bits - e ) ),
+         y ( _48_17 - unsigned_multiply ( _32_17, m ) ) ;
+
+for ( sint i = 0 ; i < 4 ; ++ i )
+  y = unsigned_multiply ( y, ( uint64_t ( 2 ) << working_bits )
+                             - unsigned_multiply ( m, y ) ) ;
+
+// q = floor ( ( 2 ^ ( 2 f + 1 ) + a ) / ( 2 a ) ) exactly, starting from
+// the approximation 2 ^ ( 2 f ) / a = y / 2 ^ ( working_bits + e - 2 f )
+
+sint s = working_bits + e - 2 * fractional_bits ;
+
+if ( s <= 0 )
+  return from_magnitude < FixedPoint > ( uint64_t ( -1 ), d < 0 ) ;
+
+uint64_t q ( s < 64 ? y >> s : 0 ) ;
+
+if ( q > ( uint64_t ( 1 ) << FixedPoint :: bit_size ) )
+  return from_magnitude < FixedPoint > ( q, d < 0 ) ;
+
+sint n = 2 * fractional_bits + 1 ;
+
+uint64_t nh ( n < 64 ? 0 : uint64_t ( 1 ) << ( n - 64 ) ),
+         nl ( ( n < 64 ? uint64_t ( 1 ) << n : 0 ) + a ) ;
+
+if ( nl < a )
+  ++ nh ;
+
+uint64_t b ( a << 1 ), ph ( 0 ), pl ( 0 ) ;
+
+unsigned_double_multiply ( q + 1, b, ph, pl ) ;
+
+while ( ph < nh  ||  ( ph == nh  &&  pl <= nl ) )
+  {
+  ++ q ;
+  pl += b ;
+  if ( pl < b )
+    ++ ph ;
+  }
+
+for ( ; ; )
+  {
+  if ( pl < b )
+    -- ph ;
+  pl -= b ;
+
+  if ( ph < nh  ||  ( ph == nh  &&  pl <= nl ) )
+    break ;
+
+  -- q ;
+  }
+
+return from_magnitude < FixedPoint > ( q, d < 0 ) ;
+}
+
+
+
+// *** SQRT ***
+
+
+// pre: x >= 0
+
+template < class T, sint FractionalBits >
+inline signed_fixed_point < T, FractionalBits >
+  sqrt ( const signed_fixed_point < T, FractionalBits > & x )
+
+{
+return fixed_point_sqrt ( x ) ;
+}
+
+
+//
+
+template < class T, sint FractionalBits >
+inline unsigned_fixed_point < T, FractionalBits >
+  sqrt ( const unsigned_fixed_point < T, FractionalBits > & x )
+
+{
+return fixed_point_sqrt ( x ) ;
+}
+
+
+
+// *** RECIPROCAL ***
+
+
+// pre: x != 0
+
+template < class T, sint FractionalBits >
+inline signed_fixed_point < T, FractionalBits >
+  reciprocal ( const signed_fixed_point < T, FractionalBits > & x )
+
+{
+fixed_point_math :: check_type < signed_fixed_point < T, FractionalBits > >
+                      ( ) ;
+
+return fixed_point_math :: reciprocal ( x ) ;
+}
+
+
+// pre: x != 0
+
+template < class T, sint FractionalBits >
+inline unsigned_fixed_point < T, FractionalBits >
+  reciprocal ( const unsigned_fixed_point < T, FractionalBits > & x )
+
+{
+fixed_point_math :: check_type < unsigned_fixed_point < T, FractionalBits > >
+                      ( ) ;
+
+return fixed_point_math :: reciprocal ( x ) ;
+}
+
+
+
+// *** EXP ***
+
+
+//
+
+template < class FixedPoint >
+FixedPoint fixed_point_exp ( const FixedPoint & x )
+
+{
+typedef typename FixedPoint :: unsigned_value_type unsigned_value_type ;
+
+const sint fractional_bits = FixedPoint :: fractional_bits ;
+
+fixed_point_math :: check_type < FixedPoint > ( ) ;
+
+int64_t d ( fixed_point_math :: data ( x ) ) ;
+
+// exp ( 22 ) > 2 ^ 31, exp ( -23 ) < 2 ^ -33
+
+if ( d >= int64_t ( 22 ) << fractional_bits )
+  return numeric_traits < FixedPoint > :: max ( ) ;
+
+if ( d <= - ( int64_t ( 23 ) << fractional_bits ) )
+  return FixedPoint :: from_raw_data ( unsigned_value_type ( 0 ) ) ;
+
+// x = k log ( 2 ) + r, 58 fractional bits
+
+const int64_t log_2 = fixed_point_math :: log_2 ;
+
+int64_t v ( d * ( int64_t ( 1 ) << ( 58 - fractional_bits ) ) ),
+        k ( ( v + ( v < 0 ? - log_2 / 2 : log_2 / 2 ) ) / log_2 ),
+        r ( ( v - k * log_2 ) * 16 ) ;
+
+return fixed_point_math :: result < FixedPoint >
+         ( fixed_point_math :: exp ( r ),
+           fixed_point_math :: working_bits - sint ( k ) ) ;
+}
+
+
+//
+
+template < class T, sint FractionalBits >
+inline signed_fixed_point < T, FractionalBits >
+  exp ( const signed_fixed_point < T, FractionalBits > & x )
+
+{
+return fixed_point_exp ( x ) ;
+}
+
+
+//
+
+template < class T, sint FractionalBits >
+inline unsigned_fixed_point < T, FractionalBits >
+  exp ( const unsigned_fixed_point < T, FractionalBits > & x )
+
+{
+return fixed_point_exp ( x ) ;
+}
+
+
+
+// *** LOG ***
+
+
+// pre: x > 0
+//
+// Negative results of unsigned fixed point types are returned as 0.
+
+template < class FixedPoint >
+FixedPoint fixed_point_log ( const FixedPoint & x )
+
+{
+const sint fractional_bits = FixedPoint :: fractional_bits ;
+
+fixed_point_math :: check_type < FixedPoint > ( ) ;
+
+int64_t d ( fixed_point_math :: data ( x ) ) ;
+
+assert ( d > 0 ) ;
+
+// x = m * 2 ^ ( e - 1 - f ), m in [ 1, 2 )
+
+sint e = exponent ( uint64_t ( d ) ) ;
+
+int64_t y ( fixed_point_math :: log
+              ( uint64_t ( d )
+                << ( fixed_point_math :: working_bits + 1 - e ) ) ) ;
+
+return fixed_point_math :: result < FixedPoint >
+         (   signed_shift_right ( y + 8, 4 )
+           + ( e - 1 - fractional_bits ) * fixed_point_math :: log_2,
+           58 ) ;
+}
+
+
+// pre: x > 0
+
+template < class T, sint FractionalBits >
+inline signed_fixed_point < T, FractionalBits >
+  log ( const signed_fixed_point < T, FractionalBits > & x )
+
+{
+return fixed_point_log ( x ) ;
+}
+
+
+// pre: x > 0
+
+template < class T, sint FractionalBits >
+inline unsigned_fixed_point < T, FractionalBits >
+  log ( const unsigned_fixed_point < T, FractionalBits > & x )
+
+{
+return fixed_point_log ( x ) ;
+}
+
+
+
+// *** SIN, COS ***
+
+
+//
+
+template < class T, sint FractionalBits >
+signed_fixed_point < T, FractionalBits >
+  sin ( const signed_fixed_point < T, FractionalBits > & x )
+
+{
+fixed_point_math :: check_type < signed_fixed_point < T, FractionalBits > >
+                      ( ) ;
+
+sint quadrant = 0 ;
+
+int64_t r ( fixed_point_math :: reduce_pi_2 ( x, quadrant ) ) ;
+
+typedef signed_fixed_point < T, FractionalBits > fixed_point_type ;
+
+return fixed_point_math :: result < fixed_point_type >
+         (   quadrant == 0 ? fixed_point_math :: sin ( r )
+           : quadrant == 1 ? fixed_point_math :: cos ( r )
+           : quadrant == 2 ? - fixed_point_math :: sin ( r )
+           : - fixed_point_math :: cos ( r ),
+           fixed_point_math :: working_bits ) ;
+}
+
+
+//
+
+template < class T, sint FractionalBits >
+signed_fixed_point < T, FractionalBits >
+  cos ( const signed_fixed_point < T, FractionalBits > & x )
+
+{
+fixed_point_math :: check_type < signed_fixed_point < T, FractionalBits > >
+                      ( ) ;
+
+sint quadrant = 0 ;
+
+int64_t r ( fixed_point_math :: reduce_pi_2 ( x, quadrant ) ) ;
+
+typedef signed_fixed_point < T, FractionalBits > fixed_point_type ;
+
+return fixed_point_math :: result < fixed_point_type >
+         (   quadrant == 0 ? fixed_point_math :: cos ( r )
+           : quadrant == 1 ? - fixed_point_math :: sin ( r )
+           : quadrant == 2 ? - fixed_point_math :: cos ( r )
+           : fixed_point_math :: sin ( r ),
+           fixed_point_math :: working_bits ) ;
+}
+
+
+
+// *** ATAN2 ***
+
+
+// returns: angle of ( x, y ) in [ - pi, pi ], saturated if pi is not
+//          representable
+
+template < class T, sint FractionalBits >
+signed_fixed_point < T, FractionalBits >
+  atan2 ( const signed_fixed_point < T, FractionalBits > & y,
+          const signed_fixed_point < T, FractionalBits > & x )
+
+{
+typedef signed_fixed_point < T, FractionalBits > fixed_point_type ;
+
+fixed_point_math :: check_type < fixed_point_type > ( ) ;
+
+int64_t xd ( x.signed_data ( ) ),
+        yd ( y.signed_data ( ) ) ;
+
+if ( xd == 0  &&  yd == 0 )
+  return y ;
+
+// scale max ( | x |, | y | ) to [ 2 ^ 59, 2 ^ 60 )
+
+int64_t ax ( xd < 0 ? - xd : xd ),
+        ay ( yd < 0 ? - yd : yd ) ;
+
+sint s = 60 - exponent ( uint64_t ( ax > ay ? ax : ay ) ) ;
+
+int64_t z ( fixed_point_math :: atan ( ax << s,
+                                       yd * ( int64_t ( 1 ) << s ) ) ),
+        v ( signed_shift_right ( z + 2, 2 ) ) ;
+
+if ( xd < 0 )
+  v = ( yd < 0 ? - fixed_point_math :: pi : fixed_point_math :: pi ) - v ;
+
+return fixed_point_math :: result < fixed_point_type > ( v, 60 ) ;
+}
+
+
+
+#endif
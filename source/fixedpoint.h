@@ -100,26 +100,28 @@ signed_fixed_point < T, FractionalBits >
   round ( const signed_fixed_point < T, FractionalBits > & x ) ;
 
 template < class T, sint FractionalBits >
-bool is_negative ( const signed_fixed_point < T, FractionalBits > & x ) ;
+constexpr bool
+  is_negative ( const signed_fixed_point < T, FractionalBits > & x ) ;
 
 template < class T, sint FractionalBits >
-bool is_high_bit_set ( const signed_fixed_point < T, FractionalBits > & x ) ;
+constexpr bool
+  is_high_bit_set ( const signed_fixed_point < T, FractionalBits > & x ) ;
 
 template < class T, sint FractionalBits >
 sint hamming_weight ( const signed_fixed_point < T, FractionalBits > & x ) ;
 
 template < class T, sint FractionalBits >
-signed_fixed_point < T, FractionalBits >
+constexpr signed_fixed_point < T, FractionalBits >
   signed_shift_right ( const signed_fixed_point < T, FractionalBits > & x,
                        sint n ) ;
 
 template < class T, sint FractionalBits >
-signed_fixed_point < T, FractionalBits >
+constexpr signed_fixed_point < T, FractionalBits >
   unsigned_shift_right ( const signed_fixed_point < T, FractionalBits > & x,
                          sint n ) ;
 
 template < class T, sint FractionalBits >
-sint exponent ( const signed_fixed_point < T, FractionalBits > & x ) ;
+constexpr sint exponent ( const signed_fixed_point < T, FractionalBits > & x ) ;
 
 
 //
@@ -184,248 +186,434 @@ unsigned_fixed_point < T, FractionalBits >
   round ( const unsigned_fixed_point < T, FractionalBits > & x ) ;
 
 template < class T, sint FractionalBits >
-bool is_negative ( const unsigned_fixed_point < T, FractionalBits > & x ) ;
+constexpr bool
+  is_negative ( const unsigned_fixed_point < T, FractionalBits > & x ) ;
 
 template < class T, sint FractionalBits >
-bool is_high_bit_set ( const unsigned_fixed_point < T, FractionalBits > & x ) ;
+constexpr bool
+  is_high_bit_set ( const unsigned_fixed_point < T, FractionalBits > & x ) ;
 
 template < class T, sint FractionalBits >
 sint hamming_weight ( const unsigned_fixed_point < T, FractionalBits > & x ) ;
 
 template < class T, sint FractionalBits >
-unsigned_fixed_point < T, FractionalBits >
+constexpr unsigned_fixed_point < T, FractionalBits >
   signed_shift_right ( const unsigned_fixed_point < T, FractionalBits > & x,
                        sint n ) ;
 
 template < class T, sint FractionalBits >
-unsigned_fixed_point < T, FractionalBits >
+constexpr unsigned_fixed_point < T, FractionalBits >
   unsigned_shift_right ( const unsigned_fixed_point < T, FractionalBits > & x,
                          sint n ) ;
 
 template < class T, sint FractionalBits >
-sint exponent ( const unsigned_fixed_point < T, FractionalBits > & x ) ;
+constexpr sint
+  exponent ( const unsigned_fixed_point < T, FractionalBits > & x ) ;
 
 
 
-// *** FIXED_POINT STREAMING ***
+// *** FIXED_POINT TEXT CONVERSION ***
+
+
+// returns: size of a buffer sufficient for any output of
+//          fixed_point_to_chars and any meaningful input of
+//          fixed_point_from_chars
+
+template < class FixedPoint >
+constexpr sint fixed_point_max_chars ( )
+
+{
+return   FixedPoint :: integer_bits * 31 / 100
+       + FixedPoint :: fractional_bits
+       + 6 ;
+}
 
 
+// writes x in decimal, with at most precision fractional digits, rounded
+// half away from zero, without trailing zeros
 //
+// returns: end of the written text, or nullptr if [ first, last ) is too
+//          small
 
-template < class CharT, class CharTraits, class FixedPoint >
-basic_ostream < CharT, CharTraits > &
-  output_fixed_point ( basic_ostream < CharT, CharTraits > & o, FixedPoint x )
+template < class CharT, class FixedPoint >
+CharT * fixed_point_to_chars ( CharT * first,
+                               CharT * last,
+                               const FixedPoint & x,
+                               sint precision )
 
 {
 typedef typename FixedPoint :: unsigned_value_type unsigned_value_type ;
 
+const sint bit_size = FixedPoint :: bit_size ;
+const sint fractional_bits = FixedPoint :: fractional_bits ;
+
 bool negative = is_negative ( x ) ;
 
-if ( negative )
-  x = - x ;
+unsigned_value_type
+  data ( negative ? - x.unsigned_data ( ) : x.unsigned_data ( ) ) ;
 
-vector < CharT > text ;
+// text [ 0 ] is reserved for a carry out of the integer part
 
-if ( FixedPoint :: fractional_bits < FixedPoint :: bit_size )
+CharT text [ fixed_point_max_chars < FixedPoint > ( ) ] ;
+
+CharT * begin = text + 1,
+      * end = begin ;
+
+if ( fractional_bits < bit_size )
   {
-  unsigned_value_type y ( x.data >> FixedPoint :: fractional_bits ) ;
+  unsigned_value_type y ( data >> fractional_bits ) ;
 
   do
     {
     unsigned_value_type d ;
     divmod ( y, 10, y, d ) ;
-    text.push_back ( convert_to < CharT > ( d ) + CharT ( '0' ) ) ;
+    * end ++ = convert_to < CharT > ( d ) + CharT ( '0' ) ;
     }
   while ( y != 0 ) ;
 
-  reverse ( text.begin ( ), text.end ( ) ) ;
+  reverse ( begin, end ) ;
   }
 else
-  text.push_back ( CharT ( '0' ) ) ;
+  * end ++ = CharT ( '0' ) ;
 
-sint dot_position = text.size ( ) ;
+CharT * dot = end ;
 
 {
-unsigned_value_type y ( x.data << FixedPoint :: integer_bits ) ;
+unsigned_value_type y ( data << FixedPoint :: integer_bits ) ;
+
+// every digit clears at least one more low bit of y
+
+if ( precision > fractional_bits )
+  precision = fractional_bits ;
 
-for ( sint i = 0 ; i < o.precision ( )  &&  y != 0 ; ++ i )
+for ( sint i = 0 ; i < precision  &&  y != 0 ; ++ i )
   {
   unsigned_value_type d ;
   unsigned_double_multiply ( y, unsigned_value_type ( 10 ), d, y ) ;
-  text.push_back ( convert_to < CharT > ( d ) + CharT ( '0' ) ) ;
+  * end ++ = convert_to < CharT > ( d ) + CharT ( '0' ) ;
   }
 
 if ( is_high_bit_set ( y ) )
   {
-  auto iter = text.end ( ) ;
+  CharT * p = end ;
 
   for ( ; ; )
     {
-    if ( iter == text.begin ( ) )
+    if ( p == begin )
       {
-      text.insert ( text.begin ( ), CharT ( '1' ) ) ;
-      ++ dot_position ;
+      * -- begin = CharT ( '1' ) ;
       break ;
       }
 
-    -- iter ;
+    -- p ;
 
-    if ( * iter != CharT ( '9' ) )
+    if ( * p != CharT ( '9' ) )
       {
-      ++ * iter ;
+      ++ * p ;
       break ;
       }
 
-    * iter = CharT ( '0' ) ;
+    * p = CharT ( '0' ) ;
     }
   }
 }
 
-text.erase ( find_if ( text.rbegin ( ), text.rend ( ) - dot_position,
-                       [ ] ( const CharT & c ) { return c != CharT ( '0' ) ; } )
-             .base ( ),
-             text.end ( ) ) ;
+while ( end != dot  &&  end [ -1 ] == CharT ( '0' ) )
+  -- end ;
 
-if ( dot_position != text.size ( ) )
-  text.insert ( text.begin ( ) + dot_position, CharT ( '.' ) ) ;
+if (    last - first
+      <   ( end - begin )
+        + ( negative ? 1 : 0 )
+        + ( end != dot ? 1 : 0 ) )
+  return nullptr ;
 
 if ( negative )
-  text.insert ( text.begin ( ), CharT ( '-' ) ) ;
+  * first ++ = CharT ( '-' ) ;
 
-return o.write ( text.data ( ), text.size ( ) ) ;
+first = copy ( begin, dot, first ) ;
+
+if ( end != dot )
+  {
+  * first ++ = CharT ( '.' ) ;
+  first = copy ( dot, end, first ) ;
+  }
+
+return first ;
 }
 
 
+// reads [ - ] digits [ . digits ], with at least one digit, rounding the
+// value half away from zero; the integer part is taken modulo
+// 1 << integer_bits
 //
+// returns: end of the parsed text, or first if there is no number at
+//          first, in which case x is unchanged
 
-template < class CharT, class CharTraits, class FixedPoint >
-basic_istream < CharT, CharTraits > &
-  input_fixed_point ( basic_istream < CharT, CharTraits > & i, FixedPoint & x )
+template < class CharT, class FixedPoint >
+const CharT * fixed_point_from_chars ( const CharT * first,
+                                       const CharT * last,
+                                       FixedPoint & x )
 
 {
 typedef typename FixedPoint :: unsigned_value_type unsigned_value_type ;
 
-ios_base :: fmtflags start_flags = i.flags ( ) ;
-i.setf ( ios_base :: skipws ) ;
+const sint bit_size = FixedPoint :: bit_size ;
+const sint fractional_bits = FixedPoint :: fractional_bits ;
 
-unsigned_value_type integer_part ( 0 ),
-                    fractional_part_high ( 0 ),
-                    fractional_part_low ( 0 ) ;
+auto is_digit =
+  [ ] ( CharT c ) { return c >= CharT ( '0' )  &&  c <= CharT ( '9' ) ; } ;
 
-bool negative ;
-CharT c ;
+const CharT * p = first ;
 
-i >> c ;
-if ( ! i.good ( ) )
-  goto error_end ;
+bool negative = false ;
 
-i.unsetf ( ios_base :: skipws ) ;
-
-if ( c == CharT ( '-' ) )
+if ( p != last  &&  * p == CharT ( '-' ) )
   {
   negative = true ;
-  i >> c ;
-  if ( ! i.good ( ) )
-    goto error_end ;
+  ++ p ;
   }
-else
-  negative = false ;
 
-if ( c == CharT ( '.' ) )
-  goto decimals ;
+const CharT * integer_begin = p ;
 
-if ( c < CharT ( '0' )  ||  c > CharT ( '9' ) )
+unsigned_value_type integer_part ( 0 ) ;
+
+while ( p != last  &&  is_digit ( * p ) )
   {
-  i.putback ( c ) ;
-  i.setstate ( ios_base :: failbit ) ;
-  goto error_end ;
+  integer_part = integer_part * 10 + ( * p - CharT ( '0' ) ) ;
+  ++ p ;
   }
 
-do
-  {
-  integer_part = integer_part * 10 + ( c - CharT ( '0' ) ) ;
+bool has_digits = p != integer_begin ;
 
-  i >> c ;
-  if ( i.eof ( ) )
-    goto ok_end ;
-  if ( ! i.good ( ) )
-    goto error_end ;
-  }
-while ( c >= CharT ( '0' )  &&  c <= CharT ( '9' ) ) ;
+const CharT * fraction_begin = p,
+            * fraction_end = p ;
 
-if ( c != CharT ( '.' ) )
+if ( p != last  &&  * p == CharT ( '.' ) )
   {
-  i.putback ( c ) ;
-  goto ok_end ;
+  fraction_begin = ++ p ;
+
+  while ( p != last  &&  is_digit ( * p ) )
+    ++ p ;
+
+  fraction_end = p ;
+
+  has_digits = has_digits  ||  fraction_end != fraction_begin ;
   }
 
-decimals:
+if ( ! has_digits )
+  return first ;
 
-{
-unsigned_value_type
-  pc ( unsigned_value_type ( 1 ) << ( FixedPoint :: bit_size - 4 ) ),
-  ph ( 0 ),
-  pl ( 0 ) ;
+// only the first fractional_bits + 1 digits can affect the rounded value
 
-unsigned_value_type
-  b ( unsigned_value_type ( 10 ) << ( FixedPoint :: bit_size - 4 ) ) ;
+if ( fraction_end - fraction_begin > fractional_bits + 1 )
+  fraction_end = fraction_begin + fractional_bits + 1 ;
 
-bool ignore_digits = false ;
+// fraction is the fractional part truncated to fractional_bits, and
+// round_bit the next bit, computed by dividing by 10 from the last digit
+// on, which truncates exactly like dividing the whole number once
 
-for ( ; ; )
+unsigned_value_type fraction ( 0 ), round_bit ( 0 ) ;
+
+if ( fractional_bits <= bit_size - 5 )
   {
-  unsigned_value_type qh ( unsigned_double_divide ( pc, ph, b ) ),
-                      ql ( unsigned_double_divide ( ph - qh * b, pl, b ) ) ;
+  unsigned_value_type v ( 0 ) ;
 
-  if ( qh == 0  &&  ql == 0 )
-    ignore_digits = true ;
+  for ( const CharT * q = fraction_end ; q != fraction_begin ; )
+    {
+    -- q ;
+    v = (   (    unsigned_value_type ( * q - CharT ( '0' ) )
+              << ( bit_size - 4 ) )
+          + v )
+        / 10 ;
+    }
 
-  do
+  fraction = v >> ( bit_size - 4 - fractional_bits ) ;
+  round_bit = ( v >> ( bit_size - 5 - fractional_bits ) ) & 1 ;
+  }
+else
+  {
+  const unsigned_value_type
+    b ( unsigned_value_type ( 10 ) << ( bit_size - 4 ) ) ;
+
+  unsigned_value_type vh ( 0 ), vl ( 0 ) ;
+
+  for ( const CharT * q = fraction_end ; q != fraction_begin ; )
     {
-    i >> c ;
-    if ( i.eof ( ) )
-      goto ok_end ;
-    if ( ! i.good ( ) )
-      goto error_end ;
+    -- q ;
 
-    if ( c < CharT ( '0' )  ||  c > CharT ( '9' ) )
-      {
-      i.putback ( c ) ;
-      goto ok_end ;
-      }
+    unsigned_value_type
+      nh (   (    unsigned_value_type ( * q - CharT ( '0' ) )
+               << ( bit_size - 4 ) )
+           + vh ) ;
+
+    vh = nh / 10 ;
+
+    vl = unsigned_double_divide
+           ( unsigned_value_type
+               ( ( ( nh - vh * 10 ) << ( bit_size - 4 ) ) | ( vl >> 4 ) ),
+             unsigned_value_type ( vl << ( bit_size - 4 ) ),
+             b ) ;
     }
-  while ( ignore_digits ) ;
 
-  unsigned_value_type cv ( c - CharT ( '0' ) ) ;
+  sint s = bit_size * 2 - 4 - fractional_bits ;
 
-  unsigned_value_type sh, sl ;
-  unsigned_double_multiply ( cv, ql, sh, sl ) ;
-  sh += cv * qh ;
+  fraction =   s >= bit_size
+             ? unsigned_value_type ( vh >> ( s - bit_size ) )
+             : unsigned_value_type
+                 ( ( vh << ( bit_size - s ) ) | ( vl >> s ) ) ;
 
-  fractional_part_low += sl ;
-  if ( fractional_part_low < sl )
-    ++ fractional_part_high ;
-  fractional_part_high += sh ;
+  round_bit =   s - 1 >= bit_size
+              ? unsigned_value_type ( ( vh >> ( s - 1 - bit_size ) ) & 1 )
+              : unsigned_value_type ( ( vl >> ( s - 1 ) ) & 1 ) ;
+  }
+
+unsigned_value_type data ( 0 ) ;
 
-  pc = qh >> 4 ;
-  ph = ( qh << ( FixedPoint :: bit_size - 4 ) ) | ( ql >> 4 ) ;
-  pl = ql << ( FixedPoint :: bit_size - 4 ) ;
+if ( fractional_bits < bit_size )
+  {
+  fraction += round_bit ;
+  data = ( integer_part << fractional_bits ) + fraction ;
   }
+else
+  data = fraction + round_bit ;
+
+x = FixedPoint :: from_raw_data
+                    ( unsigned_value_type ( negative ? - data : data ) ) ;
+
+return p ;
 }
 
-ok_end:
 
-x.data =   FixedPoint :: fractional_bits < FixedPoint :: bit_size
-         ?   ( integer_part << FixedPoint :: fractional_bits )
-           | ( fractional_part_high >> FixedPoint :: integer_bits )
-         : fractional_part_high ;
 
-if ( negative )
-  x.data = - x.data ;
+// *** FIXED_POINT STREAMING ***
+
+
+//
+
+template < class CharT, class CharTraits, class FixedPoint >
+basic_ostream < CharT, CharTraits > &
+  output_fixed_point ( basic_ostream < CharT, CharTraits > & o,
+                       const FixedPoint & x )
+
+{
+CharT text [ fixed_point_max_chars < FixedPoint > ( ) ] ;
+
+const sint precision =   o.precision ( ) < FixedPoint :: fractional_bits
+                       ? sint ( o.precision ( ) )
+                       : FixedPoint :: fractional_bits ;
+
+CharT * end = fixed_point_to_chars
+                ( text,
+                  text + fixed_point_max_chars < FixedPoint > ( ),
+                  x,
+                  precision ) ;
+
+return o.write ( text, end - text ) ;
+}
+
+
+// Reads [ - ] digits [ . digits ] like fixed_point_from_chars, and so
+// also takes the integer part modulo 1 << integer_bits: all the digits of
+// a number are consumed, and a value out of range wraps instead of
+// failing. The integer part is accumulated here, since its digits may
+// not fit in a buffer of fixed_point_max_chars.
+
+template < class CharT, class CharTraits, class FixedPoint >
+basic_istream < CharT, CharTraits > &
+  input_fixed_point ( basic_istream < CharT, CharTraits > & i,
+                      FixedPoint & x )
+
+{
+typedef typename CharTraits :: int_type int_type ;
+typedef typename FixedPoint :: unsigned_value_type unsigned_value_type ;
+
+typename basic_istream < CharT, CharTraits > :: sentry s ( i ) ;
+
+if ( ! s )
+  return i ;
+
+CharT text [ fixed_point_max_chars < FixedPoint > ( ) ] ;
 
-error_end:
+sint size = 0,
+     fractional_digits = 0 ;
+
+unsigned_value_type integer_part ( 0 ) ;
+
+bool negative = false,
+     integer_digits = false,
+     fraction = false ;
+
+for ( int_type c = i.rdbuf ( ) -> sgetc ( ) ; ; )
+  {
+  if ( CharTraits :: eq_int_type ( c, CharTraits :: eof ( ) ) )
+    {
+    i.setstate ( ios_base :: eofbit ) ;
+    break ;
+    }
+
+  CharT ch ( CharTraits :: to_char_type ( c ) ) ;
+
+  if ( ch >= CharT ( '0' )  &&  ch <= CharT ( '9' ) )
+    {
+    // digits past the rounding position are consumed and ignored
+
+    if ( fraction )
+      {
+      if ( fractional_digits <= FixedPoint :: fractional_bits )
+        {
+        text [ size ++ ] = ch ;
+        ++ fractional_digits ;
+        }
+      }
+    else
+      {
+      // the text gets a zero integer part, added to x below
+
+      if ( ! integer_digits )
+        {
+        text [ size ++ ] = CharT ( '0' ) ;
+        integer_digits = true ;
+        }
+
+      integer_part = unsigned_value_type
+                       (   integer_part * 10
+                         + unsigned_value_type ( ch - CharT ( '0' ) ) ) ;
+      }
+    }
+  else if ( ch == CharT ( '-' )  &&  size == 0 )
+    {
+    text [ size ++ ] = ch ;
+    negative = true ;
+    }
+  else if ( ch == CharT ( '.' )  &&  ! fraction )
+    {
+    text [ size ++ ] = ch ;
+    fraction = true ;
+    }
+  else
+    break ;
+
+  c = i.rdbuf ( ) -> snextc ( ) ;
+  }
+
+if ( fixed_point_from_chars ( text, text + size, x ) == text )
+  {
+  i.setstate ( ios_base :: failbit ) ;
+  return i ;
+  }
+
+if ( FixedPoint :: fractional_bits < FixedPoint :: bit_size )
+  {
+  const unsigned_value_type
+    d ( integer_part << FixedPoint :: fractional_bits ) ;
+
+  x = FixedPoint :: from_raw_data
+                      ( unsigned_value_type
+                          (   negative
+                            ? x.unsigned_data ( ) - d
+                            : x.unsigned_data ( ) + d ) ) ;
+  }
 
-i.flags ( start_flags ) ;
 return i ;
 }
 
@@ -474,113 +662,29 @@ private:
 
 protected:
 
-  static const unsigned_value_type fractional_part_high_bit_mask ;
-  static const unsigned_value_type fractional_part_low_bits_mask ;
-  static const unsigned_value_type fractional_part_mask ;
-  static const unsigned_value_type integer_part_low_bit_mask ;
-  static const unsigned_value_type integer_part_mask ;
+  static constexpr unsigned_value_type
+    fractional_part_high_bit_mask =
+      unsigned_value_type ( 1 ) << ( fractional_bits - 1 ) ;
 
-} ;
+  static constexpr unsigned_value_type
+    fractional_part_low_bits_mask =
+      fractional_part_high_bit_mask - unsigned_value_type ( 1 ) ;
 
+  static constexpr unsigned_value_type
+    fractional_part_mask =
+      fractional_part_high_bit_mask + fractional_part_low_bits_mask ;
 
-//
-
-template < class T, sint FractionalBits >
-const typename fixed_point_base < T, FractionalBits > :: unsigned_value_type
-  fixed_point_base < T, FractionalBits > :: fractional_part_high_bit_mask =
-    unsigned_value_type ( 1 ) << ( fractional_bits - 1 ) ;
-
-
-//
-
-template < class T, sint FractionalBits >
-const typename fixed_point_base < T, FractionalBits > :: unsigned_value_type
-  fixed_point_base < T, FractionalBits > :: fractional_part_low_bits_mask =
-    fractional_part_high_bit_mask - unsigned_value_type ( 1 ) ;
+  static constexpr unsigned_value_type
+    integer_part_low_bit_mask =
+        fractional_bits < bit_size
+      ? unsigned_value_type ( 1 ) << fractional_bits
+      : 0 ;
 
+  static constexpr unsigned_value_type
+    integer_part_mask = ~ fractional_part_mask ;
 
-//
-
-template < class T, sint FractionalBits >
-const typename fixed_point_base < T, FractionalBits > :: unsigned_value_type
-  fixed_point_base < T, FractionalBits > :: fractional_part_mask =
-    fractional_part_high_bit_mask + fractional_part_low_bits_mask ;
-
-
-//
-
-template < class T, sint FractionalBits >
-const typename fixed_point_base < T, FractionalBits > :: unsigned_value_type
-  fixed_point_base < T, FractionalBits > :: integer_part_low_bit_mask =
-      fractional_bits < bit_size
-    ? unsigned_value_type ( 1 ) << fractional_bits
-    : 0 ;
-
-
-//
-
-template < class T, sint FractionalBits >
-const typename fixed_point_base < T, FractionalBits > :: unsigned_value_type
-  fixed_point_base < T, FractionalBits > :: integer_part_mask =
-    ~ fractional_part_mask  ;
-
-
-
-//
-
-#ifdef NDEBUG
-
-#define __DEFINE_FIXED_POINT_BASE(Type)                                    \
-                                                                           \
-template < sint FractionalBits >                                           \
-class fixed_point_base < Type, FractionalBits >                            \
-                                                                           \
-{                                                                          \
-public:                                                                    \
-                                                                           \
-  typedef numeric_traits < Type > :: signed_type signed_value_type ;       \
-  typedef numeric_traits < Type > :: unsigned_type unsigned_value_type ;   \
-                                                                           \
-  static constexpr sint bit_size = numeric_traits < Type > :: bit_size ;   \
-  static constexpr sint fractional_bits = FractionalBits ;                 \
-  static constexpr sint integer_bits = bit_size - fractional_bits ;        \
-                                                                           \
-private:                                                                   \
-                                                                           \
-  static_assert ( fractional_bits > 0  &&  fractional_bits <= bit_size,    \
-                  "Illegal number of fractional bits." ) ;                 \
-                                                                           \
-protected:                                                                 \
-                                                                           \
-  static constexpr unsigned_value_type                                     \
-    fractional_part_high_bit_mask =                                        \
-      unsigned_value_type ( 1 ) << ( fractional_bits - 1 ) ;               \
-                                                                           \
-  static constexpr unsigned_value_type                                     \
-    fractional_part_low_bits_mask =                                        \
-      fractional_part_high_bit_mask - unsigned_value_type ( 1 ) ;          \
-                                                                           \
-  static constexpr unsigned_value_type                                     \
-    fractional_part_mask =                                                 \
-      fractional_part_high_bit_mask + fractional_part_low_bits_mask ;      \
-                                                                           \
-  static constexpr unsigned_value_type                                     \
-    integer_part_low_bit_mask =                                            \
-        fractional_bits < bit_size                                         \
-      ? unsigned_value_type ( 1 ) << fractional_bits                       \
-      : 0 ;                                                                \
-                                                                           \
-  static constexpr unsigned_value_type                                     \
-    integer_part_mask = ~ fractional_part_mask ;                           \
-                                                                           \
 } ;
 
-FOR_BUILTIN_INTEGRAL_TYPES(__DEFINE_FIXED_POINT_BASE)
-
-#undef __DEFINE_FIXED_POINT_BASE
-
-#endif
-
 
 
 // *** SIGNED_FIXED_POINT ***
@@ -601,16 +705,6 @@ public:
   friend class type_converter < unsigned_fixed_point < T, FractionalBits >,
                                 signed_fixed_point < T, FractionalBits > > ;
 
-  template < class CharT, class CharTraits, class FixedPoint >
-  friend basic_ostream < CharT, CharTraits > &
-    output_fixed_point ( basic_ostream < CharT, CharTraits > & o,
-                         FixedPoint x ) ;
-
-  template < class CharT, class CharTraits, class FixedPoint >
-  friend basic_istream < CharT, CharTraits > &
-    input_fixed_point ( basic_istream < CharT, CharTraits > & i,
-                        FixedPoint & x ) ;
-
   using typename fixed_point_base < T, FractionalBits > :: signed_value_type ;
   using typename fixed_point_base < T, FractionalBits > :: unsigned_value_type ;
   using fixed_point_base < T, FractionalBits > :: bit_size ;
@@ -638,78 +732,75 @@ private:
 
   unsigned_value_type data ;
 
-  signed_fixed_point ( const signed_value_type & i_data, no_shift_tag ) :
-    data ( i_data )
-    { }
-
-  signed_fixed_point ( const unsigned_value_type & i_data, no_shift_tag ) :
+  constexpr signed_fixed_point ( unsigned_value_type i_data, no_shift_tag ) :
     data ( i_data )
     { }
 
-  static signed_fixed_point overflow_value ( bool negative )
+  static constexpr signed_fixed_point overflow_value ( bool negative )
     { return negative ? min ( ) : max ( ) ; }
 
-  static signed_fixed_point multiply ( const signed_fixed_point & a,
-                                       const signed_fixed_point & b ) ;
+  static constexpr signed_fixed_point
+    multiply ( const signed_fixed_point & a,
+               const signed_fixed_point & b ) ;
 
-  static signed_fixed_point divide ( const signed_fixed_point & a,
-                                     const signed_fixed_point & b ) ;
+  static constexpr signed_fixed_point divide ( const signed_fixed_point & a,
+                                               const signed_fixed_point & b ) ;
 
 public:
 
   signed_fixed_point ( )
     { }
 
-  signed_fixed_point ( const signed_value_type & x ) :
+  constexpr signed_fixed_point ( const signed_value_type & x ) :
     data (   fractional_bits < bit_size
            ? x << fractional_bits
            : 0 )
     { }
 
-  signed_fixed_point ( const unsigned_value_type & x ) :
+  constexpr signed_fixed_point ( const unsigned_value_type & x ) :
     data (   fractional_bits < bit_size
            ? x << fractional_bits
            : 0 )
     { }
 
   template < class S >
-  signed_fixed_point ( const S & x,
-                       typename implicit_conversion_test
-                                  < S, unsigned_value_type > :: result =
-                         implicit_conversion_allowed ) :
+  constexpr signed_fixed_point ( const S & x,
+                                 typename implicit_conversion_test
+                                   < S, unsigned_value_type > :: result =
+                                   implicit_conversion_allowed ) :
     data (   fractional_bits < bit_size
            ? unsigned_value_type ( x ) << fractional_bits
            : 0 )
     { }
 
-  static signed_fixed_point min ( )
+  static constexpr signed_fixed_point min ( )
     { return signed_fixed_point
                ( numeric_traits < signed_value_type > :: min ( ),
                  no_shift_tag ( ) ) ; }
 
-  static signed_fixed_point max ( )
+  static constexpr signed_fixed_point max ( )
     { return signed_fixed_point
                ( numeric_traits < signed_value_type > :: max ( ),
                  no_shift_tag ( ) ) ; }
 
-  static signed_fixed_point epsilon ( )
+  static constexpr signed_fixed_point epsilon ( )
     { return signed_fixed_point
                ( unsigned_value_type ( 1 ),
                  no_shift_tag ( ) ) ; }
 
-  signed_value_type signed_data ( ) const
+  constexpr signed_value_type signed_data ( ) const
     { return convert_to < signed_value_type > ( data ) ; }
 
-  unsigned_value_type unsigned_data ( ) const
+  constexpr unsigned_value_type unsigned_data ( ) const
     { return data ; }
 
-  bool is_high_bit_set ( ) const
+  constexpr bool is_high_bit_set ( ) const
     { return :: is_high_bit_set ( data ) ; }
 
   sint hamming_weight ( ) const
     { return :: hamming_weight ( data ) ; }
 
-  signed_value_type truncated_to_integer ( ) const
+  constexpr signed_value_type truncated_to_integer ( ) const
     { return   fractional_bits < bit_size
              ?    convert_to < signed_value_type >
                     (   :: is_high_bit_set ( data )
@@ -718,7 +809,7 @@ public:
                >> fractional_bits
              : 0 ; }
 
-  signed_value_type rounded_to_integer ( ) const
+  constexpr signed_value_type rounded_to_integer ( ) const
     { return   fractional_bits < bit_size
              ?    convert_to < signed_value_type >
                     ( data + (   :: is_high_bit_set ( data )
@@ -732,14 +823,16 @@ public:
     { return ldexp ( convert_to < FloatingPoint > ( signed_data ( ) ),
                      - fractional_bits ) ; }
 
-  static signed_fixed_point from_raw_data ( const signed_value_type & x )
+  static constexpr signed_fixed_point
+    from_raw_data ( const signed_value_type & x )
     { return signed_fixed_point ( x, no_shift_tag ( ) ) ; }
 
-  static signed_fixed_point from_raw_data ( const unsigned_value_type & x )
+  static constexpr signed_fixed_point
+    from_raw_data ( const unsigned_value_type & x )
     { return signed_fixed_point ( x, no_shift_tag ( ) ) ; }
 
   template < class S >
-  static signed_fixed_point from_raw_data ( const S & x )
+  static constexpr signed_fixed_point from_raw_data ( const S & x )
     { return signed_fixed_point ( unsigned_value_type ( x ),
                                   no_shift_tag ( ) ) ; }
 
@@ -752,136 +845,143 @@ public:
                              -1 ) ),
                  no_shift_tag ( ) ) ; }
 
-  const signed_fixed_point & operator + ( ) const
+  constexpr const signed_fixed_point & operator + ( ) const
     { return * this ; }
 
-  signed_fixed_point operator - ( ) const
+  constexpr signed_fixed_point operator - ( ) const
     { return signed_fixed_point ( - data, no_shift_tag ( ) ) ; }
 
-  friend signed_fixed_point operator + ( const signed_fixed_point & a,
-                                         const signed_fixed_point & b )
+  friend constexpr signed_fixed_point
+    operator + ( const signed_fixed_point & a,
+                 const signed_fixed_point & b )
     { return signed_fixed_point ( a.data + b.data, no_shift_tag ( ) ) ; }
 
-  friend signed_fixed_point operator - ( const signed_fixed_point & a,
-                                         const signed_fixed_point & b )
+  friend constexpr signed_fixed_point
+    operator - ( const signed_fixed_point & a,
+                 const signed_fixed_point & b )
     { return signed_fixed_point ( a.data - b.data, no_shift_tag ( ) ) ; }
 
-  friend signed_fixed_point operator * ( const signed_fixed_point & a,
-                                         const signed_fixed_point & b )
+  friend constexpr signed_fixed_point
+    operator * ( const signed_fixed_point & a,
+                 const signed_fixed_point & b )
     { return multiply ( a, b ) ; }
 
-  friend signed_fixed_point operator / ( const signed_fixed_point & a,
-                                         const signed_fixed_point & b )
+  friend constexpr signed_fixed_point
+    operator / ( const signed_fixed_point & a,
+                 const signed_fixed_point & b )
     { return divide ( a, b ) ; }
 
-  signed_fixed_point & operator += ( const signed_fixed_point & b )
+  constexpr signed_fixed_point & operator += ( const signed_fixed_point & b )
     { data += b.data ;
       return * this ; }
 
-  signed_fixed_point & operator -= ( const signed_fixed_point & b )
+  constexpr signed_fixed_point & operator -= ( const signed_fixed_point & b )
     { data -= b.data ;
       return * this ; }
 
-  signed_fixed_point & operator *= ( const signed_fixed_point & b )
+  constexpr signed_fixed_point & operator *= ( const signed_fixed_point & b )
     { return * this = * this * b ; }
 
-  signed_fixed_point & operator /= ( const signed_fixed_point & b )
+  constexpr signed_fixed_point & operator /= ( const signed_fixed_point & b )
     { return * this = * this / b ; }
 
-  signed_fixed_point & operator ++ ( )
+  constexpr signed_fixed_point & operator ++ ( )
     { if ( fractional_bits < bit_size )
         data += integer_part_low_bit_mask ;
       return * this ; }
 
-  signed_fixed_point operator ++ ( int )
+  constexpr signed_fixed_point operator ++ ( int )
     { signed_fixed_point t ( * this ) ;
       ++ * this ;
       return t ; }
 
-  signed_fixed_point & operator -- ( )
+  constexpr signed_fixed_point & operator -- ( )
     { if ( fractional_bits < bit_size )
         data -= integer_part_low_bit_mask ;
       return * this ; }
 
-  signed_fixed_point operator -- ( int )
+  constexpr signed_fixed_point operator -- ( int )
     { signed_fixed_point t ( * this ) ;
       -- * this ;
       return t ; }
 
-  signed_fixed_point operator ~ ( ) const
+  constexpr signed_fixed_point operator ~ ( ) const
     { return signed_fixed_point ( ~ data, no_shift_tag ( ) ) ; }
 
-  friend signed_fixed_point operator & ( const signed_fixed_point & a,
-                                         const signed_fixed_point & b )
+  friend constexpr signed_fixed_point
+    operator & ( const signed_fixed_point & a,
+                 const signed_fixed_point & b )
     { return signed_fixed_point ( a.data & b.data, no_shift_tag ( ) ) ; }
 
-  friend signed_fixed_point operator | ( const signed_fixed_point & a,
-                                         const signed_fixed_point & b )
+  friend constexpr signed_fixed_point
+    operator | ( const signed_fixed_point & a,
+                 const signed_fixed_point & b )
     { return signed_fixed_point ( a.data | b.data, no_shift_tag ( ) ) ; }
 
-  friend signed_fixed_point operator ^ ( const signed_fixed_point & a,
-                                         const signed_fixed_point & b )
+  friend constexpr signed_fixed_point
+    operator ^ ( const signed_fixed_point & a,
+                 const signed_fixed_point & b )
     { return signed_fixed_point ( a.data ^ b.data, no_shift_tag ( ) ) ; }
 
-  signed_fixed_point & operator &= ( const signed_fixed_point & b )
+  constexpr signed_fixed_point & operator &= ( const signed_fixed_point & b )
     { data &= b.data ;
       return * this ; }
 
-  signed_fixed_point & operator |= ( const signed_fixed_point & b )
+  constexpr signed_fixed_point & operator |= ( const signed_fixed_point & b )
     { data |= b.data ;
       return * this ; }
 
-  signed_fixed_point & operator ^= ( const signed_fixed_point & b )
+  constexpr signed_fixed_point & operator ^= ( const signed_fixed_point & b )
     { data ^= b.data ;
       return * this ; }
 
-  signed_fixed_point signed_shift_right ( sint n ) const
+  constexpr signed_fixed_point signed_shift_right ( sint n ) const
     { assert ( n >= 0  &&  n < bit_size ) ;
       return signed_fixed_point ( :: signed_shift_right ( data, n ),
                                   no_shift_tag ( ) ) ; }
 
-  signed_fixed_point unsigned_shift_right ( sint n ) const
+  constexpr signed_fixed_point unsigned_shift_right ( sint n ) const
     { assert ( n >= 0  &&  n < bit_size ) ;
       return signed_fixed_point ( data >> n, no_shift_tag ( ) ) ; }
 
-  signed_fixed_point operator << ( sint n ) const
+  constexpr signed_fixed_point operator << ( sint n ) const
     { assert ( n >= 0  &&  n < bit_size ) ;
       return signed_fixed_point ( data << n, no_shift_tag ( ) ) ; }
 
-  signed_fixed_point operator >> ( sint n ) const
+  constexpr signed_fixed_point operator >> ( sint n ) const
     { assert ( n >= 0  &&  n < bit_size ) ;
       return signed_shift_right ( n ) ; }
 
-  signed_fixed_point & operator <<= ( sint n )
+  constexpr signed_fixed_point & operator <<= ( sint n )
     { assert ( n >= 0  &&  n < bit_size ) ;
       data <<= n ;
       return * this ; }
 
-  signed_fixed_point & operator >>= ( sint n )
+  constexpr signed_fixed_point & operator >>= ( sint n )
     { assert ( n >= 0  &&  n < bit_size ) ;
-      data = signed_shift_right ( data, n ) ;
+      data = :: signed_shift_right ( data, n ) ;
       return * this ; }
 
-  friend bool operator == ( const signed_fixed_point & a,
-                            const signed_fixed_point & b )
+  friend constexpr bool operator == ( const signed_fixed_point & a,
+                                      const signed_fixed_point & b )
     { return a.data == b.data ; }
 
-  friend bool operator < ( const signed_fixed_point & a,
-                           const signed_fixed_point & b )
+  friend constexpr bool operator < ( const signed_fixed_point & a,
+                                     const signed_fixed_point & b )
     { return   convert_to < signed_value_type > ( a.data )
              < convert_to < signed_value_type > ( b.data ) ; }
 
-  friend signed_fixed_point floor ( const signed_fixed_point & x )
+  friend constexpr signed_fixed_point floor ( const signed_fixed_point & x )
     { return signed_fixed_point
                ( x.data & integer_part_mask,
                  no_shift_tag ( ) ) ; }
 
-  friend signed_fixed_point ceil ( const signed_fixed_point & x )
+  friend constexpr signed_fixed_point ceil ( const signed_fixed_point & x )
     { return signed_fixed_point
                ( ( x.data + fractional_part_mask ) & integer_part_mask,
                  no_shift_tag ( ) ) ; }
 
-  friend signed_fixed_point trunc ( const signed_fixed_point & x )
+  friend constexpr signed_fixed_point trunc ( const signed_fixed_point & x )
     { return signed_fixed_point
                (   (   :: is_high_bit_set ( x.data )
                      ? x.data + fractional_part_mask
@@ -889,7 +989,7 @@ public:
                  & integer_part_mask,
                  no_shift_tag ( ) ) ; }
 
-  friend signed_fixed_point round ( const signed_fixed_point & x )
+  friend constexpr signed_fixed_point round ( const signed_fixed_point & x )
     { return signed_fixed_point
                (   ( x.data + (   :: is_high_bit_set ( x.data )
                                 ? fractional_part_low_bits_mask
@@ -909,21 +1009,34 @@ public:
                   signed_fixed_point & x )
     { return input_fixed_point ( i, x ) ; }
 
+  template < class CharT >
+  friend CharT * to_chars ( CharT * first,
+                            CharT * last,
+                            const signed_fixed_point & x,
+                            sint precision = 6 )
+    { return fixed_point_to_chars ( first, last, x, precision ) ; }
+
+  template < class CharT >
+  friend const CharT * from_chars ( const CharT * first,
+                                    const CharT * last,
+                                    signed_fixed_point & x )
+    { return fixed_point_from_chars ( first, last, x ) ; }
+
 } ;
 
 
 //
 
 template < class T, sint FractionalBits >
-inline signed_fixed_point < T, FractionalBits >
+constexpr signed_fixed_point < T, FractionalBits >
   signed_fixed_point < T, FractionalBits > ::
     multiply ( const signed_fixed_point < T, FractionalBits > & a,
                const signed_fixed_point < T, FractionalBits > & b )
 
 {
-unsigned_value_type av, bv ;
+unsigned_value_type av ( 0 ), bv ( 0 ) ;
 
-bool negative ;
+bool negative ( false ) ;
 
 if ( is_negative ( a ) )
   {
@@ -944,7 +1057,7 @@ if ( is_negative ( b ) )
 else
   bv = b.data ;
 
-unsigned_value_type h, l ;
+unsigned_value_type h ( 0 ), l ( 0 ) ;
 unsigned_double_multiply ( av, bv, h, l ) ;
 
 l += fractional_part_high_bit_mask ;
@@ -963,7 +1076,7 @@ return signed_fixed_point ( negative ? - r : r, no_shift_tag ( ) ) ;
 //
 
 template < class T, sint FractionalBits >
-inline signed_fixed_point < T, FractionalBits >
+constexpr signed_fixed_point < T, FractionalBits >
   signed_fixed_point < T, FractionalBits > ::
     divide ( const signed_fixed_point < T, FractionalBits > & a,
              const signed_fixed_point < T, FractionalBits > & b )
@@ -971,9 +1084,9 @@ inline signed_fixed_point < T, FractionalBits >
 {
 assert ( b.data != 0 ) ;
 
-unsigned_value_type av, bv ;
+unsigned_value_type av ( 0 ), bv ( 0 ) ;
 
-bool negative ;
+bool negative ( false ) ;
 
 if ( is_negative ( a ) )
   {
@@ -1006,7 +1119,7 @@ if ( bit_shift > bit_size  &&  av >> ( bit_size * 2 - bit_shift ) != 0 )
 if ( bit_shift == bit_size * 2 )
   return signed_fixed_point ( unsigned_value_type ( 0 ), no_shift_tag ( ) ) ;
 
-unsigned_value_type h, l ;
+unsigned_value_type h ( 0 ), l ( 0 ) ;
 
 if ( bit_shift < bit_size )
   {
@@ -1051,13 +1164,13 @@ public:
   static constexpr bool has_double_size_type = false ;
   typedef void double_size_type ;
 
-  static signed_fixed_point < T, FractionalBits > min ( )
+  static constexpr signed_fixed_point < T, FractionalBits > min ( )
     { return signed_fixed_point < T, FractionalBits > :: min ( ) ; }
 
-  static signed_fixed_point < T, FractionalBits > max ( )
+  static constexpr signed_fixed_point < T, FractionalBits > max ( )
     { return signed_fixed_point < T, FractionalBits > :: max ( ) ; }
 
-  static signed_fixed_point < T, FractionalBits > epsilon ( )
+  static constexpr signed_fixed_point < T, FractionalBits > epsilon ( )
     { return signed_fixed_point < T, FractionalBits > :: epsilon ( ) ; }
 
 } ;
@@ -1104,8 +1217,8 @@ public:
 //
 
 template < class T, sint FractionalBits >
-inline bool is_negative
-              ( const signed_fixed_point < T, FractionalBits > & x )
+constexpr bool is_negative
+                 ( const signed_fixed_point < T, FractionalBits > & x )
 
 {
 return x.is_high_bit_set ( ) ;
@@ -1115,8 +1228,8 @@ return x.is_high_bit_set ( ) ;
 //
 
 template < class T, sint FractionalBits >
-inline bool is_high_bit_set
-              ( const signed_fixed_point < T, FractionalBits > & x )
+constexpr bool is_high_bit_set
+                 ( const signed_fixed_point < T, FractionalBits > & x )
 
 {
 return x.is_high_bit_set ( ) ;
@@ -1137,7 +1250,7 @@ return x.hamming_weight ( ) ;
 //
 
 template < class T, sint FractionalBits >
-inline
+constexpr
   signed_fixed_point < T, FractionalBits >
     signed_shift_right ( const signed_fixed_point < T, FractionalBits > & x,
                          sint n )
@@ -1150,7 +1263,7 @@ return x.signed_shift_right ( n ) ;
 //
 
 template < class T, sint FractionalBits >
-inline
+constexpr
   signed_fixed_point < T, FractionalBits >
     unsigned_shift_right ( const signed_fixed_point < T, FractionalBits > & x,
                            sint n )
@@ -1163,7 +1276,7 @@ return x.unsigned_shift_right ( n ) ;
 //
 
 template < class T, sint FractionalBits >
-inline sint exponent ( const signed_fixed_point < T, FractionalBits > & x )
+constexpr sint exponent ( const signed_fixed_point < T, FractionalBits > & x )
 
 {
 return exponent ( x.signed_data ( ) ) - FractionalBits ;
@@ -1233,16 +1346,6 @@ public:
   friend class type_converter < unsigned_fixed_point < T, FractionalBits >,
                                 signed_fixed_point < T, FractionalBits > > ;
 
-  template < class CharT, class CharTraits, class FixedPoint >
-  friend basic_ostream < CharT, CharTraits > &
-    output_fixed_point ( basic_ostream < CharT, CharTraits > & o,
-                         FixedPoint x ) ;
-
-  template < class CharT, class CharTraits, class FixedPoint >
-  friend basic_istream < CharT, CharTraits > &
-    input_fixed_point ( basic_istream < CharT, CharTraits > & i,
-                        FixedPoint & x ) ;
-
   using typename fixed_point_base < T, FractionalBits > :: signed_value_type ;
   using typename fixed_point_base < T, FractionalBits > :: unsigned_value_type ;
   using fixed_point_base < T, FractionalBits > :: bit_size ;
@@ -1270,87 +1373,86 @@ private:
 
   unsigned_value_type data ;
 
-  unsigned_fixed_point ( const signed_value_type & i_data, no_shift_tag ) :
-    data ( i_data )
-    { }
-
-  unsigned_fixed_point ( const unsigned_value_type & i_data, no_shift_tag ) :
+  constexpr unsigned_fixed_point ( unsigned_value_type i_data, no_shift_tag ) :
     data ( i_data )
     { }
 
-  static unsigned_fixed_point overflow_value ( )
+  static constexpr unsigned_fixed_point overflow_value ( )
     { return max ( ) ; }
 
-  static unsigned_fixed_point multiply ( const unsigned_fixed_point & a,
-                                         const unsigned_fixed_point & b ) ;
+  static constexpr unsigned_fixed_point
+    multiply ( const unsigned_fixed_point & a,
+               const unsigned_fixed_point & b ) ;
 
-  static unsigned_fixed_point divide ( const unsigned_fixed_point & a,
-                                       const unsigned_fixed_point & b ) ;
+  static constexpr unsigned_fixed_point
+    divide ( const unsigned_fixed_point & a,
+             const unsigned_fixed_point & b ) ;
 
 public:
 
   unsigned_fixed_point ( )
     { }
 
-  unsigned_fixed_point ( const signed_value_type & x ) :
+  constexpr unsigned_fixed_point ( const signed_value_type & x ) :
     data (   fractional_bits < bit_size
            ? x << fractional_bits
            : 0 )
     { }
 
-  unsigned_fixed_point ( const unsigned_value_type & x ) :
+  constexpr unsigned_fixed_point ( const unsigned_value_type & x ) :
     data (   fractional_bits < bit_size
            ? x << fractional_bits
            : 0 )
     { }
 
-  unsigned_fixed_point ( const signed_fixed_point < T, FractionalBits > & x ) :
+  constexpr unsigned_fixed_point
+              ( const signed_fixed_point < T, FractionalBits > & x ) :
     data ( x.unsigned_data ( ) )
     { }
 
   template < class S >
-  unsigned_fixed_point ( const S & x,
-                         typename implicit_conversion_test
-                                    < S, unsigned_value_type > :: result =
-                           implicit_conversion_allowed ) :
+  constexpr unsigned_fixed_point ( const S & x,
+                                   typename implicit_conversion_test
+                                     < S, unsigned_value_type > :: result =
+                                     implicit_conversion_allowed ) :
     data (   fractional_bits < bit_size
            ? unsigned_value_type ( x ) << fractional_bits
            : 0 )
     { }
 
-  static unsigned_fixed_point min ( )
+  static constexpr unsigned_fixed_point min ( )
     { return unsigned_fixed_point
                ( numeric_traits < unsigned_value_type > :: min ( ),
                  no_shift_tag ( ) ) ; }
 
-  static unsigned_fixed_point max ( )
+  static constexpr unsigned_fixed_point max ( )
     { return unsigned_fixed_point
                ( numeric_traits < unsigned_value_type > :: max ( ),
                  no_shift_tag ( ) ) ; }
 
-  static unsigned_fixed_point epsilon ( )
+  static constexpr unsigned_fixed_point epsilon ( )
     { return unsigned_fixed_point
                ( unsigned_value_type ( 1 ),
                  no_shift_tag ( ) ) ; }
 
-  signed_value_type signed_data ( ) const
+  constexpr signed_value_type signed_data ( ) const
     { return convert_to < signed_value_type > ( data ) ; }
 
-  unsigned_value_type unsigned_data ( ) const
+  constexpr unsigned_value_type unsigned_data ( ) const
     { return data ; }
 
-  bool is_high_bit_set ( ) const
+  constexpr bool is_high_bit_set ( ) const
     { return :: is_high_bit_set ( data ) ; }
 
   sint hamming_weight ( ) const
     { return :: hamming_weight ( data ) ; }
 
-  unsigned_value_type truncated_to_integer ( ) const
+  constexpr unsigned_value_type truncated_to_integer ( ) const
     { return   fractional_bits < bit_size
              ? data >> fractional_bits
              : 0 ; }
 
-  unsigned_value_type rounded_to_integer ( ) const
+  constexpr unsigned_value_type rounded_to_integer ( ) const
     { return   fractional_bits < bit_size
              ? ( data + fractional_part_high_bit_mask ) >> fractional_bits
              : 0 ; }
@@ -1360,14 +1462,16 @@ public:
     { return ldexp ( convert_to < FloatingPoint > ( data ),
                      - fractional_bits ) ; }
 
-  static unsigned_fixed_point from_raw_data ( const signed_value_type & x )
+  static constexpr unsigned_fixed_point
+    from_raw_data ( const signed_value_type & x )
     { return unsigned_fixed_point ( x, no_shift_tag ( ) ) ; }
 
-  static unsigned_fixed_point from_raw_data ( const unsigned_value_type & x )
+  static constexpr unsigned_fixed_point
+    from_raw_data ( const unsigned_value_type & x )
     { return unsigned_fixed_point ( x, no_shift_tag ( ) ) ; }
 
   template < class S >
-  static unsigned_fixed_point from_raw_data ( const S & x )
+  static constexpr unsigned_fixed_point from_raw_data ( const S & x )
     { return unsigned_fixed_point ( unsigned_value_type ( x ),
                                     no_shift_tag ( ) ) ; }
 
@@ -1378,138 +1482,152 @@ public:
                    ( ldexp ( ldexp ( x, fractional_bits + 1 ) + 1, -1 ) ),
                  no_shift_tag ( ) ) ; }
 
-  const unsigned_fixed_point & operator + ( ) const
+  constexpr const unsigned_fixed_point & operator + ( ) const
     { return * this ; }
 
-  unsigned_fixed_point operator - ( ) const
+  constexpr unsigned_fixed_point operator - ( ) const
     { return unsigned_fixed_point ( - data, no_shift_tag ( ) ) ; }
 
-  friend unsigned_fixed_point operator + ( const unsigned_fixed_point & a,
-                                           const unsigned_fixed_point & b )
+  friend constexpr unsigned_fixed_point
+    operator + ( const unsigned_fixed_point & a,
+                 const unsigned_fixed_point & b )
     { return unsigned_fixed_point ( a.data + b.data, no_shift_tag ( ) ) ; }
 
-  friend unsigned_fixed_point operator - ( const unsigned_fixed_point & a,
-                                           const unsigned_fixed_point & b )
+  friend constexpr unsigned_fixed_point
+    operator - ( const unsigned_fixed_point & a,
+                 const unsigned_fixed_point & b )
     { return unsigned_fixed_point ( a.data - b.data, no_shift_tag ( ) ) ; }
 
-  friend unsigned_fixed_point operator * ( const unsigned_fixed_point & a,
-                                           const unsigned_fixed_point & b )
+  friend constexpr unsigned_fixed_point
+    operator * ( const unsigned_fixed_point & a,
+                 const unsigned_fixed_point & b )
     { return multiply ( a, b ) ; }
 
-  friend unsigned_fixed_point operator / ( const unsigned_fixed_point & a,
-                                           const unsigned_fixed_point & b )
+  friend constexpr unsigned_fixed_point
+    operator / ( const unsigned_fixed_point & a,
+                 const unsigned_fixed_point & b )
     { return divide ( a, b ) ; }
 
-  unsigned_fixed_point & operator += ( const unsigned_fixed_point & b )
+  constexpr unsigned_fixed_point &
+    operator += ( const unsigned_fixed_point & b )
     { data += b.data ;
       return * this ; }
 
-  unsigned_fixed_point & operator -= ( const unsigned_fixed_point & b )
+  constexpr unsigned_fixed_point &
+    operator -= ( const unsigned_fixed_point & b )
     { data -= b.data ;
       return * this ; }
 
-  unsigned_fixed_point & operator *= ( const unsigned_fixed_point & b )
+  constexpr unsigned_fixed_point &
+    operator *= ( const unsigned_fixed_point & b )
     { return * this = * this * b ; }
 
-  unsigned_fixed_point & operator /= ( const unsigned_fixed_point & b )
+  constexpr unsigned_fixed_point &
+    operator /= ( const unsigned_fixed_point & b )
     { return * this = * this / b ; }
 
-  unsigned_fixed_point & operator ++ ( )
+  constexpr unsigned_fixed_point & operator ++ ( )
     { if ( fractional_bits < bit_size )
         data += integer_part_low_bit_mask ;
       return * this ; }
 
-  unsigned_fixed_point operator ++ ( int )
+  constexpr unsigned_fixed_point operator ++ ( int )
     { unsigned_fixed_point t ( * this ) ;
       ++ * this ;
       return t ; }
 
-  unsigned_fixed_point & operator -- ( )
+  constexpr unsigned_fixed_point & operator -- ( )
     { if ( fractional_bits < bit_size )
         data -= integer_part_low_bit_mask ;
       return * this ; }
 
-  unsigned_fixed_point operator -- ( int )
+  constexpr unsigned_fixed_point operator -- ( int )
     { unsigned_fixed_point t ( * this ) ;
       -- * this ;
       return t ; }
 
-  unsigned_fixed_point operator ~ ( ) const
+  constexpr unsigned_fixed_point operator ~ ( ) const
     { return unsigned_fixed_point ( ~ data, no_shift_tag ( ) ) ; }
 
-  friend unsigned_fixed_point operator & ( const unsigned_fixed_point & a,
-                                           const unsigned_fixed_point & b )
+  friend constexpr unsigned_fixed_point
+    operator & ( const unsigned_fixed_point & a,
+                 const unsigned_fixed_point & b )
     { return unsigned_fixed_point ( a.data & b.data, no_shift_tag ( ) ) ; }
 
-  friend unsigned_fixed_point operator | ( const unsigned_fixed_point & a,
-                                           const unsigned_fixed_point & b )
+  friend constexpr unsigned_fixed_point
+    operator | ( const unsigned_fixed_point & a,
+                 const unsigned_fixed_point & b )
     { return unsigned_fixed_point ( a.data | b.data, no_shift_tag ( ) ) ; }
 
-  friend unsigned_fixed_point operator ^ ( const unsigned_fixed_point & a,
-                                           const unsigned_fixed_point & b )
+  friend constexpr unsigned_fixed_point
+    operator ^ ( const unsigned_fixed_point & a,
+                 const unsigned_fixed_point & b )
     { return unsigned_fixed_point ( a.data ^ b.data, no_shift_tag ( ) ) ; }
 
-  unsigned_fixed_point & operator &= ( const unsigned_fixed_point & b )
+  constexpr unsigned_fixed_point &
+    operator &= ( const unsigned_fixed_point & b )
     { data &= b.data ;
       return * this ; }
 
-  unsigned_fixed_point & operator |= ( const unsigned_fixed_point & b )
+  constexpr unsigned_fixed_point &
+    operator |= ( const unsigned_fixed_point & b )
     { data |= b.data ;
       return * this ; }
 
-  unsigned_fixed_point & operator ^= ( const unsigned_fixed_point & b )
+  constexpr unsigned_fixed_point &
+    operator ^= ( const unsigned_fixed_point & b )
     { data ^= b.data ;
       return * this ; }
 
-  unsigned_fixed_point signed_shift_right ( sint n ) const
+  constexpr unsigned_fixed_point signed_shift_right ( sint n ) const
     { assert ( n >= 0  &&  n < bit_size ) ;
       return unsigned_fixed_point ( :: signed_shift_right ( data, n ),
                                     no_shift_tag ( ) ) ; }
 
-  unsigned_fixed_point unsigned_shift_right ( sint n ) const
+  constexpr unsigned_fixed_point unsigned_shift_right ( sint n ) const
     { assert ( n >= 0  &&  n < bit_size ) ;
       return unsigned_fixed_point ( data >> n, no_shift_tag ( ) ) ; }
 
-  unsigned_fixed_point operator << ( sint n ) const
+  constexpr unsigned_fixed_point operator << ( sint n ) const
     { assert ( n >= 0  &&  n < bit_size ) ;
       return unsigned_fixed_point ( data << n, no_shift_tag ( ) ) ; }
 
-  unsigned_fixed_point operator >> ( sint n ) const
+  constexpr unsigned_fixed_point operator >> ( sint n ) const
     { assert ( n >= 0  &&  n < bit_size ) ;
       return unsigned_shift_right ( n ) ; }
 
-  unsigned_fixed_point & operator <<= ( sint n )
+  constexpr unsigned_fixed_point & operator <<= ( sint n )
     { assert ( n >= 0  &&  n < bit_size ) ;
       data <<= n ;
       return * this ; }
 
-  unsigned_fixed_point & operator >>= ( sint n )
+  constexpr unsigned_fixed_point & operator >>= ( sint n )
     { assert ( n >= 0  &&  n < bit_size ) ;
       data >>= n ;
       return * this ; }
 
-  friend bool operator == ( const unsigned_fixed_point & a,
-                            const unsigned_fixed_point & b )
+  friend constexpr bool operator == ( const unsigned_fixed_point & a,
+                                      const unsigned_fixed_point & b )
     { return a.data == b.data ; }
 
-  friend bool operator < ( const unsigned_fixed_point & a,
-                           const unsigned_fixed_point & b )
+  friend constexpr bool operator < ( const unsigned_fixed_point & a,
+                                     const unsigned_fixed_point & b )
     { return a.data < b.data ; }
 
-  friend unsigned_fixed_point floor ( const unsigned_fixed_point & x )
+  friend constexpr unsigned_fixed_point floor ( const unsigned_fixed_point & x )
     { return unsigned_fixed_point
                ( x.data & integer_part_mask,
                  no_shift_tag ( ) ) ; }
 
-  friend unsigned_fixed_point ceil ( const unsigned_fixed_point & x )
+  friend constexpr unsigned_fixed_point ceil ( const unsigned_fixed_point & x )
     { return unsigned_fixed_point
                ( ( x.data + fractional_part_mask ) & integer_part_mask,
                  no_shift_tag ( ) ) ; }
 
-  friend unsigned_fixed_point trunc ( const unsigned_fixed_point & x )
+  friend constexpr unsigned_fixed_point trunc ( const unsigned_fixed_point & x )
     { return floor ( x ) ; }
 
-  friend unsigned_fixed_point round ( const unsigned_fixed_point & x )
+  friend constexpr unsigned_fixed_point round ( const unsigned_fixed_point & x )
     { return unsigned_fixed_point
                (   ( x.data + fractional_part_high_bit_mask )
                  & integer_part_mask,
@@ -1527,19 +1645,32 @@ public:
                   unsigned_fixed_point & x )
     { return input_fixed_point ( i, x ) ; }
 
+  template < class CharT >
+  friend CharT * to_chars ( CharT * first,
+                            CharT * last,
+                            const unsigned_fixed_point & x,
+                            sint precision = 6 )
+    { return fixed_point_to_chars ( first, last, x, precision ) ; }
+
+  template < class CharT >
+  friend const CharT * from_chars ( const CharT * first,
+                                    const CharT * last,
+                                    unsigned_fixed_point & x )
+    { return fixed_point_from_chars ( first, last, x ) ; }
+
 } ;
 
 
 //
 
 template < class T, sint FractionalBits >
-inline unsigned_fixed_point < T, FractionalBits >
+constexpr unsigned_fixed_point < T, FractionalBits >
   unsigned_fixed_point < T, FractionalBits > ::
     multiply ( const unsigned_fixed_point < T, FractionalBits > & a,
                const unsigned_fixed_point < T, FractionalBits > & b )
 
 {
-unsigned_value_type h, l ;
+unsigned_value_type h ( 0 ), l ( 0 ) ;
 unsigned_double_multiply ( a.data, b.data, h, l ) ;
 
 l += fractional_part_high_bit_mask ;
@@ -1557,7 +1688,7 @@ return unsigned_fixed_point
 //
 
 template < class T, sint FractionalBits >
-inline unsigned_fixed_point < T, FractionalBits >
+constexpr unsigned_fixed_point < T, FractionalBits >
   unsigned_fixed_point < T, FractionalBits > ::
     divide ( const unsigned_fixed_point < T, FractionalBits > & a,
              const unsigned_fixed_point < T, FractionalBits > & b )
@@ -1573,7 +1704,7 @@ bv <<= bit_shift ;
 
 bit_shift += fractional_bits + 1 ;
 
-unsigned_value_type h, l, rh ;
+unsigned_value_type h ( 0 ), l ( 0 ), rh ( 0 ) ;
 
 if ( bit_shift > bit_size )
   {
@@ -1661,13 +1792,13 @@ public:
   static constexpr bool has_double_size_type = false ;
   typedef void double_size_type ;
 
-  static unsigned_fixed_point < T, FractionalBits > min ( )
+  static constexpr unsigned_fixed_point < T, FractionalBits > min ( )
     { return unsigned_fixed_point < T, FractionalBits > :: min ( ) ; }
 
-  static unsigned_fixed_point < T, FractionalBits > max ( )
+  static constexpr unsigned_fixed_point < T, FractionalBits > max ( )
     { return unsigned_fixed_point < T, FractionalBits > :: max ( ) ; }
 
-  static unsigned_fixed_point < T, FractionalBits > epsilon ( )
+  static constexpr unsigned_fixed_point < T, FractionalBits > epsilon ( )
     { return unsigned_fixed_point < T, FractionalBits > :: epsilon ( ) ; }
 
 } ;
@@ -1714,8 +1845,8 @@ public:
 //
 
 template < class T, sint FractionalBits >
-inline bool is_negative
-              ( const unsigned_fixed_point < T, FractionalBits > & x )
+constexpr bool is_negative
+                 ( const unsigned_fixed_point < T, FractionalBits > & x )
 
 {
 return false ;
@@ -1725,8 +1856,8 @@ return false ;
 //
 
 template < class T, sint FractionalBits >
-inline bool is_high_bit_set
-              ( const unsigned_fixed_point < T, FractionalBits > & x )
+constexpr bool is_high_bit_set
+                 ( const unsigned_fixed_point < T, FractionalBits > & x )
 
 {
 return x.is_high_bit_set ( ) ;
@@ -1747,7 +1878,7 @@ return x.hamming_weight ( ) ;
 //
 
 template < class T, sint FractionalBits >
-inline
+constexpr
   unsigned_fixed_point < T, FractionalBits >
     signed_shift_right ( const unsigned_fixed_point < T, FractionalBits > & x,
                          sint n )
@@ -1760,7 +1891,7 @@ return x.signed_shift_right ( n ) ;
 //
 
 template < class T, sint FractionalBits >
-inline
+constexpr
   unsigned_fixed_point < T, FractionalBits >
     unsigned_shift_right ( const unsigned_fixed_point < T, FractionalBits > & x,
                            sint n )
@@ -1773,7 +1904,7 @@ return x.unsigned_shift_right ( n ) ;
 //
 
 template < class T, sint FractionalBits >
-inline sint exponent ( const unsigned_fixed_point < T, FractionalBits > & x )
+constexpr sint exponent ( const unsigned_fixed_point < T, FractionalBits > & x )
 
 {
 return exponent ( x.unsigned_data ( ) ) - FractionalBits ;
@@ -1848,7 +1979,7 @@ class type_converter < unsigned_fixed_point < T, FractionalBits >,
 {
 public:
 
-  static signed_fixed_point < T, FractionalBits >
+  static constexpr signed_fixed_point < T, FractionalBits >
     operate ( const unsigned_fixed_point < T, FractionalBits > & x )
     { return signed_fixed_point < T, FractionalBits >
                ( x.data,
@@ -1869,8 +2000,8 @@ class type_converter
 {
 public:
 
-  static typename signed_fixed_point < T, FractionalBits > ::
-                    signed_value_type
+  static constexpr typename signed_fixed_point < T, FractionalBits > ::
+                              signed_value_type
     operate ( const signed_fixed_point < T, FractionalBits > & x )
     { return x.truncated_to_integer ( ) ; }
 
@@ -1888,8 +2019,8 @@ class type_converter
 {
 public:
 
-  static typename unsigned_fixed_point < T, FractionalBits > ::
-                    unsigned_value_type
+  static constexpr typename unsigned_fixed_point < T, FractionalBits > ::
+                              unsigned_value_type
     operate ( const unsigned_fixed_point < T, FractionalBits > & x )
     { return x.truncated_to_integer ( ) ; }
 
@@ -1911,7 +2042,7 @@ class from_fixed_point_type_converter < FixedPoint, Destination, false >
 {
 public:
 
-  static Destination operate ( const FixedPoint & x )
+  static constexpr Destination operate ( const FixedPoint & x )
     { return convert_to < Destination > ( x.truncated_to_integer ( ) ) ; }
 
 } ;
@@ -1971,7 +2102,7 @@ class to_fixed_point_type_converter < Source, FixedPoint, false >
 {
 public:
 
-  static FixedPoint operate ( const Source & x )
+  static constexpr FixedPoint operate ( const Source & x )
     { return FixedPoint ( x ) ; }
 
 } ;
@@ -2018,4 +2149,272 @@ class type_converter < S, unsigned_fixed_point < T, FractionalBits > > :
 
 
 
+// *** FIXED_POINT_RECIPROCAL ***
+
+
+// divides by a fixed divisor with one multiplication per quotient;
+// quotients are identical to those of operator /
+
+template < class FixedPoint,
+           bool IsSigned = numeric_traits < FixedPoint > :: is_signed >
+class fixed_point_reciprocal ;
+
+
+//
+
+template < class FixedPoint >
+class fixed_point_reciprocal < FixedPoint, true >
+
+{
+public:
+
+  typedef typename FixedPoint :: unsigned_value_type unsigned_value_type ;
+
+private:
+
+  static constexpr sint bit_size = FixedPoint :: bit_size ;
+
+  FixedPoint divisor_ ;
+  unsigned_value_type normalized_divisor ;
+  unsigned_value_type reciprocal ;
+  sint bit_shift ;
+  bool negative ;
+
+public:
+
+  // pre: b != 0
+
+  explicit constexpr fixed_point_reciprocal ( const FixedPoint & b ) ;
+
+  constexpr const FixedPoint & divisor ( ) const
+    { return divisor_ ; }
+
+  constexpr FixedPoint divide ( const FixedPoint & a ) const ;
+
+  friend constexpr FixedPoint operator / ( const FixedPoint & a,
+                                           const fixed_point_reciprocal & b )
+    { return b.divide ( a ) ; }
+
+} ;
+
+
+//
+
+template < class FixedPoint >
+constexpr fixed_point_reciprocal < FixedPoint, true > ::
+            fixed_point_reciprocal ( const FixedPoint & b ) :
+  divisor_ ( b ),
+  normalized_divisor ( 0 ),
+  reciprocal ( 0 ),
+  bit_shift ( 0 ),
+  negative ( is_negative ( b ) )
+
+{
+assert ( b.unsigned_data ( ) != 0 ) ;
+
+unsigned_value_type
+  bv ( negative ? - b.unsigned_data ( ) : b.unsigned_data ( ) ) ;
+
+sint s = bit_size - exponent ( bv ) ;
+
+normalized_divisor = bv << s ;
+reciprocal = unsigned_double_reciprocal ( normalized_divisor ) ;
+bit_shift = s + FixedPoint :: fractional_bits + 1 ;
+}
+
+
+//
+
+template < class FixedPoint >
+constexpr FixedPoint
+  fixed_point_reciprocal < FixedPoint, true > ::
+    divide ( const FixedPoint & a ) const
+
+{
+unsigned_value_type av ( a.unsigned_data ( ) ) ;
+
+bool result_negative ( negative ) ;
+
+if ( is_negative ( a ) )
+  {
+  av = - av ;
+  result_negative = ! result_negative ;
+  }
+
+if ( bit_shift > bit_size  &&  av >> ( bit_size * 2 - bit_shift ) != 0 )
+  return   result_negative
+         ? numeric_traits < FixedPoint > :: min ( )
+         : numeric_traits < FixedPoint > :: max ( ) ;
+
+if ( bit_shift == bit_size * 2 )
+  return FixedPoint :: from_raw_data ( unsigned_value_type ( 0 ) ) ;
+
+unsigned_value_type h ( 0 ), l ( 0 ) ;
+
+if ( bit_shift < bit_size )
+  {
+  h = av >> ( bit_size - bit_shift ) ;
+  l = av << bit_shift ;
+  }
+else
+  {
+  h = av << ( bit_shift - bit_size ) ;
+  l = 0 ;
+  }
+
+if ( h >= normalized_divisor )
+  return   result_negative
+         ? numeric_traits < FixedPoint > :: min ( )
+         : numeric_traits < FixedPoint > :: max ( ) ;
+
+unsigned_value_type
+  r (   (   unsigned_double_divide ( h, l, normalized_divisor, reciprocal )
+          + 1 )
+      >> 1 ) ;
+
+return FixedPoint :: from_raw_data
+                      ( unsigned_value_type ( result_negative ? - r : r ) ) ;
+}
+
+
+//
+
+template < class FixedPoint >
+class fixed_point_reciprocal < FixedPoint, false >
+
+{
+public:
+
+  typedef typename FixedPoint :: unsigned_value_type unsigned_value_type ;
+
+private:
+
+  static constexpr sint bit_size = FixedPoint :: bit_size ;
+
+  FixedPoint divisor_ ;
+  unsigned_value_type normalized_divisor ;
+  unsigned_value_type reciprocal ;
+  sint bit_shift ;
+
+public:
+
+  // pre: b != 0
+
+  explicit constexpr fixed_point_reciprocal ( const FixedPoint & b ) ;
+
+  constexpr const FixedPoint & divisor ( ) const
+    { return divisor_ ; }
+
+  constexpr FixedPoint divide ( const FixedPoint & a ) const ;
+
+  friend constexpr FixedPoint operator / ( const FixedPoint & a,
+                                           const fixed_point_reciprocal & b )
+    { return b.divide ( a ) ; }
+
+} ;
+
+
+//
+
+template < class FixedPoint >
+constexpr fixed_point_reciprocal < FixedPoint, false > ::
+            fixed_point_reciprocal ( const FixedPoint & b ) :
+  divisor_ ( b ),
+  normalized_divisor ( 0 ),
+  reciprocal ( 0 ),
+  bit_shift ( 0 )
+
+{
+assert ( b.unsigned_data ( ) != 0 ) ;
+
+unsigned_value_type bv ( b.unsigned_data ( ) ) ;
+
+sint s = bit_size - exponent ( bv ) ;
+
+normalized_divisor = bv << s ;
+reciprocal = unsigned_double_reciprocal ( normalized_divisor ) ;
+bit_shift = s + FixedPoint :: fractional_bits + 1 ;
+}
+
+
+//
+
+template < class FixedPoint >
+constexpr FixedPoint
+  fixed_point_reciprocal < FixedPoint, false > ::
+    divide ( const FixedPoint & a ) const
+
+{
+const unsigned_value_type bv ( normalized_divisor ) ;
+
+unsigned_value_type av ( a.unsigned_data ( ) ) ;
+
+unsigned_value_type h ( 0 ), l ( 0 ), rh ( 0 ) ;
+
+if ( bit_shift > bit_size )
+  {
+  unsigned_value_type c ( av >> ( bit_size * 2 - bit_shift ) ) ;
+
+  if ( c > 1 )
+    return numeric_traits < FixedPoint > :: max ( ) ;
+
+  h = av << ( bit_shift - bit_size ) ;
+  l = 0 ;
+
+  if ( c == 1 )
+    {
+    unsigned_value_type hn ( h - bv ) ;
+
+    if ( hn <= h )
+      return numeric_traits < FixedPoint > :: max ( ) ;
+
+    h = hn ;
+    rh = 1 ;
+    }
+  else
+    rh = 0 ;
+  }
+else
+  {
+  if ( bit_shift < bit_size )
+    {
+    h = av >> ( bit_size - bit_shift ) ;
+    l = av << bit_shift ;
+    }
+  else
+    {
+    h = av ;
+    l = 0 ;
+    }
+
+  rh = 0 ;
+  }
+
+if ( h >= bv )
+  {
+  if ( rh > 0 )
+    return numeric_traits < FixedPoint > :: max ( ) ;
+
+  h -= bv ;
+  rh = 1 ;
+  }
+
+unsigned_value_type
+  r ( unsigned_double_divide ( h, l, bv, reciprocal ) + 1 ) ;
+
+if ( r == 0 )
+  {
+  if ( rh > 0 )
+    return numeric_traits < FixedPoint > :: max ( ) ;
+
+  rh = 1 ;
+  }
+
+return FixedPoint :: from_raw_data
+                      (   ( rh << ( bit_size - 1 ) )
+                        | unsigned_value_type ( r >> 1 ) ) ;
+}
+
+
+
 #endif
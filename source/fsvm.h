@@ -20,10 +20,12 @@
 #include "functional.h"
 #include "numeric.h"
 #include "complex.h"
+#include "type_traits.h"
 
 #include "streaming.h"
 #include "funtr.h"
 #include "numbase.h"
+#include "cpufeat.h"
 
 
 
@@ -286,11 +288,767 @@ return result ;
 
 
 
+// *** FS_VECTOR KERNELS ***
+
+
+// The element-wise operations, inner products, norms and distances of
+// fs_vector < double, N > for N = 3, 4 and 8 and of fs_vector < float, N >
+// for N = 4, 8 and 16, and the products of fs_matrix with rows of these
+// types, use SSE2 kernels, with AVX ones for 32 bytes of lanes when the
+// translation unit is compiled for AVX. The instruction set is chosen at
+// compile time, since a run time test would cost more than operations of
+// this size. Defining CPPEXTS_NO_SIMD disables the kernels.
+
+#if     defined(__x86_simd__) \
+    &&  defined(__SSE2__)
+
+  #define __fsvm_simd__
+
+#endif
+
+
+// returns: whether SIMD kernels exist for fs_vector < T, N >
+
+template < class T, size_t N >
+constexpr bool fs_vector_simd_enabled ( )
+
+{
+#ifdef __fsvm_simd__
+  return     (     is_same_v < T, double >
+               &&  ( N == 3  ||  N == 4  ||  N == 8 ) )
+         ||  (     is_same_v < T, float >
+               &&  ( N == 4  ||  N == 8  ||  N == 16 ) ) ;
+#else
+  return false ;
+#endif
+}
+
+
+// returns: alignment of fs_vector < T, N > and of fs_matrix < T, N1, N >,
+//          such that loads of 16 or 32 bytes of lanes by the SIMD kernels
+//          never cross a cache line
+
+template < class T, size_t N >
+constexpr size_t fs_vector_alignment ( )
+
+{
+return       fs_vector_simd_enabled < T, N > ( )
+         &&  N * sizeof ( T ) % 16 == 0
+       ? ( N * sizeof ( T ) < 32 ? N * sizeof ( T ) : 32 )
+       : alignof ( T ) ;
+}
+
+
+//
+
+template < class T, size_t N, bool Simd = fs_vector_simd_enabled < T, N > ( ) >
+class fs_vector_kernels ;
+
+
+// Kernels used when no SIMD kernels exist for fs_vector < T, N >. They
+// operate on arrays of N elements, and sums are accumulated from the first
+// element to the last.
+
+template < class T, size_t N >
+class fs_vector_kernels < T, N, false >
+
+{
+public:
+
+  static void add ( const T * a, const T * b, T * result )
+    { transform ( a, a + N, b, result, plus < T > ( ) ) ; }
+
+  static void subtract ( const T * a, const T * b, T * result )
+    { transform ( a, a + N, b, result, minus < T > ( ) ) ; }
+
+  static void negate ( const T * a, T * result )
+    { transform ( a, a + N, result, :: negate < T > ( ) ) ; }
+
+  static void multiply ( const T * a, const T & b, T * result )
+    { transform ( a, a + N, result,
+                  [ & ] ( const T & x ) { return x * b ; } ) ; }
+
+  static void multiply ( const T & a, const T * b, T * result )
+    { transform ( b, b + N, result,
+                  [ & ] ( const T & x ) { return a * x ; } ) ; }
+
+  static void divide ( const T * a, const T & b, T * result )
+    { transform ( a, a + N, result,
+                  [ & ] ( const T & x ) { return x / b ; } ) ; }
+
+  static void add_assign ( T * a, const T * b )
+    { for_pairs ( a, a + N,
+                  b,
+                  [ ] ( T & x, const T & y ) { x += y ; } ) ; }
+
+  static void subtract_assign ( T * a, const T * b )
+    { for_pairs ( a, a + N,
+                  b,
+                  [ ] ( T & x, const T & y ) { x -= y ; } ) ; }
+
+  static void multiply_assign ( T * a, const T & b )
+    { for ( size_t i = 0 ; i < N ; ++ i )
+        a [ i ] *= b ; }
+
+  static void divide_assign ( T * a, const T & b )
+    { for ( size_t i = 0 ; i < N ; ++ i )
+        a [ i ] /= b ; }
+
+  // result = weights [ 0 ] * rows [ 0 ] + weights [ 1 ] * rows [ 1 ] + ...
+  //          + weights [ n - 1 ] * rows [ n - 1 ], summed in this order,
+  //          rows being n consecutive arrays of N elements
+
+  static void linear_combination ( const T * weights,
+                                   const T * rows,
+                                   size_t n,
+                                   T * result )
+    { for ( size_t i = 0 ; i < N ; ++ i )
+        { T s ( 0 ) ;
+          for ( size_t l = 0 ; l < n ; ++ l )
+            s += weights [ l ] * rows [ l * N + i ] ;
+          result [ i ] = s ; } }
+
+  static T dot ( const T * a, const T * b )
+    { return :: inner_product ( a, a + N,
+                                b,
+                                T ( 0 ) ) ; }
+
+  static T inner_product ( const T * a, const T * b )
+    { return :: inner_product ( a, a + N,
+                                b,
+                                T ( 0 ),
+                                plus < T > ( ),
+                                [ ] ( const T & x, const T & y )
+                                  { return inner_product_multiply
+                                             ( x, y ) ; } ) ; }
+
+  static auto sum_l1_norms ( const T * a )
+    { typedef remove_reference_t
+                < decltype ( l1_norm ( declval < T > ( ) ) ) >
+              result_type ;
+      return accumulate ( a, a + N,
+                          result_type ( 0 ),
+                          [ ] ( const result_type & x, const T & y )
+                            { return x + l1_norm ( y ) ; } ) ; }
+
+  static auto sum_l1_distances ( const T * a, const T * b )
+    { typedef remove_reference_t
+                < decltype ( l1_distance ( declval < T > ( ),
+                                           declval < T > ( ) ) ) >
+              result_type ;
+      return :: inner_product ( a, a + N,
+                                b,
+                                result_type ( 0 ),
+                                plus < result_type > ( ),
+                                [ ] ( const T & x, const T & y )
+                                  { return l1_distance ( x, y ) ; } ) ; }
+
+  static auto sum_sqr_l2_norms ( const T * a )
+    { typedef remove_reference_t
+                < decltype ( sqr_l2_norm ( declval < T > ( ) ) ) >
+              result_type ;
+      return accumulate ( a, a + N,
+                          result_type ( 0 ),
+                          [ ] ( const result_type & x, const T & y )
+                            { return x + sqr_l2_norm ( y ) ; } ) ; }
+
+  static auto sum_sqr_l2_distances ( const T * a, const T * b )
+    { typedef remove_reference_t
+                < decltype ( sqr_l2_distance ( declval < T > ( ),
+                                               declval < T > ( ) ) ) >
+              result_type ;
+      return :: inner_product ( a, a + N,
+                                b,
+                                result_type ( 0 ),
+                                plus < result_type > ( ),
+                                [ ] ( const T & x, const T & y )
+                                  { return sqr_l2_distance ( x, y ) ; } ) ; }
+
+  static auto max_linf_norm ( const T * a )
+    { typedef remove_reference_t
+                < decltype ( linf_norm ( declval < T > ( ) ) ) >
+              result_type ;
+      return accumulate ( a, a + N,
+                          result_type ( 0 ),
+                          [ ] ( const result_type & x, const T & y )
+                            { return max ( x, linf_norm ( y ) ) ; } ) ; }
+
+  static auto max_linf_distance ( const T * a, const T * b )
+    { typedef remove_reference_t
+                < decltype ( linf_distance ( declval < T > ( ),
+                                             declval < T > ( ) ) ) >
+              result_type ;
+      return :: inner_product ( a, a + N,
+                                b,
+                                result_type ( 0 ),
+                                [ ] ( const result_type & x,
+                                      const result_type & y )
+                                  { return max ( x, y ) ; },
+                                [ ] ( const T & x, const T & y )
+                                  { return linf_distance ( x, y ) ; } ) ; }
+
+} ;
+
+
+#ifdef __fsvm_simd__
+
+
+// 16 bytes of float or double lanes
+
+template < class T >
+class __fs_simd_half ;
+
+
+//
+
+template < >
+class __fs_simd_half < double >
+
+{
+public:
+
+  static constexpr size_t lanes = 2 ;
+
+  __m128d x ;
+
+  explicit __fs_simd_half ( __m128d i_x ) :
+    x ( i_x )
+    { }
+
+  explicit __fs_simd_half ( double a ) :
+    x ( _mm_set1_pd ( a ) )
+    { }
+
+  static __fs_simd_half load ( const double * p )
+    { return __fs_simd_half ( _mm_loadu_pd ( p ) ) ; }
+
+  void store ( double * p ) const
+    { _mm_storeu_pd ( p, x ) ; }
+
+  // returns: x [ 0 ] + x [ 1 ]
+
+  double sum ( ) const
+    { return _mm_cvtsd_f64 ( _mm_add_sd ( x, _mm_unpackhi_pd ( x, x ) ) ) ; }
+
+  // returns: max ( x [ 0 ], x [ 1 ] )
+
+  double max_lane ( ) const
+    { return _mm_cvtsd_f64 ( _mm_max_sd ( _mm_unpackhi_pd ( x, x ), x ) ) ; }
+
+  friend __fs_simd_half operator + ( const __fs_simd_half & a,
+                                     const __fs_simd_half & b )
+    { return __fs_simd_half ( _mm_add_pd ( a.x, b.x ) ) ; }
+
+  friend __fs_simd_half operator - ( const __fs_simd_half & a,
+                                     const __fs_simd_half & b )
+    { return __fs_simd_half ( _mm_sub_pd ( a.x, b.x ) ) ; }
+
+  friend __fs_simd_half operator * ( const __fs_simd_half & a,
+                                     const __fs_simd_half & b )
+    { return __fs_simd_half ( _mm_mul_pd ( a.x, b.x ) ) ; }
+
+  friend __fs_simd_half operator / ( const __fs_simd_half & a,
+                                     const __fs_simd_half & b )
+    { return __fs_simd_half ( _mm_div_pd ( a.x, b.x ) ) ; }
+
+  friend __fs_simd_half operator - ( const __fs_simd_half & a )
+    { return __fs_simd_half ( _mm_xor_pd ( a.x, _mm_set1_pd ( -0.0 ) ) ) ; }
+
+  friend __fs_simd_half abs ( const __fs_simd_half & a )
+    { return __fs_simd_half ( _mm_andnot_pd ( _mm_set1_pd ( -0.0 ), a.x ) ) ; }
+
+  // like :: max, b if a < b, and a otherwise
+
+  friend __fs_simd_half max ( const __fs_simd_half & a,
+                              const __fs_simd_half & b )
+    { return __fs_simd_half ( _mm_max_pd ( b.x, a.x ) ) ; }
+
+} ;
+
+
+//
+
+template < >
+class __fs_simd_half < float >
+
+{
+public:
+
+  static constexpr size_t lanes = 4 ;
+
+  __m128 x ;
+
+  explicit __fs_simd_half ( __m128 i_x ) :
+    x ( i_x )
+    { }
+
+  explicit __fs_simd_half ( float a ) :
+    x ( _mm_set1_ps ( a ) )
+    { }
+
+  static __fs_simd_half load ( const float * p )
+    { return __fs_simd_half ( _mm_loadu_ps ( p ) ) ; }
+
+  void store ( float * p ) const
+    { _mm_storeu_ps ( p, x ) ; }
+
+  // returns: ( x [ 0 ] + x [ 2 ] ) + ( x [ 1 ] + x [ 3 ] )
+
+  float sum ( ) const
+    { __m128 t = _mm_add_ps ( x, _mm_movehl_ps ( x, x ) ) ;
+      return _mm_cvtss_f32
+               ( _mm_add_ss ( t, _mm_shuffle_ps ( t, t, 1 ) ) ) ; }
+
+  // returns: max ( max ( x [ 0 ], x [ 2 ] ), max ( x [ 1 ], x [ 3 ] ) )
+
+  float max_lane ( ) const
+    { __m128 t = _mm_max_ps ( _mm_movehl_ps ( x, x ), x ) ;
+      return _mm_cvtss_f32
+               ( _mm_max_ss ( _mm_shuffle_ps ( t, t, 1 ), t ) ) ; }
+
+  friend __fs_simd_half operator + ( const __fs_simd_half & a,
+                                     const __fs_simd_half & b )
+    { return __fs_simd_half ( _mm_add_ps ( a.x, b.x ) ) ; }
+
+  friend __fs_simd_half operator - ( const __fs_simd_half & a,
+                                     const __fs_simd_half & b )
+    { return __fs_simd_half ( _mm_sub_ps ( a.x, b.x ) ) ; }
+
+  friend __fs_simd_half operator * ( const __fs_simd_half & a,
+                                     const __fs_simd_half & b )
+    { return __fs_simd_half ( _mm_mul_ps ( a.x, b.x ) ) ; }
+
+  friend __fs_simd_half operator / ( const __fs_simd_half & a,
+                                     const __fs_simd_half & b )
+    { return __fs_simd_half ( _mm_div_ps ( a.x, b.x ) ) ; }
+
+  friend __fs_simd_half operator - ( const __fs_simd_half & a )
+    { return __fs_simd_half ( _mm_xor_ps ( a.x, _mm_set1_ps ( -0.0f ) ) ) ; }
+
+  friend __fs_simd_half abs ( const __fs_simd_half & a )
+    { return __fs_simd_half
+               ( _mm_andnot_ps ( _mm_set1_ps ( -0.0f ), a.x ) ) ; }
+
+  // like :: max, b if a < b, and a otherwise
+
+  friend __fs_simd_half max ( const __fs_simd_half & a,
+                              const __fs_simd_half & b )
+    { return __fs_simd_half ( _mm_max_ps ( b.x, a.x ) ) ; }
+
+} ;
+
+
+// 32 bytes of float or double lanes, as two halves, lo holding the first
+// lanes. The AVX specializations below reduce their lanes in the same
+// order, so that the results do not depend on whether AVX is used.
+
+template < class T >
+class __fs_simd_block
+
+{
+public:
+
+  typedef __fs_simd_half < T > half ;
+
+  static constexpr size_t lanes = 2 * half :: lanes ;
+
+  half lo, hi ;
+
+  __fs_simd_block ( const half & i_lo, const half & i_hi ) :
+    lo ( i_lo ),
+    hi ( i_hi )
+    { }
+
+  explicit __fs_simd_block ( T a ) :
+    lo ( a ),
+    hi ( a )
+    { }
+
+  static __fs_simd_block load ( const T * p )
+    { return __fs_simd_block ( half :: load ( p ),
+                               half :: load ( p + half :: lanes ) ) ; }
+
+  void store ( T * p ) const
+    { lo.store ( p ) ;
+      hi.store ( p + half :: lanes ) ; }
+
+  T sum ( ) const
+    { return ( lo + hi ).sum ( ) ; }
+
+  T max_lane ( ) const
+    { return max ( lo, hi ).max_lane ( ) ; }
+
+  friend __fs_simd_block operator + ( const __fs_simd_block & a,
+                                      const __fs_simd_block & b )
+    { return __fs_simd_block ( a.lo + b.lo, a.hi + b.hi ) ; }
+
+  friend __fs_simd_block operator - ( const __fs_simd_block & a,
+                                      const __fs_simd_block & b )
+    { return __fs_simd_block ( a.lo - b.lo, a.hi - b.hi ) ; }
+
+  friend __fs_simd_block operator * ( const __fs_simd_block & a,
+                                      const __fs_simd_block & b )
+    { return __fs_simd_block ( a.lo * b.lo, a.hi * b.hi ) ; }
+
+  friend __fs_simd_block operator / ( const __fs_simd_block & a,
+                                      const __fs_simd_block & b )
+    { return __fs_simd_block ( a.lo / b.lo, a.hi / b.hi ) ; }
+
+  friend __fs_simd_block operator - ( const __fs_simd_block & a )
+    { return __fs_simd_block ( - a.lo, - a.hi ) ; }
+
+  friend __fs_simd_block abs ( const __fs_simd_block & a )
+    { return __fs_simd_block ( abs ( a.lo ), abs ( a.hi ) ) ; }
+
+  friend __fs_simd_block max ( const __fs_simd_block & a,
+                               const __fs_simd_block & b )
+    { return __fs_simd_block ( max ( a.lo, b.lo ), max ( a.hi, b.hi ) ) ; }
+
+} ;
+
+
+#ifdef __AVX__
+
+
+//
+
+template < >
+class __fs_simd_block < double >
+
+{
+public:
+
+  typedef __fs_simd_half < double > half ;
+
+  static constexpr size_t lanes = 4 ;
+
+  __m256d x ;
+
+  explicit __fs_simd_block ( __m256d i_x ) :
+    x ( i_x )
+    { }
+
+  explicit __fs_simd_block ( double a ) :
+    x ( _mm256_set1_pd ( a ) )
+    { }
+
+  static __fs_simd_block load ( const double * p )
+    { return __fs_simd_block ( _mm256_loadu_pd ( p ) ) ; }
+
+  void store ( double * p ) const
+    { _mm256_storeu_pd ( p, x ) ; }
+
+  half lo ( ) const
+    { return half ( _mm256_castpd256_pd128 ( x ) ) ; }
+
+  half hi ( ) const
+    { return half ( _mm256_extractf128_pd ( x, 1 ) ) ; }
+
+  double sum ( ) const
+    { return ( lo ( ) + hi ( ) ).sum ( ) ; }
+
+  double max_lane ( ) const
+    { return max ( lo ( ), hi ( ) ).max_lane ( ) ; }
+
+  friend __fs_simd_block operator + ( const __fs_simd_block & a,
+                                      const __fs_simd_block & b )
+    { return __fs_simd_block ( _mm256_add_pd ( a.x, b.x ) ) ; }
+
+  friend __fs_simd_block operator - ( const __fs_simd_block & a,
+                                      const __fs_simd_block & b )
+    { return __fs_simd_block ( _mm256_sub_pd ( a.x, b.x ) ) ; }
+
+  friend __fs_simd_block operator * ( const __fs_simd_block & a,
+                                      const __fs_simd_block & b )
+    { return __fs_simd_block ( _mm256_mul_pd ( a.x, b.x ) ) ; }
+
+  friend __fs_simd_block operator / ( const __fs_simd_block & a,
+                                      const __fs_simd_block & b )
+    { return __fs_simd_block ( _mm256_div_pd ( a.x, b.x ) ) ; }
+
+  friend __fs_simd_block operator - ( const __fs_simd_block & a )
+    { return __fs_simd_block
+               ( _mm256_xor_pd ( a.x, _mm256_set1_pd ( -0.0 ) ) ) ; }
+
+  friend __fs_simd_block abs ( const __fs_simd_block & a )
+    { return __fs_simd_block
+               ( _mm256_andnot_pd ( _mm256_set1_pd ( -0.0 ), a.x ) ) ; }
+
+  friend __fs_simd_block max ( const __fs_simd_block & a,
+                               const __fs_simd_block & b )
+    { return __fs_simd_block ( _mm256_max_pd ( b.x, a.x ) ) ; }
+
+} ;
+
+
+//
+
+template < >
+class __fs_simd_block < float >
+
+{
+public:
+
+  typedef __fs_simd_half < float > half ;
+
+  static constexpr size_t lanes = 8 ;
+
+  __m256 x ;
+
+  explicit __fs_simd_block ( __m256 i_x ) :
+    x ( i_x )
+    { }
+
+  explicit __fs_simd_block ( float a ) :
+    x ( _mm256_set1_ps ( a ) )
+    { }
+
+  static __fs_simd_block load ( const float * p )
+    { return __fs_simd_block ( _mm256_loadu_ps ( p ) ) ; }
+
+  void store ( float * p ) const
+    { _mm256_storeu_ps ( p, x ) ; }
+
+  half lo ( ) const
+    { return half ( _mm256_castps256_ps128 ( x ) ) ; }
+
+  half hi ( ) const
+    { return half ( _mm256_extractf128_ps ( x, 1 ) ) ; }
+
+  float sum ( ) const
+    { return ( lo ( ) + hi ( ) ).sum ( ) ; }
+
+  float max_lane ( ) const
+    { return max ( lo ( ), hi ( ) ).max_lane ( ) ; }
+
+  friend __fs_simd_block operator + ( const __fs_simd_block & a,
+                                      const __fs_simd_block & b )
+    { return __fs_simd_block ( _mm256_add_ps ( a.x, b.x ) ) ; }
+
+  friend __fs_simd_block operator - ( const __fs_simd_block & a,
+                                      const __fs_simd_block & b )
+    { return __fs_simd_block ( _mm256_sub_ps ( a.x, b.x ) ) ; }
+
+  friend __fs_simd_block operator * ( const __fs_simd_block & a,
+                                      const __fs_simd_block & b )
+    { return __fs_simd_block ( _mm256_mul_ps ( a.x, b.x ) ) ; }
+
+  friend __fs_simd_block operator / ( const __fs_simd_block & a,
+                                      const __fs_simd_block & b )
+    { return __fs_simd_block ( _mm256_div_ps ( a.x, b.x ) ) ; }
+
+  friend __fs_simd_block operator - ( const __fs_simd_block & a )
+    { return __fs_simd_block
+               ( _mm256_xor_ps ( a.x, _mm256_set1_ps ( -0.0f ) ) ) ; }
+
+  friend __fs_simd_block abs ( const __fs_simd_block & a )
+    { return __fs_simd_block
+               ( _mm256_andnot_ps ( _mm256_set1_ps ( -0.0f ), a.x ) ) ; }
+
+  friend __fs_simd_block max ( const __fs_simd_block & a,
+                               const __fs_simd_block & b )
+    { return __fs_simd_block ( _mm256_max_ps ( b.x, a.x ) ) ; }
+
+} ;
+
+
+#endif
+
+
+// SIMD kernels for fs_vector < float, N > and fs_vector < double, N >.
+// The arrays are split into blocks of 32 bytes or one half block of 16
+// bytes, followed by the remaining elements.
+//
+// Element-wise operations and linear combinations, and so the products
+// fs_vector * fs_matrix and fs_matrix * fs_matrix, give the same results
+// as the generic kernels. Inner products, and so fs_matrix * fs_vector,
+// and the l1 and squared l2 norms and distances sum the lanes of a block
+// separately and add them up afterwards, so that they differ from the
+// generic results only by rounding, by at most 2 ( N - 1 ) u times the sum
+// of the absolute values of the terms, u being the unit roundoff
+// numeric_limits < T > :: epsilon ( ) / 2. The l-infinity norms and
+// distances are exact, NaN elements being skipped like by the generic
+// kernels. Results may differ further if the compiler is allowed to
+// contract multiplications and additions of the generic kernels into fused
+// multiply-add instructions.
+
+template < class T, size_t N >
+class fs_vector_kernels < T, N, true >
+
+{
+private:
+
+  typedef __fs_simd_block < T > block ;
+  typedef __fs_simd_half < T > half ;
+
+  static constexpr size_t blocks = N / block :: lanes,
+                          halves = N % block :: lanes / half :: lanes,
+                          half_begin = blocks * block :: lanes,
+                          scalars_begin = N - N % half :: lanes ;
+
+  // result [ i ] = f ( a [ i ], b [ i ] ), f being applied to blocks,
+  // halves and elements
+
+  template < class F >
+  static void transform ( const T * a, const T * b, T * result, F f )
+    { for ( size_t i = 0 ; i < half_begin ; i += block :: lanes )
+        f ( block :: load ( a + i ),
+            block :: load ( b + i ) ).store ( result + i ) ;
+      if ( halves != 0 )
+        f ( half :: load ( a + half_begin ),
+            half :: load ( b + half_begin ) ).store ( result + half_begin ) ;
+      for ( size_t i = scalars_begin ; i < N ; ++ i )
+        result [ i ] = f ( a [ i ], b [ i ] ) ; }
+
+  // returns: lanes i, i + 1, ... of linear_combination ( weights, rows, n )
+
+  template < class Lanes >
+  static Lanes combination ( const T * weights,
+                             const T * rows,
+                             size_t n,
+                             size_t i )
+    { Lanes s ( T ( 0 ) ) ;
+      for ( size_t l = 0 ; l < n ; ++ l )
+        s = s + Lanes ( weights [ l ] ) * Lanes :: load ( rows + l * N + i ) ;
+      return s ; }
+
+  // returns: sum of f ( a [ i ], b [ i ] )
+
+  template < class F >
+  static T sum ( const T * a, const T * b, F f )
+    { T s ( 0 ) ;
+      if ( blocks != 0 )
+        { block t ( f ( block :: load ( a ), block :: load ( b ) ) ) ;
+          for ( size_t i = block :: lanes ; i < half_begin ;
+                i += block :: lanes )
+            t = t + f ( block :: load ( a + i ), block :: load ( b + i ) ) ;
+          s += t.sum ( ) ; }
+      if ( halves != 0 )
+        s += f ( half :: load ( a + half_begin ),
+                 half :: load ( b + half_begin ) ).sum ( ) ;
+      for ( size_t i = scalars_begin ; i < N ; ++ i )
+        s += f ( a [ i ], b [ i ] ) ;
+      return s ; }
+
+  // returns: maximum of f ( a [ i ], b [ i ] ) and 0
+  //
+  // The lanes start at 0 like s, so that max skips NaN values of f as the
+  // generic kernels do, and no lane is NaN when they are merged.
+
+  template < class F >
+  static T maximum ( const T * a, const T * b, F f )
+    { T s ( 0 ) ;
+      if ( blocks != 0 )
+        { block t ( T ( 0 ) ) ;
+          for ( size_t i = 0 ; i < half_begin ; i += block :: lanes )
+            t = max ( t, f ( block :: load ( a + i ),
+                             block :: load ( b + i ) ) ) ;
+          s = max ( s, t.max_lane ( ) ) ; }
+      if ( halves != 0 )
+        s = max ( s, max ( half ( T ( 0 ) ),
+                           f ( half :: load ( a + half_begin ),
+                               half :: load ( b + half_begin ) ) )
+                       .max_lane ( ) ) ;
+      for ( size_t i = scalars_begin ; i < N ; ++ i )
+        s = max ( s, f ( a [ i ], b [ i ] ) ) ;
+      return s ; }
+
+public:
+
+  static void add ( const T * a, const T * b, T * result )
+    { transform ( a, b, result,
+                  [ ] ( auto x, auto y ) { return x + y ; } ) ; }
+
+  static void subtract ( const T * a, const T * b, T * result )
+    { transform ( a, b, result,
+                  [ ] ( auto x, auto y ) { return x - y ; } ) ; }
+
+  static void negate ( const T * a, T * result )
+    { transform ( a, a, result,
+                  [ ] ( auto x, auto ) { return - x ; } ) ; }
+
+  static void multiply ( const T * a, const T & b, T * result )
+    { transform ( a, a, result,
+                  [ s = b ] ( auto x, auto )
+                    { return x * decltype ( x ) ( s ) ; } ) ; }
+
+  static void multiply ( const T & a, const T * b, T * result )
+    { multiply ( b, a, result ) ; }
+
+  static void divide ( const T * a, const T & b, T * result )
+    { transform ( a, a, result,
+                  [ s = b ] ( auto x, auto )
+                    { return x / decltype ( x ) ( s ) ; } ) ; }
+
+  static void add_assign ( T * a, const T * b )
+    { add ( a, b, a ) ; }
+
+  static void subtract_assign ( T * a, const T * b )
+    { subtract ( a, b, a ) ; }
+
+  static void multiply_assign ( T * a, const T & b )
+    { multiply ( a, b, a ) ; }
+
+  static void divide_assign ( T * a, const T & b )
+    { divide ( a, b, a ) ; }
+
+  static void linear_combination ( const T * weights,
+                                   const T * rows,
+                                   size_t n,
+                                   T * result )
+    { for ( size_t i = 0 ; i < half_begin ; i += block :: lanes )
+        combination < block > ( weights, rows, n, i ).store ( result + i ) ;
+      if ( halves != 0 )
+        combination < half > ( weights, rows, n, half_begin )
+          .store ( result + half_begin ) ;
+      for ( size_t i = scalars_begin ; i < N ; ++ i )
+        { T s ( 0 ) ;
+          for ( size_t l = 0 ; l < n ; ++ l )
+            s += weights [ l ] * rows [ l * N + i ] ;
+          result [ i ] = s ; } }
+
+  static T dot ( const T * a, const T * b )
+    { return sum ( a, b, [ ] ( auto x, auto y ) { return x * y ; } ) ; }
+
+  static T inner_product ( const T * a, const T * b )
+    { return dot ( a, b ) ; }
+
+  static T sum_l1_norms ( const T * a )
+    { return sum ( a, a, [ ] ( auto x, auto ) { return abs ( x ) ; } ) ; }
+
+  static T sum_l1_distances ( const T * a, const T * b )
+    { return sum ( a, b,
+                   [ ] ( auto x, auto y ) { return abs ( y - x ) ; } ) ; }
+
+  static T sum_sqr_l2_norms ( const T * a )
+    { return sum ( a, a, [ ] ( auto x, auto ) { return x * x ; } ) ; }
+
+  static T sum_sqr_l2_distances ( const T * a, const T * b )
+    { return sum ( a, b,
+                   [ ] ( auto x, auto y )
+                     { auto d = y - x ;
+                       return d * d ; } ) ; }
+
+  static T max_linf_norm ( const T * a )
+    { return maximum ( a, a,
+                       [ ] ( auto x, auto ) { return abs ( x ) ; } ) ; }
+
+  static T max_linf_distance ( const T * a, const T * b )
+    { return maximum ( a, b,
+                       [ ] ( auto x, auto y ) { return abs ( y - x ) ; } ) ; }
+
+} ;
+
+
+#endif
+
+
+
 // *** FS_VECTOR ***
 
 
 template < class T, size_t N >
-class fs_vector
+class alignas ( fs_vector_alignment < T, N > ( ) ) fs_vector
 
 {
 public:
@@ -314,6 +1072,12 @@ public:
   typedef :: reverse_iterator < iterator > reverse_iterator ;
   typedef :: reverse_iterator < const_iterator > const_reverse_iterator ;
 
+private:
+
+  typedef fs_vector_kernels < T, N > kernels ;
+
+public:
+
   T elements [ N ] ;
 
   pointer data ( ) noexcept
@@ -411,56 +1175,59 @@ public:
     { return * this ; }
 
   fs_vector operator - ( ) const
-    { return componentwise ( * this, :: negate < T > ( ) ) ; }
+    { fs_vector result ;
+      kernels :: negate ( elements, result.elements ) ;
+      return result ; }
 
   friend fs_vector operator + ( const fs_vector & a, const fs_vector & b )
-    { return componentwise ( a, b, plus < T > ( ) ) ; }
+    { fs_vector result ;
+      kernels :: add ( a.elements, b.elements, result.elements ) ;
+      return result ; }
 
   friend fs_vector operator - ( const fs_vector & a, const fs_vector & b )
-    { return componentwise ( a, b, minus < T > ( ) ) ; }
+    { fs_vector result ;
+      kernels :: subtract ( a.elements, b.elements, result.elements ) ;
+      return result ; }
 
   friend T operator * ( const fs_vector & a, const fs_vector & b )
-    { return inner_product ( a.begin ( ), a.end ( ),
-                             b.begin ( ),
-                             T ( 0 ) ) ; }
+    { return kernels :: dot ( a.elements, b.elements ) ; }
 
   friend fs_vector operator * ( const fs_vector & a, const T & b )
-    { return componentwise ( a, [ & ] ( const T & x ) { return x * b ; } ) ; }
+    { fs_vector result ;
+      kernels :: multiply ( a.elements, b, result.elements ) ;
+      return result ; }
 
   friend fs_vector operator * ( const T & a, const fs_vector & b )
-    { return componentwise ( b, [ & ] ( const T & x ) { return a * x ; } ) ; }
+    { fs_vector result ;
+      kernels :: multiply ( a, b.elements, result.elements ) ;
+      return result ; }
 
   friend fs_vector operator / ( const fs_vector & a, const T & b )
-    { return componentwise ( a, [ & ] ( const T & x ) { return x / b ; } ) ; }
+    { fs_vector result ;
+      kernels :: divide ( a.elements, b, result.elements ) ;
+      return result ; }
 
   friend fs_vector operator % ( const fs_vector & a, const T & b )
     { return componentwise ( a, [ & ] ( const T & x ) { return x % b ; } ) ; }
 
   fs_vector & negate ( )
-    { for ( T & x : elements )
-        x = - x ;
+    { kernels :: negate ( elements, elements ) ;
       return * this ; }
 
   fs_vector & operator += ( const fs_vector & b )
-    { for_pairs ( begin ( ), end ( ),
-                  b.begin ( ),
-                  [ ] ( T & x, const T & y ) { x += y ; } ) ;
+    { kernels :: add_assign ( elements, b.elements ) ;
       return * this ; }
 
   fs_vector & operator -= ( const fs_vector & b )
-    { for_pairs ( begin ( ), end ( ),
-                  b.begin ( ),
-                  [ ] ( T & x, const T & y ) { x -= y ; } ) ;
+    { kernels :: subtract_assign ( elements, b.elements ) ;
       return * this ; }
 
   fs_vector & operator *= ( const T & b )
-    { for ( T & x : elements )
-        x *= b ;
+    { kernels :: multiply_assign ( elements, b ) ;
       return * this ; }
 
   fs_vector & operator /= ( const T & b )
-    { for ( T & x : elements )
-        x /= b ;
+    { kernels :: divide_assign ( elements, b ) ;
       return * this ; }
 
   fs_vector & operator %= ( const T & b )
@@ -548,12 +1315,8 @@ inline T inner_product ( const fs_vector < T, N > & a,
                          const fs_vector < T, N > & b )
 
 {
-return inner_product ( a.begin ( ), a.end ( ),
-                       b.begin ( ),
-                       T ( 0 ),
-                       plus < T > ( ),
-                       [ ] ( const T & x, const T & y )
-                         { return inner_product_multiply ( x, y ) ; } ) ;
+return fs_vector_kernels < T, N > :: inner_product ( a.elements,
+                                                     b.elements ) ;
 }
 
 
@@ -563,14 +1326,7 @@ template < class T, size_t N >
 inline auto l1_norm ( const fs_vector < T, N > & a )
 
 {
-typedef remove_reference_t
-          < decltype ( l1_norm ( declval < T > ( ) ) ) >
-        result_type ;
-
-return accumulate ( a.begin ( ), a.end ( ),
-                    result_type ( 0 ),
-                    [ ] ( const result_type & x, const T & y )
-                      { return x + l1_norm ( y ) ; } ) ;
+return fs_vector_kernels < T, N > :: sum_l1_norms ( a.elements ) ;
 }
 
 
@@ -581,16 +1337,8 @@ inline auto l1_distance ( const fs_vector < T, N > & a,
                           const fs_vector < T, N > & b )
 
 {
-typedef remove_reference_t
-          < decltype ( l1_distance ( declval < T > ( ), declval < T > ( ) ) ) >
-        result_type ;
-
-return inner_product ( a.begin ( ), a.end ( ),
-                       b.begin ( ),
-                       result_type ( 0 ),
-                       plus < result_type > ( ),
-                       [ ] ( const T & x, const T & y )
-                         { return l1_distance ( x, y ) ; } ) ;
+return fs_vector_kernels < T, N > :: sum_l1_distances ( a.elements,
+                                                        b.elements ) ;
 }
 
 
@@ -600,14 +1348,7 @@ template < class T, size_t N >
 inline auto sqr_l2_norm ( const fs_vector < T, N > & a )
 
 {
-typedef remove_reference_t
-          < decltype ( sqr_l2_norm ( declval < T > ( ) ) ) >
-        result_type ;
-
-return accumulate ( a.begin ( ), a.end ( ),
-                    result_type ( 0 ),
-                    [ ] ( const result_type & x, const T & y )
-                      { return x + sqr_l2_norm ( y ) ; } ) ;
+return fs_vector_kernels < T, N > :: sum_sqr_l2_norms ( a.elements ) ;
 }
 
 
@@ -618,17 +1359,8 @@ inline auto sqr_l2_distance ( const fs_vector < T, N > & a,
                               const fs_vector < T, N > & b )
 
 {
-typedef remove_reference_t
-          < decltype ( sqr_l2_distance ( declval < T > ( ),
-                                         declval < T > ( ) ) ) >
-        result_type ;
-
-return inner_product ( a.begin ( ), a.end ( ),
-                       b.begin ( ),
-                       result_type ( 0 ),
-                       plus < result_type > ( ),
-                       [ ] ( const T & x, const T & y )
-                         { return sqr_l2_distance ( x, y ) ; } ) ;
+return fs_vector_kernels < T, N > :: sum_sqr_l2_distances ( a.elements,
+                                                            b.elements ) ;
 }
 
 
@@ -659,14 +1391,7 @@ template < class T, size_t N >
 inline auto linf_norm ( const fs_vector < T, N > & a )
 
 {
-typedef remove_reference_t
-          < decltype ( linf_norm ( declval < T > ( ) ) ) >
-        result_type ;
-
-return accumulate ( a.begin ( ), a.end ( ),
-                    result_type ( 0 ),
-                    [ ] ( const result_type & x, const T & y )
-                      { return max ( x, linf_norm ( y ) ) ; } ) ;
+return fs_vector_kernels < T, N > :: max_linf_norm ( a.elements ) ;
 }
 
 
@@ -677,18 +1402,8 @@ inline auto linf_distance ( const fs_vector < T, N > & a,
                             const fs_vector < T, N > & b )
 
 {
-typedef remove_reference_t
-          < decltype ( linf_distance ( declval < T > ( ),
-                                       declval < T > ( ) ) ) >
-        result_type ;
-
-return inner_product ( a.begin ( ), a.end ( ),
-                       b.begin ( ),
-                       result_type ( 0 ),
-                       [ ] ( const result_type & x, const result_type & y )
-                         { return max ( x, y ) ; },
-                       [ ] ( const T & x, const T & y )
-                         { return linf_distance ( x, y ) ; } ) ;
+return fs_vector_kernels < T, N > :: max_linf_distance ( a.elements,
+                                                         b.elements ) ;
 }
 
 
@@ -810,7 +1525,7 @@ return N ;
 
 
 template < class T, size_t N1, size_t N2 >
-class fs_matrix
+class alignas ( fs_vector_alignment < T, N2 > ( ) ) fs_matrix
 
 {
 public:
@@ -1113,14 +1828,7 @@ inline fs_vector < T, N1 >
 fs_vector < T, N1 > result ;
 
 for ( size_t n1 = 0 ; n1 < N1 ; ++ n1 )
-  {
-  T s ( 0 ) ;
-
-  for ( size_t n2 = 0 ; n2 < N2 ; ++ n2 )
-    s += m ( n1, n2 ) * v [ n2 ] ;
-
-  result [ n1 ] = s ;
-  }
+  result [ n1 ] = fs_vector_kernels < T, N2 > :: dot ( m [ n1 ], v.elements ) ;
 
 return result ;
 }
@@ -1136,15 +1844,10 @@ inline fs_vector < T, N2 >
 {
 fs_vector < T, N2 > result ;
 
-for ( size_t n2 = 0 ; n2 < N2 ; ++ n2 )
-  {
-  T s ( 0 ) ;
-
-  for ( size_t n1 = 0 ; n1 < N1 ; ++ n1 )
-    s += v [ n1 ] * m ( n1, n2 ) ;
-
-  result [ n2 ] = s ;
-  }
+fs_vector_kernels < T, N2 > :: linear_combination ( v.elements,
+                                                    m.data ( ),
+                                                    N1,
+                                                    result.elements ) ;
 
 return result ;
 }
@@ -1160,16 +1863,13 @@ inline fs_matrix < T, N1, N2 >
 {
 fs_matrix < T, N1, N2 > result ;
 
-for ( size_t n1 = 0 ; n1 < N1 ; ++ n1 )
-  for ( size_t n2 = 0 ; n2 < N2 ; ++ n2 )
-    {
-    T s ( 0 ) ;
-
-    for ( size_t l = 0 ; l < L ; ++ l )
-      s += a ( n1, l ) * b ( l, n2 ) ;
+// row n1 of the result is the sum of the rows of b weighted by row n1 of a
 
-    result ( n1, n2 ) = s ;
-    }
+for ( size_t n1 = 0 ; n1 < N1 ; ++ n1 )
+  fs_vector_kernels < T, N2 > :: linear_combination ( a [ n1 ],
+                                                      b.data ( ),
+                                                      L,
+                                                      result [ n1 ] ) ;
 
 return result ;
 }
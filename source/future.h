@@ -13,6 +13,8 @@
 
 #include <future>
 
+#include "chrono.h"
+
 
 
 using std :: future_errc ;
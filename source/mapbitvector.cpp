@@ -0,0 +1,118 @@
+// Copyright Ivan Stanojevic 2025.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+
+
+
+#include "mapbitvector.h"
+
+#if defined(__unix__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#endif
+
+
+
+// *** MAPPED FILE ***
+
+
+#if defined(__unix__)
+
+
+//
+
+__mapped_file :: __mapped_file ( const char * path, bool copy_on_write ) :
+  data_ ( nullptr ),
+  size_ ( 0 )
+
+{
+int fd = open ( path, O_RDONLY ) ;
+
+if ( fd < 0 )
+  throw runtime_error ( "mapped_bit_vector, cannot open file" ) ;
+
+struct stat s ;
+
+if ( fstat ( fd, & s ) != 0 )
+  {
+  :: close ( fd ) ;
+  throw runtime_error ( "mapped_bit_vector, cannot read file" ) ;
+  }
+
+size_ = size_t ( s.st_size ) ;
+
+// an empty file cannot be mapped, and is rejected by the header check
+
+if ( size_ > 0 )
+  {
+  void * p = mmap ( nullptr,
+                    size_,
+                    copy_on_write ? PROT_READ | PROT_WRITE : PROT_READ,
+                    MAP_PRIVATE,
+                    fd,
+                    0 ) ;
+
+  if ( p == MAP_FAILED )
+    {
+    :: close ( fd ) ;
+    throw runtime_error ( "mapped_bit_vector, cannot map file" ) ;
+    }
+
+  data_ = p ;
+  }
+
+:: close ( fd ) ;
+}
+
+
+//
+
+__mapped_file :: ~__mapped_file ( )
+
+{
+if ( data_ != nullptr )
+  munmap ( data_, size_ ) ;
+}
+
+
+#else
+
+
+//
+
+__mapped_file :: __mapped_file ( const char * path, bool ) :
+  data_ ( nullptr ),
+  size_ ( 0 )
+
+{
+ifstream file ( path, ios_base :: binary ) ;
+
+if ( ! file.good ( ) )
+  throw runtime_error ( "mapped_bit_vector, cannot open file" ) ;
+
+file.seekg ( 0, ios_base :: end ) ;
+size_ = size_t ( file.tellg ( ) ) ;
+file.seekg ( 0, ios_base :: beg ) ;
+
+buffer.resize ( ( size_ + 7 ) / 8 ) ;
+file.read ( reinterpret_cast < char * > ( buffer.data ( ) ), size_ ) ;
+
+if ( ! file.good ( ) )
+  throw runtime_error ( "mapped_bit_vector, cannot read file" ) ;
+
+data_ = buffer.data ( ) ;
+}
+
+
+//
+
+__mapped_file :: ~__mapped_file ( )
+
+{
+}
+
+
+#endif
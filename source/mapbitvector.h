@@ -0,0 +1,668 @@
+// Copyright Ivan Stanojevic 2025.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+
+
+
+#ifndef __MAPBITVECTOR_H
+
+#define __MAPBITVECTOR_H
+
+
+
+#include "cstddef.h"
+#include "cstdint.h"
+#include "cstring.h"
+#include "string.h"
+#include "vector.h"
+#include "algorithm.h"
+#include "utility.h"
+#include "cassert.h"
+#include "stdexcept.h"
+#include "ios.h"
+#include "fstream.h"
+#include "future.h"
+
+#include "numbase.h"
+#include "bitref.h"
+#include "bitcount.h"
+#include "bitvector.h"
+#include "threadpool.h"
+
+
+
+// *** FILE FORMAT ***
+
+
+// A bit vector file is a header of 64 bytes followed by the words of the
+// bit vector, in the byte order of the machine, with the bits after the
+// end 0. A file written on a machine of the other byte order is rejected,
+// as its word byte size does not match.
+
+class __mapped_bit_vector_header
+
+{
+public:
+
+  char magic [ 8 ] ;
+  uint64_t size ;
+  uint64_t word_byte_size ;
+  uint64_t checksum ;
+  uint64_t reserved [ 4 ] ;
+
+  static constexpr char valid_magic [ 8 ] =
+    { 'B', 'I', 'T', 'V', 'E', 'C', 'T', '1' } ;
+
+} ;
+
+static_assert ( sizeof ( __mapped_bit_vector_header ) == 64,
+                "Illegal bit vector file header size." ) ;
+
+
+// returns: checksum of the words p [ 0 ], ..., p [ n - 1 ] at the indices
+//          first, ..., first + n - 1 of a bit vector
+//
+// The checksum of a bit vector is the sum of a mix of each word with its
+// index, so that the checksums of its parts can be computed separately
+// and added.
+
+template < class Word >
+uint64_t __mapped_bit_vector_checksum ( const Word * p,
+                                        size_t n,
+                                        uint64_t first )
+
+{
+uint64_t result = 0 ;
+
+for ( size_t i = 0 ; i < n ; ++ i )
+  {
+  uint64_t x = uint64_t ( p [ i ] ) ^ ( first + i ) * 0x9e3779b97f4a7c15ULL ;
+
+  x ^= x >> 32 ;
+  x *= 0xd6e8feb86659fd93ULL ;
+  x ^= x >> 32 ;
+  x *= 0xd6e8feb86659fd93ULL ;
+  x ^= x >> 32 ;
+
+  result += x ;
+  }
+
+return result ;
+}
+
+
+
+// *** MAPPED FILE ***
+
+
+// A file mapped into memory, read only or copy on write, so that the
+// pages are read from the file when they are first accessed, and shared
+// with the page cache while they are not modified. Without memory mapping
+// (on systems other than Unix) the file is read into buffer instead. The
+// system calls are in mapbitvector.cpp, so that their headers are not
+// included here.
+
+class __mapped_file
+
+{
+private:
+
+  void * data_ ;
+  size_t size_ ;
+  vector < uint64_t > buffer ;
+
+public:
+
+  __mapped_file ( const char * path, bool copy_on_write ) ;
+
+  __mapped_file ( const __mapped_file & ) = delete ;
+
+  __mapped_file ( __mapped_file && x ) noexcept :
+    data_ ( x.data_ ),
+    size_ ( x.size_ ),
+    buffer ( move ( x.buffer ) )
+    { x.data_ = nullptr ;
+      x.size_ = 0 ; }
+
+  ~__mapped_file ( ) ;
+
+  __mapped_file & operator = ( const __mapped_file & ) = delete ;
+
+  __mapped_file & operator = ( __mapped_file && x ) noexcept
+    { :: swap ( data_, x.data_ ) ;
+      :: swap ( size_, x.size_ ) ;
+      buffer.swap ( x.buffer ) ;
+      return * this ; }
+
+  void * data ( ) const noexcept
+    { return data_ ; }
+
+  size_t size ( ) const noexcept
+    { return size_ ; }
+
+} ;
+
+
+
+// *** BASIC_MAPPED_BIT_VECTOR ***
+
+
+// Bit vector of a file written by basic_mapped_bit_vector_writer, used in
+// place without reading it into memory first. It has the const interface
+// of basic_bit_vector: the bit iterator algorithms (find, count, copy,
+// transform) apply to begin ( ) and end ( ), and hamming_weight,
+// hamming_distance, bit_and_weight and bit_or_weight to whole vectors.
+// In the copy_on_write mode the bits can be modified through data ( ),
+// without changing the file.
+
+template < class Word >
+class basic_mapped_bit_vector
+
+{
+public:
+
+  typedef Word word_type ;
+
+  typedef const_bit_iterator < Word > const_iterator ;
+  typedef const_reverse_bit_iterator < Word > const_reverse_iterator ;
+
+  static constexpr size_t word_bit_size = numeric_traits < Word > :: bit_size ;
+
+  enum mode_t { read_only, copy_on_write } ;
+
+private:
+
+  static constexpr size_t log2_word_bit_size =
+                            const_exponent ( word_bit_size ) - 1 ;
+
+  static_assert ( word_bit_size == size_t ( 1 ) << log2_word_bit_size,
+                  "Illegal word bit size." ) ;
+
+  // words of a task of verify
+
+  static constexpr size_t task_words = 1 << 20,
+                          tasks_per_thread = 4 ;
+
+  __mapped_file file ;
+  mode_t mode_ ;
+  Word * data_ ;
+  size_t size_ ;
+  uint64_t checksum_ ;
+
+public:
+
+  explicit basic_mapped_bit_vector ( const string & path,
+                                     mode_t mode = read_only ) ;
+
+  basic_mapped_bit_vector ( const basic_mapped_bit_vector & ) = delete ;
+
+  basic_mapped_bit_vector ( basic_mapped_bit_vector && x ) noexcept :
+    file ( move ( x.file ) ),
+    mode_ ( x.mode_ ),
+    data_ ( x.data_ ),
+    size_ ( x.size_ ),
+    checksum_ ( x.checksum_ )
+    { x.data_ = nullptr ;
+      x.size_ = 0 ; }
+
+  basic_mapped_bit_vector &
+    operator = ( const basic_mapped_bit_vector & ) = delete ;
+
+  basic_mapped_bit_vector &
+    operator = ( basic_mapped_bit_vector && x ) noexcept
+    { swap ( x ) ;
+      return * this ; }
+
+  void swap ( basic_mapped_bit_vector & x ) noexcept
+    { :: swap ( file, x.file ) ;
+      :: swap ( mode_, x.mode_ ) ;
+      :: swap ( data_, x.data_ ) ;
+      :: swap ( size_, x.size_ ) ;
+      :: swap ( checksum_, x.checksum_ ) ; }
+
+  mode_t mode ( ) const noexcept
+    { return mode_ ; }
+
+  size_t size ( ) const noexcept
+    { return size_ ; }
+
+  size_t word_size ( ) const noexcept
+    { return ( size_ + word_bit_size - 1 ) >> log2_word_bit_size ; }
+
+  bool empty ( ) const noexcept
+    { return size_ == 0 ; }
+
+  const Word * data ( ) const noexcept
+    { return data_ ; }
+
+  // pre: mode ( ) == copy_on_write
+
+  Word * data ( ) noexcept
+    { assert ( mode_ == copy_on_write ) ;
+      return data_ ; }
+
+  bool operator [ ] ( size_t n ) const noexcept
+    { assert ( n < size_ ) ;
+      return ( data_ [ n >> log2_word_bit_size ] >> ( n % word_bit_size ) & 1 )
+             != 0 ; }
+
+  const_iterator begin ( ) const noexcept
+    { return const_iterator ( data_, 0 ) ; }
+
+  const_iterator end ( ) const noexcept
+    { return const_iterator ( data_, size_ ) ; }
+
+  const_iterator cbegin ( ) const noexcept
+    { return begin ( ) ; }
+
+  const_iterator cend ( ) const noexcept
+    { return end ( ) ; }
+
+  const_reverse_iterator rbegin ( ) const noexcept
+    { return const_reverse_iterator ( data_, size_ - 1 ) ; }
+
+  const_reverse_iterator rend ( ) const noexcept
+    { return const_reverse_iterator ( data_, -1 ) ; }
+
+  // returns: checksum of the file header
+
+  uint64_t checksum ( ) const noexcept
+    { return checksum_ ; }
+
+  // returns: true iff the words match the checksum of the file header,
+  //          computed on the threads of pool, or on the calling thread if
+  //          pool is nullptr
+
+  bool verify ( thread_pool * pool = nullptr ) const ;
+
+} ;
+
+
+//
+
+template < class Word >
+basic_mapped_bit_vector < Word > ::
+  basic_mapped_bit_vector ( const string & path, mode_t mode ) :
+  file ( path.c_str ( ), mode == copy_on_write ),
+  mode_ ( mode )
+
+{
+typedef __mapped_bit_vector_header header_type ;
+
+char * p = static_cast < char * > ( file.data ( ) ) ;
+
+header_type h ;
+
+if ( file.size ( ) < sizeof ( header_type ) )
+  throw runtime_error ( "mapped_bit_vector, invalid file" ) ;
+
+memcpy ( & h, p, sizeof ( header_type ) ) ;
+
+// the number of words is computed so that a corrupted size can not
+// overflow
+
+const uint64_t file_words =
+                 ( file.size ( ) - sizeof ( header_type ) ) / sizeof ( Word ),
+               words = h.size / word_bit_size
+                       + ( h.size % word_bit_size != 0 ? 1 : 0 ) ;
+
+if (    memcmp ( h.magic, header_type :: valid_magic, 8 ) != 0
+    ||  h.word_byte_size != sizeof ( Word )
+    ||  h.size > uint64_t ( size_t ( -1 ) )
+    ||  words > file_words )
+  throw runtime_error ( "mapped_bit_vector, invalid file" ) ;
+
+data_ = reinterpret_cast < Word * > ( p + sizeof ( header_type ) ) ;
+size_ = size_t ( h.size ) ;
+checksum_ = h.checksum ;
+
+// the word kernels count the bits after the end
+
+if (    size_ % word_bit_size != 0
+    &&  data_ [ size_ / word_bit_size ] >> size_ % word_bit_size != 0 )
+  throw runtime_error ( "mapped_bit_vector, invalid file" ) ;
+}
+
+
+//
+
+template < class Word >
+bool basic_mapped_bit_vector < Word > :: verify ( thread_pool * pool ) const
+
+{
+const size_t n = word_size ( ) ;
+
+const size_t tasks =   pool == nullptr
+                     ? 1
+                     : min ( pool -> size ( ) * tasks_per_thread,
+                             n / task_words ) ;
+
+vector < uint64_t > checksums ( max ( tasks, size_t ( 1 ) ) ) ;
+
+run_range_tasks ( pool,
+                  n,
+                  tasks,
+                  [ this, & checksums ] ( size_t i, size_t first, size_t last )
+                  { checksums [ i ] = __mapped_bit_vector_checksum
+                                        ( data_ + first, last - first,
+                                          first ) ; } ) ;
+
+uint64_t result = 0 ;
+
+for ( uint64_t x : checksums )
+  result += x ;
+
+return result == checksum_ ;
+}
+
+
+// The functions of two bit vectors treat the shorter one as extended by 0
+// bits.
+
+template < class Word >
+inline size_t hamming_weight ( const basic_mapped_bit_vector < Word > & x )
+
+{
+return words_hamming_weight ( x.data ( ), x.word_size ( ) ) ;
+}
+
+
+//
+
+template < class Word >
+size_t hamming_distance ( const basic_mapped_bit_vector < Word > & a,
+                          const basic_mapped_bit_vector < Word > & b )
+
+{
+const basic_mapped_bit_vector < Word > & x =
+  a.word_size ( ) < b.word_size ( ) ? a : b ;
+
+const basic_mapped_bit_vector < Word > & y =
+  a.word_size ( ) < b.word_size ( ) ? b : a ;
+
+size_t n = x.word_size ( ) ;
+
+return   words_hamming_distance ( x.data ( ), y.data ( ), n )
+       + words_hamming_weight ( y.data ( ) + n, y.word_size ( ) - n ) ;
+}
+
+
+//
+
+template < class Word >
+size_t bit_and_weight ( const basic_mapped_bit_vector < Word > & a,
+                        const basic_mapped_bit_vector < Word > & b )
+
+{
+return words_and_weight ( a.data ( ), b.data ( ),
+                          min ( a.word_size ( ), b.word_size ( ) ) ) ;
+}
+
+
+//
+
+template < class Word >
+size_t bit_or_weight ( const basic_mapped_bit_vector < Word > & a,
+                       const basic_mapped_bit_vector < Word > & b )
+
+{
+const basic_mapped_bit_vector < Word > & x =
+  a.word_size ( ) < b.word_size ( ) ? a : b ;
+
+const basic_mapped_bit_vector < Word > & y =
+  a.word_size ( ) < b.word_size ( ) ? b : a ;
+
+size_t n = x.word_size ( ) ;
+
+return   words_or_weight ( x.data ( ), y.data ( ), n )
+       + words_hamming_weight ( y.data ( ) + n, y.word_size ( ) - n ) ;
+}
+
+
+
+// *** BASIC_MAPPED_BIT_VECTOR_WRITER ***
+
+
+// Writes a bit vector file as the bits are appended, keeping only a
+// buffer of words in memory. The header is written by close, so a file
+// that was not closed is rejected by basic_mapped_bit_vector.
+
+template < class Word >
+class basic_mapped_bit_vector_writer
+
+{
+private:
+
+  static constexpr size_t word_bit_size = numeric_traits < Word > :: bit_size ;
+
+  static constexpr size_t buffer_words = 8192 ;
+
+  ofstream file ;
+  vector < Word > buffer ;
+
+  // bits of the last word, not yet in the buffer
+
+  Word word ;
+
+  size_t size_ ;
+  uint64_t words_written ;
+  uint64_t checksum_ ;
+
+  void push_word ( Word w )
+    { buffer.push_back ( w ) ;
+      if ( buffer.size ( ) == buffer_words )
+        write_buffer ( ) ; }
+
+  // appends the n low bits of w
+  //
+  // pre: 0 < n <= word_bit_size, the other bits of w are 0
+
+  void append_bits ( Word w, size_t n )
+    { size_t offset = size_ % word_bit_size ;
+      word |= Word ( w << offset ) ;
+      size_ += n ;
+      if ( offset + n >= word_bit_size )
+        { push_word ( word ) ;
+          word = offset == 0 ? Word ( 0 )
+                             : Word ( w >> ( word_bit_size - offset ) ) ; } }
+
+  void write_buffer ( ) ;
+
+public:
+
+  // creates the file path, replacing an existing one
+
+  explicit basic_mapped_bit_vector_writer ( const string & path ) ;
+
+  basic_mapped_bit_vector_writer ( const basic_mapped_bit_vector_writer & ) =
+    delete ;
+
+  basic_mapped_bit_vector_writer &
+    operator = ( const basic_mapped_bit_vector_writer & ) = delete ;
+
+  // Closes the file if it is open, without writing the header, so that a
+  // file that was not closed by close, for example because an exception
+  // was thrown while it was written, is rejected by
+  // basic_mapped_bit_vector.
+
+  ~basic_mapped_bit_vector_writer ( ) ;
+
+  // returns: number of bits appended
+
+  size_t size ( ) const noexcept
+    { return size_ ; }
+
+  bool is_open ( ) const
+    { return file.is_open ( ) ; }
+
+  void push_back ( bool b )
+    { append_bits ( Word ( b ), 1 ) ; }
+
+  // appends [ first, last ), where BitIterator is any of the bit iterator
+  // types with the word type Word
+
+  template < class BitIterator >
+  void append ( BitIterator first, BitIterator last ) ;
+
+  template < class Allocator >
+  void append ( const basic_bit_vector < Word, Allocator > & x ) ;
+
+  // Writes the rest of the words and the header, and closes the file.
+  // Throws runtime_error if the file could not be written.
+
+  void close ( ) ;
+
+} ;
+
+
+//
+
+template < class Word >
+basic_mapped_bit_vector_writer < Word > ::
+  basic_mapped_bit_vector_writer ( const string & path ) :
+  file ( path.c_str ( ),
+         ios_base :: binary | ios_base :: out | ios_base :: trunc ),
+  word ( 0 ),
+  size_ ( 0 ),
+  words_written ( 0 ),
+  checksum_ ( 0 )
+
+{
+if ( ! file.good ( ) )
+  throw runtime_error ( "mapped_bit_vector_writer, cannot open file" ) ;
+
+buffer.reserve ( buffer_words ) ;
+
+// a header of zeros, replaced by close
+
+__mapped_bit_vector_header h { } ;
+
+file.write ( reinterpret_cast < const char * > ( & h ), sizeof ( h ) ) ;
+}
+
+
+//
+
+template < class Word >
+basic_mapped_bit_vector_writer < Word > ::
+  ~basic_mapped_bit_vector_writer ( )
+
+{
+if ( file.is_open ( ) )
+  file.close ( ) ;
+}
+
+
+//
+
+template < class Word >
+void basic_mapped_bit_vector_writer < Word > :: write_buffer ( )
+
+{
+checksum_ += __mapped_bit_vector_checksum ( buffer.data ( ),
+                                            buffer.size ( ),
+                                            words_written ) ;
+
+file.write ( reinterpret_cast < const char * > ( buffer.data ( ) ),
+             buffer.size ( ) * sizeof ( Word ) ) ;
+
+if ( ! file.good ( ) )
+  throw runtime_error ( "mapped_bit_vector_writer, cannot write file" ) ;
+
+words_written += buffer.size ( ) ;
+buffer.clear ( ) ;
+}
+
+
+//
+
+template < class Word >
+template < class BitIterator >
+void basic_mapped_bit_vector_writer < Word > ::
+  append ( BitIterator first, BitIterator last )
+
+{
+assert ( valid_bit_iterator_range ( first, last ) ) ;
+
+size_t n = last - first ;
+
+for ( size_t base = 0 ; base < n ; base += word_bit_size )
+  {
+  size_t k = min ( n - base, word_bit_size ) ;
+
+  append_bits ( first.word ( k ), k ) ;
+
+  if ( k == word_bit_size )
+    first += word_bit_size ;
+  }
+}
+
+
+//
+
+template < class Word >
+template < class Allocator >
+void basic_mapped_bit_vector_writer < Word > ::
+  append ( const basic_bit_vector < Word, Allocator > & x )
+
+{
+if ( size_ % word_bit_size != 0 )
+  {
+  append ( x.begin ( ), x.end ( ) ) ;
+  return ;
+  }
+
+// the words of x are appended as they are
+
+const Word * p = x.data ( ) ;
+const size_t n = x.size ( ) / word_bit_size ;
+
+for ( size_t i = 0 ; i < n ; ++ i )
+  push_word ( p [ i ] ) ;
+
+size_ += n * word_bit_size ;
+
+if ( x.size ( ) % word_bit_size != 0 )
+  append_bits ( p [ n ], x.size ( ) % word_bit_size ) ;
+}
+
+
+//
+
+template < class Word >
+void basic_mapped_bit_vector_writer < Word > :: close ( )
+
+{
+if ( size_ % word_bit_size != 0 )
+  push_word ( word ) ;
+
+write_buffer ( ) ;
+
+__mapped_bit_vector_header h { } ;
+
+memcpy ( h.magic, __mapped_bit_vector_header :: valid_magic, 8 ) ;
+h.size = size_ ;
+h.word_byte_size = sizeof ( Word ) ;
+h.checksum = checksum_ ;
+
+file.seekp ( 0 ) ;
+file.write ( reinterpret_cast < const char * > ( & h ), sizeof ( h ) ) ;
+file.close ( ) ;
+
+if ( file.fail ( ) )
+  throw runtime_error ( "mapped_bit_vector_writer, cannot write file" ) ;
+}
+
+
+
+// *** MAPPED_BIT_VECTOR ***
+
+
+typedef basic_mapped_bit_vector < uint > mapped_bit_vector ;
+
+typedef basic_mapped_bit_vector_writer < uint > mapped_bit_vector_writer ;
+
+
+
+#endif
@@ -9,50 +9,65 @@
 
 
 
-// *** HAMMING_WEIGHT ***
+// *** BIT OPERATIONS CHECK ***
+
+
+// the builtin implementations of hamming_weight, exponent,
+// trailing_zero_count, byte_swap and reverse must agree with the portable
+// ones; this is verified at compile time, for every byte value and for
+// some patterns of every width
+
+constexpr unsigned_long_long __bit_operations_check_patterns [ ] =
+  { 0x0ULL, 0x1ULL, 0x8000000000000000ULL, 0xffffffffffffffffULL,
+    0x0123456789abcdefULL, 0xfedcba9876543210ULL, 0x5555555555555555ULL,
+    0xaaaaaaaaaaaaaaaaULL, 0x00000000ffff0000ULL, 0x8000000180000001ULL,
+    0x0000800000000000ULL, 0x7fffffffffffffffULL, 0x9e3779b97f4a7c15ULL } ;
 
 
 //
 
-const sint __char_hamming_weight [ ] =
-  { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
-    1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,
-    1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,
-    2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
-    1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,
-    2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
-    2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
-    3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,
-    1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,
-    2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
-    2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
-    3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,
-    2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
-    3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,
-    3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,
-    4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8 } ;
+template < class T >
+constexpr bool check_bit_operations ( T x )
 
+{
+typedef typename numeric_traits < T > :: unsigned_type unsigned_type ;
 
+return     hamming_weight ( x ) == generic_hamming_weight ( x )
+       &&     exponent ( static_cast < unsigned_type > ( x ) )
+           == generic_exponent ( x )
+       &&  trailing_zero_count ( x ) == generic_trailing_zero_count ( x )
+       &&  byte_swap ( x ) == generic_byte_swap ( x )
+       &&  reverse ( x ) == generic_reverse ( x ) ;
+}
+
+
+//
 
-// *** REVERSE ***
+template < class T >
+constexpr bool check_bit_operations ( )
+
+{
+for ( sint i = 0 ; i < 256 ; ++ i )
+  if ( ! check_bit_operations ( static_cast < T > ( i ) ) )
+    return false ;
+
+for ( unsigned_long_long p : __bit_operations_check_patterns )
+  for ( sint i = 0 ; i < 64 ; i += 7 )
+    if (    ! check_bit_operations ( static_cast < T > ( p >> i ) )
+         || ! check_bit_operations ( static_cast < T > ( p << i ) ) )
+      return false ;
+
+return true ;
+}
 
 
 //
 
-const unsigned char __char_reversed [ ] =
-  {  0, 128, 64, 192, 32, 160,  96, 224, 16, 144, 80, 208, 48, 176, 112, 240,
-     8, 136, 72, 200, 40, 168, 104, 232, 24, 152, 88, 216, 56, 184, 120, 248,
-     4, 132, 68, 196, 36, 164, 100, 228, 20, 148, 84, 212, 52, 180, 116, 244,
-    12, 140, 76, 204, 44, 172, 108, 236, 28, 156, 92, 220, 60, 188, 124, 252,
-     2, 130, 66, 194, 34, 162,  98, 226, 18, 146, 82, 210, 50, 178, 114, 242,
-    10, 138, 74, 202, 42, 170, 106, 234, 26, 154, 90, 218, 58, 186, 122, 250,
-     6, 134, 70, 198, 38, 166, 102, 230, 22, 150, 86, 214, 54, 182, 118, 246,
-    14, 142, 78, 206, 46, 174, 110, 238, 30, 158, 94, 222, 62, 190, 126, 254,
-     1, 129, 65, 193, 33, 161,  97, 225, 17, 145, 81, 209, 49, 177, 113, 241,
-     9, 137, 73, 201, 41, 169, 105, 233, 25, 153, 89, 217, 57, 185, 121, 249,
-     5, 133, 69, 197, 37, 165, 101, 229, 21, 149, 85, 213, 53, 181, 117, 245,
-    13, 141, 77, 205, 45, 173, 109, 237, 29, 157, 93, 221, 61, 189, 125, 253,
-     3, 131, 67, 195, 35, 163,  99, 227, 19, 147, 83, 211, 51, 179, 115, 243,
-    11, 139, 75, 203, 43, 171, 107, 235, 27, 155, 91, 219, 59, 187, 123, 251,
-     7, 135, 71, 199, 39, 167, 103, 231, 23, 151, 87, 215, 55, 183, 119, 247,
-    15, 143, 79, 207, 47, 175, 111, 239, 31, 159, 95, 223, 63, 191, 127, 255 } ;
+#define __CHECK_BIT_OPERATIONS(Type)                              \
+                                                                  \
+static_assert ( check_bit_operations < Type > ( ),                \
+                "Builtin and portable bit operations differ." ) ;
+
+FOR_BUILTIN_INTEGRAL_TYPES(__CHECK_BIT_OPERATIONS)
+
+#undef __CHECK_BIT_OPERATIONS
@@ -440,7 +440,7 @@ public:
 
 #define __DEFINE_IS_HIGH_BIT_SET(Type)                               \
                                                                      \
-inline bool is_high_bit_set ( Type x )                               \
+constexpr bool is_high_bit_set ( Type x )                            \
                                                                      \
 {                                                                    \
 return    ( x & (    Type ( 1 )                                      \
@@ -459,24 +459,72 @@ FOR_BUILTIN_INTEGRAL_TYPES(__DEFINE_IS_HIGH_BIT_SET)
 
 //
 
-extern const sint __char_hamming_weight [ ] ;
+inline constexpr sint __char_hamming_weight [ ] =
+  { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+    1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,
+    1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,
+    2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+    1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,
+    2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+    2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+    3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,
+    1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,
+    2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+    2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+    3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,
+    2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+    3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,
+    3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,
+    4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8 } ;
+
+
+// portable implementation, by byte table lookups
+
+template < class T >
+constexpr sint generic_hamming_weight ( T x )
+
+{
+typedef typename numeric_traits < T > :: unsigned_type unsigned_type ;
+
+unsigned_type y ( static_cast < unsigned_type > ( x ) ) ;
+
+sint result = __char_hamming_weight [ y & 0xff ] ;
+
+for ( sint i = 1 ; i < sizeof ( T ) ; ++ i )
+  result += __char_hamming_weight [ ( y >> ( i << 3 ) ) & 0xff ] ;
+
+return result ;
+}
 
 
 //
 
-#define __DEFINE_HAMMING_WEIGHT(Type)                              \
-                                                                   \
-inline sint hamming_weight ( Type x )                              \
-                                                                   \
-{                                                                  \
-sint result = __char_hamming_weight [ x & 0xff ] ;                 \
-                                                                   \
-for ( sint i = 1 ; i < sizeof ( Type ) ; ++ i )                    \
-  result += __char_hamming_weight [ ( x >> ( i << 3 ) ) & 0xff ] ; \
-                                                                   \
-return result ;                                                    \
+#ifdef __builtin_bit_operations__
+
+#define __DEFINE_HAMMING_WEIGHT(Type)                            \
+                                                                 \
+constexpr sint hamming_weight ( Type x )                         \
+                                                                 \
+{                                                                \
+typedef numeric_traits < Type > :: unsigned_type unsigned_type ; \
+                                                                 \
+return __builtin_popcountll                                      \
+         ( static_cast < unsigned_long_long >                    \
+             ( static_cast < unsigned_type > ( x ) ) ) ;         \
 }
 
+#else
+
+#define __DEFINE_HAMMING_WEIGHT(Type)    \
+                                         \
+constexpr sint hamming_weight ( Type x ) \
+                                         \
+{                                        \
+return generic_hamming_weight ( x ) ;    \
+}
+
+#endif
+
 FOR_BUILTIN_INTEGRAL_TYPES(__DEFINE_HAMMING_WEIGHT)
 
 #undef __DEFINE_HAMMING_WEIGHT
@@ -486,13 +534,13 @@ FOR_BUILTIN_INTEGRAL_TYPES(__DEFINE_HAMMING_WEIGHT)
 // *** DIVMOD ***
 
 
-#define __DEFINE_DIVMOD(Type)                             \
-                                                          \
-inline void divmod ( Type a, Type b, Type & q, Type & r ) \
-                                                          \
-{                                                         \
-q = a / b ;                                               \
-r = a % b ;                                               \
+#define __DEFINE_DIVMOD(Type)                                \
+                                                             \
+constexpr void divmod ( Type a, Type b, Type & q, Type & r ) \
+                                                             \
+{                                                            \
+q = a / b ;                                                  \
+r = a % b ;                                                  \
 }
 
 FOR_BUILTIN_INTEGRAL_TYPES(__DEFINE_DIVMOD)
@@ -508,14 +556,14 @@ FOR_BUILTIN_INTEGRAL_TYPES(__DEFINE_DIVMOD)
 
 #define __DEFINE_SHIFT_RIGHT(Type)                                            \
                                                                               \
-inline Type signed_shift_right ( Type x, sint n )                             \
+constexpr Type signed_shift_right ( Type x, sint n )                          \
                                                                               \
 {                                                                             \
 assert ( n >= 0  &&  n < numeric_traits < Type > :: bit_size ) ;              \
 return x >> n ;                                                               \
 }                                                                             \
                                                                               \
-inline Type unsigned_shift_right ( Type x, sint n )                           \
+constexpr Type unsigned_shift_right ( Type x, sint n )                        \
                                                                               \
 {                                                                             \
 assert ( n >= 0  &&  n < numeric_traits < Type > :: bit_size ) ;              \
@@ -533,7 +581,7 @@ FOR_BUILTIN_SIGNED_INTEGRAL_TYPES(__DEFINE_SHIFT_RIGHT)
 
 #define __DEFINE_SHIFT_RIGHT(Type)                                          \
                                                                             \
-inline Type signed_shift_right ( Type x, sint n )                           \
+constexpr Type signed_shift_right ( Type x, sint n )                        \
                                                                             \
 {                                                                           \
 assert ( n >= 0  &&  n < numeric_traits < Type > :: bit_size ) ;            \
@@ -542,7 +590,7 @@ return                                                                      \
     ( static_cast < numeric_traits < Type > :: signed_type > ( x ) >> n ) ; \
 }                                                                           \
                                                                             \
-inline Type unsigned_shift_right ( Type x, sint n )                         \
+constexpr Type unsigned_shift_right ( Type x, sint n )                      \
                                                                             \
 {                                                                           \
 assert ( n >= 0  &&  n < numeric_traits < Type > :: bit_size ) ;            \
@@ -561,7 +609,7 @@ FOR_BUILTIN_UNSIGNED_INTEGRAL_TYPES(__DEFINE_SHIFT_RIGHT)
 //
 
 template < class T >
-inline T rotate_left ( T x, sint n )
+constexpr T rotate_left ( T x, sint n )
 
 {
 assert ( n >= 0  &&  n < numeric_traits < T > :: bit_size ) ;
@@ -576,7 +624,7 @@ return   n == 0
 //
 
 template < class T >
-inline T rotate_right ( T x, sint n )
+constexpr T rotate_right ( T x, sint n )
 
 {
 assert ( n >= 0  &&  n < numeric_traits < T > :: bit_size ) ;
@@ -595,7 +643,7 @@ return   n == 0
 //
 
 template < class T >
-inline T generic_low_half ( T x )
+constexpr T generic_low_half ( T x )
 
 {
 static_assert ( ( numeric_traits < T > :: bit_size & 1 ) == 0,
@@ -609,7 +657,7 @@ return
 //
 
 template < class T >
-inline T generic_low_half_high ( T x )
+constexpr T generic_low_half_high ( T x )
 
 {
 static_assert ( ( numeric_traits < T > :: bit_size & 1 ) == 0,
@@ -622,7 +670,7 @@ return T ( x << ( numeric_traits < T > :: bit_size >> 1 ) ) ;
 //
 
 template < class T >
-inline T generic_high_half ( T x )
+constexpr T generic_high_half ( T x )
 
 {
 static_assert ( ( numeric_traits < T > :: bit_size & 1 ) == 0,
@@ -634,24 +682,24 @@ return unsigned_shift_right ( x, numeric_traits < T > :: bit_size >> 1 ) ;
 
 //
 
-#define __DEFINE_HALFS(Type)         \
-                                     \
-inline Type low_half ( Type x )      \
-                                     \
-{                                    \
-return generic_low_half ( x ) ;      \
-}                                    \
-                                     \
-inline Type low_half_high ( Type x ) \
-                                     \
-{                                    \
-return generic_low_half_high ( x ) ; \
-}                                    \
-                                     \
-inline Type high_half ( Type x )     \
-                                     \
-{                                    \
-return generic_high_half ( x ) ;     \
+#define __DEFINE_HALFS(Type)            \
+                                        \
+constexpr Type low_half ( Type x )      \
+                                        \
+{                                       \
+return generic_low_half ( x ) ;         \
+}                                       \
+                                        \
+constexpr Type low_half_high ( Type x ) \
+                                        \
+{                                       \
+return generic_low_half_high ( x ) ;    \
+}                                       \
+                                        \
+constexpr Type high_half ( Type x )     \
+                                        \
+{                                       \
+return generic_high_half ( x ) ;        \
 }
 
 FOR_BUILTIN_INTEGRAL_TYPES(__DEFINE_HALFS)
@@ -660,49 +708,160 @@ FOR_BUILTIN_INTEGRAL_TYPES(__DEFINE_HALFS)
 
 
 
+// *** BYTE_SWAP ***
+
+
+// portable implementation
+
+template < class T >
+constexpr T generic_byte_swap ( T x )
+
+{
+typedef typename numeric_traits < T > :: unsigned_type unsigned_type ;
+
+unsigned_type y ( static_cast < unsigned_type > ( x ) ),
+              result ( y & 0xff ) ;
+
+for ( sint i = 1 ; i < sizeof ( T ) ; ++ i )
+  {
+  y >>= 8 ;
+  result <<= 8 ;
+  result |= y & 0xff ;
+  }
+
+return static_cast < T > ( result ) ;
+}
+
+
+// returns: x with the order of its bytes reversed
+
+#ifdef __builtin_bit_operations__
+
+#define __DEFINE_BYTE_SWAP(Type)                                 \
+                                                                 \
+constexpr Type byte_swap ( Type x )                              \
+                                                                 \
+{                                                                \
+typedef numeric_traits < Type > :: unsigned_type unsigned_type ; \
+                                                                 \
+return static_cast < Type >                                      \
+         (    __builtin_bswap64                                  \
+                ( static_cast < unsigned_long_long >             \
+                    ( static_cast < unsigned_type > ( x ) ) )    \
+           >> ( 64 - numeric_traits < Type > :: bit_size ) ) ;   \
+}
+
+#else
+
+#define __DEFINE_BYTE_SWAP(Type)    \
+                                    \
+constexpr Type byte_swap ( Type x ) \
+                                    \
+{                                   \
+return generic_byte_swap ( x ) ;    \
+}
+
+#endif
+
+FOR_BUILTIN_INTEGRAL_TYPES(__DEFINE_BYTE_SWAP)
+
+#undef __DEFINE_BYTE_SWAP
+
+
+
 // *** REVERSE ***
 
 
 //
 
-extern const unsigned char __char_reversed [ ] ;
+inline constexpr unsigned char __char_reversed [ ] =
+  {  0, 128, 64, 192, 32, 160,  96, 224, 16, 144, 80, 208, 48, 176, 112, 240,
+     8, 136, 72, 200, 40, 168, 104, 232, 24, 152, 88, 216, 56, 184, 120, 248,
+     4, 132, 68, 196, 36, 164, 100, 228, 20, 148, 84, 212, 52, 180, 116, 244,
+    12, 140, 76, 204, 44, 172, 108, 236, 28, 156, 92, 220, 60, 188, 124, 252,
+     2, 130, 66, 194, 34, 162,  98, 226, 18, 146, 82, 210, 50, 178, 114, 242,
+    10, 138, 74, 202, 42, 170, 106, 234, 26, 154, 90, 218, 58, 186, 122, 250,
+     6, 134, 70, 198, 38, 166, 102, 230, 22, 150, 86, 214, 54, 182, 118, 246,
+    14, 142, 78, 206, 46, 174, 110, 238, 30, 158, 94, 222, 62, 190, 126, 254,
+     1, 129, 65, 193, 33, 161,  97, 225, 17, 145, 81, 209, 49, 177, 113, 241,
+     9, 137, 73, 201, 41, 169, 105, 233, 25, 153, 89, 217, 57, 185, 121, 249,
+     5, 133, 69, 197, 37, 165, 101, 229, 21, 149, 85, 213, 53, 181, 117, 245,
+    13, 141, 77, 205, 45, 173, 109, 237, 29, 157, 93, 221, 61, 189, 125, 253,
+     3, 131, 67, 195, 35, 163,  99, 227, 19, 147, 83, 211, 51, 179, 115, 243,
+    11, 139, 75, 203, 43, 171, 107, 235, 27, 155, 91, 219, 59, 187, 123, 251,
+     7, 135, 71, 199, 39, 167, 103, 231, 23, 151, 87, 215, 55, 183, 119, 247,
+    15, 143, 79, 207, 47, 175, 111, 239, 31, 159, 95, 223, 63, 191, 127, 255 } ;
+
+
+// portable implementation, by byte table lookups
 
+template < class T >
+constexpr T generic_reverse ( T x )
 
-//
+{
+typedef typename numeric_traits < T > :: unsigned_type unsigned_type ;
 
-#define __DEFINE_REVERSE(Type)          \
-                                        \
-inline Type reverse ( Type x )          \
-                                        \
-{                                       \
-return __char_reversed [ uint ( x ) ] ; \
+unsigned_type y ( static_cast < unsigned_type > ( x ) ),
+              result ( __char_reversed [ y & 0xff ] ) ;
+
+for ( sint i = 1 ; i < sizeof ( T ) ; ++ i )
+  {
+  y >>= 8 ;
+  result <<= 8 ;
+  result |= __char_reversed [ y & 0xff ] ;
+  }
+
+return static_cast < T > ( result ) ;
 }
 
-FOR_BUILTIN_CHAR_TYPES(__DEFINE_REVERSE)
 
-#undef __DEFINE_REVERSE
+// byte swap, followed by swapping nibbles, bit pairs and bits
 
+template < class T >
+constexpr T builtin_reverse ( T x )
 
-//
+{
+typedef typename numeric_traits < T > :: unsigned_type unsigned_type ;
+
+const unsigned_type m1 ( unsigned_type ( -1 ) / 3 ),
+                    m2 ( unsigned_type ( -1 ) / 5 ),
+                    m4 ( unsigned_type ( -1 ) / 17 ) ;
+
+unsigned_type y ( static_cast < unsigned_type > ( byte_swap ( x ) ) ) ;
+
+y = unsigned_type ( ( ( y >> 4 ) & m4 ) | ( ( y & m4 ) << 4 ) ) ;
+y = unsigned_type ( ( ( y >> 2 ) & m2 ) | ( ( y & m2 ) << 2 ) ) ;
+y = unsigned_type ( ( ( y >> 1 ) & m1 ) | ( ( y & m1 ) << 1 ) ) ;
+
+return static_cast < T > ( y ) ;
+}
 
-#define __DEFINE_REVERSE(Type)                  \
-                                                \
-inline Type reverse ( Type x )                  \
-                                                \
-{                                               \
-Type result = __char_reversed [ x & 0xff ] ;    \
-                                                \
-for ( sint i = 1 ; i < sizeof ( Type ) ; ++ i ) \
-  {                                             \
-  x >>= 8 ;                                     \
-  result <<= 8 ;                                \
-  result |= __char_reversed [ x & 0xff ] ;      \
-  }                                             \
-                                                \
-return result ;                                 \
+
+// returns: x with the order of its bits reversed
+
+#ifdef __builtin_bit_operations__
+
+#define __DEFINE_REVERSE(Type)    \
+                                  \
+constexpr Type reverse ( Type x ) \
+                                  \
+{                                 \
+return builtin_reverse ( x ) ;    \
+}
+
+#else
+
+#define __DEFINE_REVERSE(Type)    \
+                                  \
+constexpr Type reverse ( Type x ) \
+                                  \
+{                                 \
+return generic_reverse ( x ) ;    \
 }
 
-FOR_BUILTIN_NONCHAR_INTEGRAL_TYPES(__DEFINE_REVERSE)
+#endif
+
+FOR_BUILTIN_INTEGRAL_TYPES(__DEFINE_REVERSE)
 
 #undef __DEFINE_REVERSE
 
@@ -727,7 +886,8 @@ public:
 
   typedef typename numeric_traits < T > :: unsigned_type unsigned_type ;
 
-  static void operate ( unsigned_type a, unsigned_type b, T & h, T & l ) ;
+  static constexpr void
+    operate ( unsigned_type a, unsigned_type b, T & h, T & l ) ;
 
 } ;
 
@@ -735,8 +895,8 @@ public:
 //
 
 template < class T >
-inline void unsigned_double_multiplier < T, true > ::
-              operate ( unsigned_type a, unsigned_type b, T & h, T & l )
+constexpr void unsigned_double_multiplier < T, true > ::
+                 operate ( unsigned_type a, unsigned_type b, T & h, T & l )
 
 {
 typedef typename numeric_traits < unsigned_type > :: double_size_type
@@ -759,7 +919,8 @@ public:
 
   typedef typename numeric_traits < T > :: unsigned_type unsigned_type ;
 
-  static void operate ( unsigned_type a, unsigned_type b, T & h, T & l ) ;
+  static constexpr void
+    operate ( unsigned_type a, unsigned_type b, T & h, T & l ) ;
 
 } ;
 
@@ -767,8 +928,8 @@ public:
 //
 
 template < class T >
-inline void unsigned_double_multiplier < T, false > ::
-              operate ( unsigned_type a, unsigned_type b, T & h, T & l )
+constexpr void unsigned_double_multiplier < T, false > ::
+                 operate ( unsigned_type a, unsigned_type b, T & h, T & l )
 
 {
 unsigned_type ah ( high_half ( a ) ),
@@ -818,7 +979,7 @@ l = convert_to < T > ( rl ) ;
 // post: (hl) = a * b
 
 template < class T >
-inline void unsigned_double_multiply ( T a, T b, T & h, T & l )
+constexpr void unsigned_double_multiply ( T a, T b, T & h, T & l )
 
 {
 unsigned_double_multiplier
@@ -847,7 +1008,8 @@ public:
 
   typedef typename numeric_traits < T > :: unsigned_type unsigned_type ;
 
-  static T operate ( unsigned_type h, unsigned_type l, unsigned_type b ) ;
+  static constexpr T
+    operate ( unsigned_type h, unsigned_type l, unsigned_type b ) ;
 
 } ;
 
@@ -855,8 +1017,8 @@ public:
 //
 
 template < class T >
-inline T unsigned_double_divider < T, true > ::
-           operate ( unsigned_type h, unsigned_type l, unsigned_type b )
+constexpr T unsigned_double_divider < T, true > ::
+              operate ( unsigned_type h, unsigned_type l, unsigned_type b )
 
 {
 typedef typename numeric_traits < unsigned_type > :: double_size_type
@@ -880,7 +1042,8 @@ public:
 
   typedef typename numeric_traits < T > :: unsigned_type unsigned_type ;
 
-  static T operate ( unsigned_type h, unsigned_type l, unsigned_type b ) ;
+  static constexpr T
+    operate ( unsigned_type h, unsigned_type l, unsigned_type b ) ;
 
 } ;
 
@@ -888,8 +1051,8 @@ public:
 //
 
 template < class T >
-inline T unsigned_double_divider < T, false > ::
-           operate ( unsigned_type h, unsigned_type l, unsigned_type b )
+constexpr T unsigned_double_divider < T, false > ::
+              operate ( unsigned_type h, unsigned_type l, unsigned_type b )
 
 {
 unsigned_type bh ( high_half ( b ) ),
@@ -972,7 +1135,7 @@ return convert_to < T > ( low_half_high ( rh ) + rl ) ;
 // returns: (hl) / b
 
 template < class T >
-inline T unsigned_double_divide ( T h, T l, T b )
+constexpr T unsigned_double_divide ( T h, T l, T b )
 
 {
 #ifndef NDEBUG
@@ -994,11 +1157,163 @@ return unsigned_double_divider
 
 
 
+// *** UNSIGNED_DOUBLE_RECIPROCAL ***
+
+
+// pre: b >= 1 << ( bit_size ( T ) - 1 )
+//
+// returns:   ( ( 1 << ( bit_size ( T ) * 2 ) ) - 1 ) / b
+//          - ( 1 << bit_size ( T ) ),
+//          computed by Newton-Raphson iteration
+
+template < class T >
+constexpr T unsigned_double_reciprocal ( T b )
+
+{
+typedef typename numeric_traits < T > :: unsigned_type unsigned_type ;
+
+const sint bit_size = numeric_traits < unsigned_type > :: bit_size ;
+
+unsigned_type d ( b ) ;
+
+assert ( d >= unsigned_type ( 1 ) << ( bit_size - 1 ) ) ;
+
+if ( d == unsigned_type ( 1 ) << ( bit_size - 1 ) )
+  return T ( unsigned_type ( -1 ) ) ;
+
+// x = ( 1 << bit_size ) + v approximates ( 1 << ( bit_size * 2 ) ) / d
+// from below, starting with 2 - d / ( 1 << bit_size )
+
+unsigned_type v ( ~ d ), el ( 0 ) ;
+
+for ( ; ; )
+  {
+  // (eh el) = ( 1 << ( bit_size * 2 ) ) - d * x
+
+  unsigned_type ph ( 0 ), pl ( 0 ) ;
+
+  if ( v != 0 )
+    unsigned_double_multiply ( d, v, ph, pl ) ;
+
+  unsigned_type eh ( - unsigned_type ( d + ph ) ) ;
+
+  if ( pl != 0 )
+    -- eh ;
+
+  el = unsigned_type ( - pl ) ;
+
+  if ( eh == 0 )
+    break ;
+
+  // x += x * e >> ( bit_size * 2 ), truncated
+
+  unsigned_type th ( 0 ), tl ( 0 ) ;
+
+  if ( v != 0 )
+    unsigned_double_multiply ( v, eh, th, tl ) ;
+
+  v = unsigned_type ( v + eh + th ) ;
+  }
+
+// ( 1 << ( bit_size * 2 ) ) - 1 - d * x is in [ 0, 2 * d )
+
+if ( unsigned_type ( el - 1 ) >= d )
+  ++ v ;
+
+return T ( v ) ;
+}
+
+
+// pre: b >= 1 << ( bit_size ( T ) - 1 )
+//      h < b
+//      v = unsigned_double_reciprocal ( b )
+//
+// returns: (hl) / b
+
+template < class T >
+constexpr T unsigned_double_divide ( T h, T l, T b, T v )
+
+{
+typedef typename numeric_traits < T > :: unsigned_type unsigned_type ;
+
+unsigned_type uh ( h ), ul ( l ), ub ( b ) ;
+
+assert ( uh < ub ) ;
+
+unsigned_type qh ( 0 ), ql ( 0 ) ;
+
+if ( uh != 0  &&  unsigned_type ( v ) != 0 )
+  unsigned_double_multiply ( unsigned_type ( v ), uh, qh, ql ) ;
+
+ql = unsigned_type ( ql + ul ) ;
+qh = unsigned_type ( qh + uh + 1 ) ;
+
+if ( ql < ul )
+  ++ qh ;
+
+unsigned_type r ( unsigned_type ( ul - unsigned_type ( qh * ub ) ) ) ;
+
+if ( r > ql )
+  {
+  -- qh ;
+  r = unsigned_type ( r + ub ) ;
+  }
+
+if ( r >= ub )
+  ++ qh ;
+
+return T ( qh ) ;
+}
+
+
+
 // *** EXPONENT ***
 
 
+// portable implementation, by shifting
+
+template < class T >
+constexpr sint generic_exponent ( T x )
+
+{
+typedef typename numeric_traits < T > :: unsigned_type unsigned_type ;
+
+unsigned_type y ( static_cast < unsigned_type > ( x ) ) ;
+
+sint result ( 0 ) ;
+
+while ( y != unsigned_type ( 0 ) )
+  {
+  y >>= 1 ;
+  ++ result ;
+  }
+
+return result ;
+}
+
+
 //
 
+#ifdef __builtin_bit_operations__
+
+#define __DEFINE_EXPONENT(Type)                                              \
+                                                                             \
+constexpr sint const_exponent ( Type x )                                     \
+                                                                             \
+{                                                                            \
+return x == Type ( 0 ) ? 0 : const_exponent ( Type ( x >> 1 ) ) + 1 ;        \
+}                                                                            \
+                                                                             \
+constexpr sint exponent ( Type x )                                           \
+                                                                             \
+{                                                                            \
+return   x == Type ( 0 )                                                     \
+       ? 0                                                                   \
+       : 64 - __builtin_clzll ( static_cast < unsigned_long_long > ( x ) ) ; \
+}
+
+#else
+
 #define __DEFINE_EXPONENT(Type)                                       \
                                                                       \
 constexpr sint const_exponent ( Type x )                              \
@@ -1007,20 +1322,14 @@ constexpr sint const_exponent ( Type x )                              \
 return x == Type ( 0 ) ? 0 : const_exponent ( Type ( x >> 1 ) ) + 1 ; \
 }                                                                     \
                                                                       \
-inline sint exponent ( Type x )                                       \
+constexpr sint exponent ( Type x )                                    \
                                                                       \
 {                                                                     \
-sint result ( 0 ) ;                                                   \
-                                                                      \
-while ( x != Type ( 0 ) )                                             \
-  {                                                                   \
-  x >>= 1 ;                                                           \
-  ++ result ;                                                         \
-  }                                                                   \
-                                                                      \
-return result ;                                                       \
+return generic_exponent ( x ) ;                                       \
 }
 
+#endif
+
 FOR_BUILTIN_UNSIGNED_INTEGRAL_TYPES(__DEFINE_EXPONENT)
 
 #undef __DEFINE_EXPONENT
@@ -1041,7 +1350,7 @@ return                                                                        \
       ( static_cast < numeric_traits < Type > :: unsigned_type > ( x ) ) ;    \
 }                                                                             \
                                                                               \
-inline sint exponent ( Type x )                                               \
+constexpr sint exponent ( Type x )                                            \
                                                                               \
 {                                                                             \
 if ( x < Type ( 0 ) )                                                         \
@@ -1076,11 +1385,66 @@ FOR_BUILTIN_FLOATING_POINT_TYPES(__DEFINE_EXPONENT)
 
 
 
+// *** TRAILING_ZERO_COUNT ***
+
+
+// portable implementation, through the exponent of the lowest set bit
+
+template < class T >
+constexpr sint generic_trailing_zero_count ( T x )
+
+{
+typedef typename numeric_traits < T > :: unsigned_type unsigned_type ;
+
+unsigned_type y ( static_cast < unsigned_type > ( x ) ) ;
+
+return   y == unsigned_type ( 0 )
+       ? numeric_traits < T > :: bit_size
+       : generic_exponent ( unsigned_type ( y & unsigned_type ( - y ) ) ) - 1 ;
+}
+
+
+// returns: number of trailing zero bits of x, bit_size ( Type ) for x = 0
+
+#ifdef __builtin_bit_operations__
+
+#define __DEFINE_TRAILING_ZERO_COUNT(Type)                       \
+                                                                 \
+constexpr sint trailing_zero_count ( Type x )                    \
+                                                                 \
+{                                                                \
+typedef numeric_traits < Type > :: unsigned_type unsigned_type ; \
+                                                                 \
+return   x == Type ( 0 )                                         \
+       ? numeric_traits < Type > :: bit_size                     \
+       : __builtin_ctzll                                         \
+           ( static_cast < unsigned_long_long >                  \
+               ( static_cast < unsigned_type > ( x ) ) ) ;       \
+}
+
+#else
+
+#define __DEFINE_TRAILING_ZERO_COUNT(Type)    \
+                                              \
+constexpr sint trailing_zero_count ( Type x ) \
+                                              \
+{                                             \
+return generic_trailing_zero_count ( x ) ;    \
+}
+
+#endif
+
+FOR_BUILTIN_INTEGRAL_TYPES(__DEFINE_TRAILING_ZERO_COUNT)
+
+#undef __DEFINE_TRAILING_ZERO_COUNT
+
+
+
 // *** IS_NEGATIVE ***
 
 
 template < class T >
-inline bool is_negative ( const T & x )
+constexpr bool is_negative ( const T & x )
 
 {
 return x < T ( 0 ) ;
@@ -1092,7 +1456,7 @@ return x < T ( 0 ) ;
 
 
 template < class T >
-inline T abs ( const T & x )
+constexpr T abs ( const T & x )
 
 {
 return is_negative ( x ) ? - x : x ;
@@ -1481,4 +1845,152 @@ FOR_BUILTIN_FLOATING_POINT_TYPES(__DEFINE_PIVOTING_COMPARE)
 
 
 
+// *** INVARIANT_DIVIDER ***
+
+
+//
+
+template < class T, bool IsSigned = numeric_traits < T > :: is_signed >
+class invariant_divider ;
+
+
+// quotient ( a ) = ( h + ( ( a - h ) >> shift_1 ) ) >> shift_2,
+// where h is the high half of multiplier * a
+
+template < class T >
+class invariant_divider < T, false >
+
+{
+private:
+
+  T divisor_ ;
+  T multiplier ;
+  sint shift_1, shift_2 ;
+
+public:
+
+  invariant_divider ( ) :
+    divisor_ ( 1 ),
+    multiplier ( 1 ),
+    shift_1 ( 0 ),
+    shift_2 ( 0 )
+    { }
+
+  // pre: d > 0
+
+  explicit invariant_divider ( const T & d ) :
+    divisor_ ( d )
+    { assert ( d > T ( 0 ) ) ;
+      const sint bit_size = numeric_traits < T > :: bit_size ;
+      sint l = exponent ( T ( d - T ( 1 ) ) ),
+           s = bit_size - exponent ( d ) ;
+      T h ( l < bit_size ? T ( T ( 1 ) << l ) : T ( 0 ) ) ;
+      h = T ( h - d ) ;
+      multiplier =   unsigned_double_divide
+                       ( T ( h << s ), T ( 0 ), T ( d << s ) )
+                   + T ( 1 ) ;
+      shift_1 = l > 0 ? 1 : 0 ;
+      shift_2 = l > 0 ? l - 1 : 0 ; }
+
+  const T & divisor ( ) const
+    { return divisor_ ; }
+
+  T quotient ( const T & a ) const
+    { T h, l ;
+      unsigned_double_multiply ( multiplier, a, h, l ) ;
+      return unsigned_shift_right
+               ( T ( h + unsigned_shift_right ( T ( a - h ), shift_1 ) ),
+                 shift_2 ) ; }
+
+  T remainder ( const T & a ) const
+    { return T ( a - quotient ( a ) * divisor_ ) ; }
+
+  void divmod ( const T & a, T & q, T & r ) const
+    { q = quotient ( a ) ;
+      r = T ( a - q * divisor_ ) ; }
+
+  friend T operator / ( const T & a, const invariant_divider & b )
+    { return b.quotient ( a ) ; }
+
+  friend T operator % ( const T & a, const invariant_divider & b )
+    { return b.remainder ( a ) ; }
+
+} ;
+
+
+// quotient and remainder are truncated, like the builtin / and %
+
+template < class T >
+class invariant_divider < T, true >
+
+{
+public:
+
+  typedef typename numeric_traits < T > :: unsigned_type unsigned_type ;
+
+private:
+
+  T divisor_ ;
+  invariant_divider < unsigned_type > unsigned_divider ;
+  bool negative ;
+
+  static unsigned_type unsigned_abs ( const T & x )
+    { return   is_negative ( x )
+             ? unsigned_type ( - unsigned_type ( x ) )
+             : unsigned_type ( x ) ; }
+
+public:
+
+  invariant_divider ( ) :
+    divisor_ ( 1 ),
+    unsigned_divider ( ),
+    negative ( false )
+    { }
+
+  // pre: d != 0
+
+  explicit invariant_divider ( const T & d ) :
+    divisor_ ( d ),
+    unsigned_divider ( unsigned_abs ( d ) ),
+    negative ( is_negative ( d ) )
+    { }
+
+  const T & divisor ( ) const
+    { return divisor_ ; }
+
+  T quotient ( const T & a ) const
+    { unsigned_type q ( unsigned_divider.quotient ( unsigned_abs ( a ) ) ) ;
+      return convert_to < T >
+               ( is_negative ( a ) != negative ? unsigned_type ( - q ) : q ) ; }
+
+  T remainder ( const T & a ) const
+    { return T ( a - quotient ( a ) * divisor_ ) ; }
+
+  void divmod ( const T & a, T & q, T & r ) const
+    { q = quotient ( a ) ;
+      r = T ( a - q * divisor_ ) ; }
+
+  friend T operator / ( const T & a, const invariant_divider & b )
+    { return b.quotient ( a ) ; }
+
+  friend T operator % ( const T & a, const invariant_divider & b )
+    { return b.remainder ( a ) ; }
+
+} ;
+
+
+//
+
+template < class T >
+inline void divmod ( const T & a,
+                     const invariant_divider < T > & b,
+                     T & q,
+                     T & r )
+
+{
+b.divmod ( a, q, r ) ;
+}
+
+
+
 #endif
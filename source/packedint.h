@@ -0,0 +1,1114 @@
+// Copyright Ivan Stanojevic 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+
+
+
+#ifndef __PACKEDINT_H
+
+#define __PACKEDINT_H
+
+
+
+#include "memory.h"
+#include "cstddef.h"
+#include "iterator.h"
+#include "initializer_list.h"
+#include "cassert.h"
+#include "stdexcept.h"
+#include "utility.h"
+#include "algorithm.h"
+#include "array.h"
+
+#include "numbase.h"
+#include "bitref.h"
+#include "bitvector.h"
+#include "smallint.h"
+
+
+
+// *** FORWARD DECLARATIONS ***
+
+
+//
+
+template < class SmallInt, class Word >
+class packed_small_int_reference ;
+
+template < class SmallInt, class Word >
+class packed_small_int_iterator ;
+
+template < class SmallInt, class Word >
+class const_packed_small_int_iterator ;
+
+template < class SmallInt,
+           class Word = uint,
+           class Allocator = allocator < Word > >
+class basic_packed_small_int_vector ;
+
+
+
+// *** PACKED LANES ***
+
+
+// Words holding lane_number adjacent lanes of lane_bit_size bits each
+// are processed lane by lane with ordinary word arithmetic.
+//
+// returns: word with the lowest bit of each lane set
+
+template < class Word >
+constexpr Word packed_lane_low_bits ( size_t lane_bit_size,
+                                      size_t lane_number )
+
+{
+Word result ( 0 ) ;
+
+for ( size_t i = 0 ; i < lane_number ; ++ i )
+  result |= Word ( 1 ) << ( i * lane_bit_size ) ;
+
+return result ;
+}
+
+
+// pre: high_bits has the highest bit of each lane set
+//
+// returns: high_bits lanes for which lane of a >= lane of b,
+//          lanes compared as unsigned
+
+template < class Word >
+inline Word packed_lane_greater_equal ( Word a, Word b, Word high_bits )
+
+{
+Word d = ( a | high_bits ) - ( b & ~ high_bits ) ;
+
+return ( ( a & ~ b ) | ( ~ ( a ^ b ) & d ) ) & high_bits ;
+}
+
+
+
+// *** PACKED_SMALL_INT_REFERENCE ***
+
+
+template < class SmallInt, class Word >
+class packed_small_int_reference
+
+{
+private:
+
+  template < class SmallInt2, class Word2, class Allocator >
+  friend class basic_packed_small_int_vector ;
+
+  friend class packed_small_int_iterator < SmallInt, Word > ;
+
+  static constexpr size_t bit_size = numeric_traits < SmallInt > :: bit_size ;
+
+  bit_iterator < Word > position ;
+
+  explicit packed_small_int_reference
+             ( const bit_iterator < Word > & i_position ) noexcept :
+    position ( i_position )
+    { }
+
+public:
+
+  packed_small_int_reference ( const packed_small_int_reference & x ) =
+    default ;
+
+  SmallInt value ( ) const noexcept
+    { return SmallInt ( typename SmallInt :: unsigned_value_type
+                          ( position.word ( bit_size ) ) ) ; }
+
+  operator SmallInt ( ) const noexcept
+    { return value ( ) ; }
+
+  void assign ( const SmallInt & x ) noexcept
+    { position.assign_word ( Word ( x.unsigned_data ( ) ), bit_size ) ; }
+
+  void non_atomic_assign ( const SmallInt & x ) noexcept
+    { position.non_atomic_assign_word ( Word ( x.unsigned_data ( ) ),
+                                        bit_size ) ; }
+
+  packed_small_int_reference & operator = ( const SmallInt & x ) noexcept
+    { assign ( x ) ;
+      return * this ; }
+
+  packed_small_int_reference &
+    operator = ( const packed_small_int_reference & x ) noexcept
+    { return operator = ( x.value ( ) ) ; }
+
+  packed_small_int_reference & operator += ( const SmallInt & x ) noexcept
+    { return operator = ( value ( ) + x ) ; }
+
+  packed_small_int_reference & operator -= ( const SmallInt & x ) noexcept
+    { return operator = ( value ( ) - x ) ; }
+
+  packed_small_int_reference & operator &= ( const SmallInt & x ) noexcept
+    { return operator = ( value ( ) & x ) ; }
+
+  packed_small_int_reference & operator |= ( const SmallInt & x ) noexcept
+    { return operator = ( value ( ) | x ) ; }
+
+  packed_small_int_reference & operator ^= ( const SmallInt & x ) noexcept
+    { return operator = ( value ( ) ^ x ) ; }
+
+  packed_small_int_reference & operator ++ ( ) noexcept
+    { return operator = ( value ( ) + SmallInt ( 1 ) ) ; }
+
+  packed_small_int_reference & operator -- ( ) noexcept
+    { return operator = ( value ( ) - SmallInt ( 1 ) ) ; }
+
+} ;
+
+
+//
+
+template < class SmallInt, class Word1, class Word2 >
+inline void swap ( packed_small_int_reference < SmallInt, Word1 > a,
+                   packed_small_int_reference < SmallInt, Word2 > b ) noexcept
+
+{
+SmallInt t = a ;
+a = b ;
+b = t ;
+}
+
+
+//
+
+template < class SmallInt, class Word >
+inline void swap ( packed_small_int_reference < SmallInt, Word > a,
+                   SmallInt & b ) noexcept
+
+{
+SmallInt t = a ;
+a = b ;
+b = t ;
+}
+
+
+//
+
+template < class SmallInt, class Word >
+inline void swap ( SmallInt & a,
+                   packed_small_int_reference < SmallInt, Word > b ) noexcept
+
+{
+SmallInt t = a ;
+a = b ;
+b = t ;
+}
+
+
+
+// *** PACKED_SMALL_INT_ITERATOR ***
+
+
+template < class SmallInt, class Word >
+class packed_small_int_iterator
+
+{
+private:
+
+  template < class SmallInt2, class Word2, class Allocator >
+  friend class basic_packed_small_int_vector ;
+
+  friend class const_packed_small_int_iterator < SmallInt, Word > ;
+
+  static constexpr ptrdiff_t
+    bit_size = numeric_traits < SmallInt > :: bit_size ;
+
+  bit_iterator < Word > position ;
+
+  explicit packed_small_int_iterator
+             ( const bit_iterator < Word > & i_position ) noexcept :
+    position ( i_position )
+    { }
+
+public:
+
+  typedef ptrdiff_t difference_type ;
+  typedef SmallInt value_type ;
+  typedef packed_small_int_iterator pointer ;
+  typedef packed_small_int_reference < SmallInt, Word > reference ;
+  typedef random_access_iterator_tag iterator_category ;
+
+  packed_small_int_iterator ( ) noexcept
+    { }
+
+  reference operator * ( ) const noexcept
+    { return reference ( position ) ; }
+
+  packed_small_int_iterator & operator ++ ( ) noexcept
+    { position += bit_size ;
+      return * this ; }
+
+  packed_small_int_iterator operator ++ ( int ) noexcept
+    { packed_small_int_iterator t ( * this ) ;
+      ++ * this ;
+      return t ; }
+
+  packed_small_int_iterator & operator -- ( ) noexcept
+    { position -= bit_size ;
+      return * this ; }
+
+  packed_small_int_iterator operator -- ( int ) noexcept
+    { packed_small_int_iterator t ( * this ) ;
+      -- * this ;
+      return t ; }
+
+  packed_small_int_iterator & operator += ( ptrdiff_t n ) noexcept
+    { position += n * bit_size ;
+      return * this ; }
+
+  packed_small_int_iterator & operator -= ( ptrdiff_t n ) noexcept
+    { position -= n * bit_size ;
+      return * this ; }
+
+  friend packed_small_int_iterator
+    operator + ( const packed_small_int_iterator & a, ptrdiff_t b ) noexcept
+    { return packed_small_int_iterator ( a ) += b ; }
+
+  friend packed_small_int_iterator
+    operator + ( ptrdiff_t a, const packed_small_int_iterator & b ) noexcept
+    { return packed_small_int_iterator ( b ) += a ; }
+
+  friend packed_small_int_iterator
+    operator - ( const packed_small_int_iterator & a, ptrdiff_t b ) noexcept
+    { return packed_small_int_iterator ( a ) -= b ; }
+
+  friend ptrdiff_t operator - ( const packed_small_int_iterator & a,
+                                const packed_small_int_iterator & b ) noexcept
+    { return ( a.position - b.position ) / bit_size ; }
+
+  reference operator [ ] ( ptrdiff_t n ) const noexcept
+    { return * ( * this + n ) ; }
+
+  friend bool operator == ( const packed_small_int_iterator & a,
+                            const packed_small_int_iterator & b ) noexcept
+    { return a.position == b.position ; }
+
+  friend bool operator < ( const packed_small_int_iterator & a,
+                           const packed_small_int_iterator & b ) noexcept
+    { return a.position < b.position ; }
+
+} ;
+
+
+
+// *** CONST_PACKED_SMALL_INT_ITERATOR ***
+
+
+template < class SmallInt, class Word >
+class const_packed_small_int_iterator
+
+{
+private:
+
+  template < class SmallInt2, class Word2, class Allocator >
+  friend class basic_packed_small_int_vector ;
+
+  friend class packed_small_int_iterator < SmallInt, Word > ;
+
+  static constexpr ptrdiff_t
+    bit_size = numeric_traits < SmallInt > :: bit_size ;
+
+  const_bit_iterator < Word > position ;
+
+  explicit const_packed_small_int_iterator
+             ( const const_bit_iterator < Word > & i_position ) noexcept :
+    position ( i_position )
+    { }
+
+public:
+
+  typedef ptrdiff_t difference_type ;
+  typedef SmallInt value_type ;
+  typedef const_packed_small_int_iterator pointer ;
+  typedef SmallInt reference ;
+  typedef random_access_iterator_tag iterator_category ;
+
+  const_packed_small_int_iterator ( ) noexcept
+    { }
+
+  const_packed_small_int_iterator
+    ( const packed_small_int_iterator < SmallInt, Word > & x ) noexcept :
+    position ( x.position )
+    { }
+
+  reference operator * ( ) const noexcept
+    { return SmallInt ( typename SmallInt :: unsigned_value_type
+                          ( position.word ( bit_size ) ) ) ; }
+
+  const_packed_small_int_iterator & operator ++ ( ) noexcept
+    { position += bit_size ;
+      return * this ; }
+
+  const_packed_small_int_iterator operator ++ ( int ) noexcept
+    { const_packed_small_int_iterator t ( * this ) ;
+      ++ * this ;
+      return t ; }
+
+  const_packed_small_int_iterator & operator -- ( ) noexcept
+    { position -= bit_size ;
+      return * this ; }
+
+  const_packed_small_int_iterator operator -- ( int ) noexcept
+    { const_packed_small_int_iterator t ( * this ) ;
+      -- * this ;
+      return t ; }
+
+  const_packed_small_int_iterator & operator += ( ptrdiff_t n ) noexcept
+    { position += n * bit_size ;
+      return * this ; }
+
+  const_packed_small_int_iterator & operator -= ( ptrdiff_t n ) noexcept
+    { position -= n * bit_size ;
+      return * this ; }
+
+  friend const_packed_small_int_iterator
+    operator + ( const const_packed_small_int_iterator & a,
+                 ptrdiff_t b ) noexcept
+    { return const_packed_small_int_iterator ( a ) += b ; }
+
+  friend const_packed_small_int_iterator
+    operator + ( ptrdiff_t a,
+                 const const_packed_small_int_iterator & b ) noexcept
+    { return const_packed_small_int_iterator ( b ) += a ; }
+
+  friend const_packed_small_int_iterator
+    operator - ( const const_packed_small_int_iterator & a,
+                 ptrdiff_t b ) noexcept
+    { return const_packed_small_int_iterator ( a ) -= b ; }
+
+  friend ptrdiff_t
+    operator - ( const const_packed_small_int_iterator & a,
+                 const const_packed_small_int_iterator & b ) noexcept
+    { return ( a.position - b.position ) / bit_size ; }
+
+  reference operator [ ] ( ptrdiff_t n ) const noexcept
+    { return * ( * this + n ) ; }
+
+  friend bool
+    operator == ( const const_packed_small_int_iterator & a,
+                  const const_packed_small_int_iterator & b ) noexcept
+    { return a.position == b.position ; }
+
+  friend bool
+    operator < ( const const_packed_small_int_iterator & a,
+                 const const_packed_small_int_iterator & b ) noexcept
+    { return a.position < b.position ; }
+
+} ;
+
+
+
+// *** BASIC_PACKED_SMALL_INT_VECTOR ***
+
+
+// Elements of type SmallInt ( signed_small_int or unsigned_small_int )
+// are stored back to back, element_bit_size bits each, in a bit vector.
+// Element i occupies bits [ i * element_bit_size,
+// ( i + 1 ) * element_bit_size ) and may straddle two words.
+//
+// Element access through references is atomic with respect to other
+// elements, like basic_bit_vector.  Bulk operations ( fill, pack, resize )
+// write whole words and are not.
+//
+// sum, minimum, maximum and the counts work on whole words at a time and
+// order elements by value, i.e. by signed_data ( ) for signed elements.
+
+template < class SmallInt, class Word, class Allocator >
+class basic_packed_small_int_vector
+
+{
+public:
+
+  typedef Word word_type ;
+
+  typedef SmallInt value_type ;
+  typedef size_t size_type ;
+  typedef ptrdiff_t difference_type ;
+
+  typedef Allocator allocator_type ;
+
+  typedef packed_small_int_iterator < SmallInt, Word > iterator ;
+  typedef const_packed_small_int_iterator < SmallInt, Word > const_iterator ;
+
+  typedef packed_small_int_reference < SmallInt, Word > reference ;
+  typedef SmallInt const_reference ;
+
+  typedef iterator pointer ;
+  typedef const_iterator const_pointer ;
+
+  typedef typename SmallInt :: unsigned_value_type unsigned_value_type ;
+
+  static constexpr size_t word_bit_size = numeric_traits < Word > :: bit_size ;
+
+  static constexpr size_t
+    element_bit_size = numeric_traits < SmallInt > :: bit_size ;
+
+  static_assert ( element_bit_size <= word_bit_size,
+                  "Illegal element bit size." ) ;
+
+  static constexpr size_t lane_number = word_bit_size / element_bit_size ;
+
+private:
+
+  static constexpr size_t log2_word_bit_size =
+                            const_exponent ( word_bit_size ) - 1 ;
+
+  static constexpr size_t word_bit_size_1 = word_bit_size - 1 ;
+
+  static constexpr size_t lane_bit_size = lane_number * element_bit_size ;
+
+  static constexpr Word
+    element_mask = Word ( -1 ) >> ( word_bit_size - element_bit_size ) ;
+
+  static constexpr Word
+    lane_low_bits = packed_lane_low_bits < Word > ( element_bit_size,
+                                                    lane_number ) ;
+
+  static constexpr Word
+    lane_high_bits = lane_low_bits << ( element_bit_size - 1 ) ;
+
+  static constexpr Word
+    sign_bits =   numeric_traits < SmallInt > :: is_signed
+                ? lane_high_bits
+                : Word ( 0 ) ;
+
+  static constexpr Word sign_bit = sign_bits & element_mask ;
+
+  basic_bit_vector < Word, Allocator > bits_ ;
+
+  static Word lane_select_mask ( Word greater_equal ) noexcept
+    { return ( greater_equal >> ( element_bit_size - 1 ) ) * element_mask ; }
+
+  static SmallInt element ( Word w ) noexcept
+    { return SmallInt ( unsigned_value_type ( w ) ) ; }
+
+  static Word fill_pattern ( size_t phase, const SmallInt & x ) noexcept ;
+
+  template < class InputIterator >
+  InputIterator write_n ( size_t position,
+                          InputIterator first,
+                          size_t n ) ;
+
+  Word lane_extremum ( size_t position, size_t n, bool maximum ) const ;
+
+  template < class InputIterator >
+  void copy_from_range ( InputIterator first,
+                         InputIterator last,
+                         input_iterator_tag )
+    { clear ( ) ;
+      for ( ; first != last ; ++ first )
+        push_back ( * first ) ; }
+
+  template < class ForwardIterator >
+  void copy_from_range ( ForwardIterator first,
+                         ForwardIterator last,
+                         forward_iterator_tag )
+    { size_t n = distance ( first, last ) ;
+      bits_.resize ( n * element_bit_size ) ;
+      write_n ( 0, first, n ) ; }
+
+public:
+
+  explicit basic_packed_small_int_vector
+             ( const Allocator & a = Allocator ( ) ) :
+    bits_ ( a )
+    { }
+
+  explicit basic_packed_small_int_vector
+             ( size_t n,
+               const SmallInt & x = SmallInt ( ),
+               const Allocator & a = Allocator ( ) ) :
+    bits_ ( n * element_bit_size, false, a )
+    { fill ( 0, n, x ) ; }
+
+  template < class InputIterator >
+  basic_packed_small_int_vector
+    ( InputIterator first,
+      enable_if_t < is_input_iterator_v < InputIterator >, InputIterator >
+        last,
+      const Allocator & a = Allocator ( ) ) :
+    bits_ ( a )
+    { pack ( first, last ) ; }
+
+  basic_packed_small_int_vector ( initializer_list < SmallInt > l,
+                                  const Allocator & a = Allocator ( ) ) :
+    bits_ ( a )
+    { pack ( l.begin ( ), l.end ( ) ) ; }
+
+  void assign ( size_t n, const SmallInt & x )
+    { bits_.assign ( n * element_bit_size, false ) ;
+      fill ( 0, n, x ) ; }
+
+  template < class InputIterator >
+  void assign ( InputIterator first,
+                enable_if_t < is_input_iterator_v < InputIterator >,
+                              InputIterator >
+                  last )
+    { pack ( first, last ) ; }
+
+  void assign ( initializer_list < SmallInt > l )
+    { pack ( l.begin ( ), l.end ( ) ) ; }
+
+  Allocator get_allocator ( ) const
+    { return bits_.get_allocator ( ) ; }
+
+  iterator begin ( ) noexcept
+    { return iterator ( bits_.begin ( ) ) ; }
+
+  const_iterator begin ( ) const noexcept
+    { return const_iterator ( bits_.begin ( ) ) ; }
+
+  iterator end ( ) noexcept
+    { return iterator ( bits_.end ( ) ) ; }
+
+  const_iterator end ( ) const noexcept
+    { return const_iterator ( bits_.end ( ) ) ; }
+
+  const_iterator cbegin ( ) const noexcept
+    { return begin ( ) ; }
+
+  const_iterator cend ( ) const noexcept
+    { return end ( ) ; }
+
+  size_t size ( ) const noexcept
+    { return bits_.size ( ) / element_bit_size ; }
+
+  size_t max_size ( ) const noexcept
+    { return bits_.max_size ( ) / element_bit_size ; }
+
+  void resize ( size_t n, const SmallInt & x = SmallInt ( ) )
+    { size_t old_size = size ( ) ;
+      bits_.resize ( n * element_bit_size ) ;
+      if ( n > old_size )
+        fill ( old_size, n - old_size, x ) ; }
+
+  size_t capacity ( ) const noexcept
+    { return bits_.capacity ( ) / element_bit_size ; }
+
+  bool empty ( ) const noexcept
+    { return bits_.empty ( ) ; }
+
+  void reserve ( size_t n )
+    { bits_.reserve ( n * element_bit_size ) ; }
+
+  void shrink_to_fit ( )
+    { bits_.shrink_to_fit ( ) ; }
+
+  reference access ( size_t n ) noexcept
+    { assert ( n < size ( ) ) ;
+      return reference ( bits_.begin ( ) + n * element_bit_size ) ; }
+
+  const_reference access ( size_t n ) const noexcept
+    { assert ( n < size ( ) ) ;
+      return element ( ( bits_.begin ( ) + n * element_bit_size ).word
+                         ( element_bit_size ) ) ; }
+
+  reference at ( size_t n )
+    { if ( n >= size ( ) )
+        throw out_of_range
+                ( "packed_small_int_vector :: at, index out of range" ) ;
+      return access ( n ) ; }
+
+  const_reference at ( size_t n ) const
+    { if ( n >= size ( ) )
+        throw out_of_range
+                ( "packed_small_int_vector :: at, index out of range" ) ;
+      return access ( n ) ; }
+
+  reference operator [ ] ( size_t n ) noexcept
+    { return access ( n ) ; }
+
+  const_reference operator [ ] ( size_t n ) const noexcept
+    { return access ( n ) ; }
+
+  reference front ( ) noexcept
+    { return access ( 0 ) ; }
+
+  const_reference front ( ) const noexcept
+    { return access ( 0 ) ; }
+
+  reference back ( ) noexcept
+    { return access ( size ( ) - 1 ) ; }
+
+  const_reference back ( ) const noexcept
+    { return access ( size ( ) - 1 ) ; }
+
+  const basic_bit_vector < Word, Allocator > & bits ( ) const noexcept
+    { return bits_ ; }
+
+  Word * data ( ) noexcept
+    { return bits_.data ( ) ; }
+
+  const Word * data ( ) const noexcept
+    { return bits_.data ( ) ; }
+
+  void push_back ( const SmallInt & x )
+    { bits_.append ( Word ( x.unsigned_data ( ) ), element_bit_size ) ; }
+
+  void emplace_back ( const SmallInt & x )
+    { push_back ( x ) ; }
+
+  void pop_back ( )
+    { assert ( ! empty ( ) ) ;
+      bits_.resize ( bits_.size ( ) - element_bit_size ) ; }
+
+  void clear ( ) noexcept
+    { bits_.clear ( ) ; }
+
+  void swap ( basic_packed_small_int_vector & x ) noexcept
+    { bits_.swap ( x.bits_ ) ; }
+
+  void fill ( size_t position, size_t n, const SmallInt & x ) ;
+
+  void fill ( const SmallInt & x )
+    { fill ( 0, size ( ), x ) ; }
+
+  template < class InputIterator >
+  void pack ( InputIterator first, InputIterator last )
+    { copy_from_range ( first,
+                        last,
+                        typename    iterator_traits < InputIterator >
+                                 :: iterator_category ( ) ) ; }
+
+  template < class InputIterator >
+  InputIterator pack_n ( size_t position, InputIterator first, size_t n )
+    { assert ( position + n <= size ( ) ) ;
+      return write_n ( position, first, n ) ; }
+
+  template < class OutputIterator >
+  OutputIterator unpack ( size_t position,
+                          size_t n,
+                          OutputIterator result ) const ;
+
+  template < class OutputIterator >
+  OutputIterator unpack ( OutputIterator result ) const
+    { return unpack ( 0, size ( ), result ) ; }
+
+  // returns: sum of the elements
+  //
+  // pre: the sum is representable as sint
+
+  sint sum ( size_t position, size_t n ) const ;
+
+  sint sum ( ) const
+    { return sum ( 0, size ( ) ) ; }
+
+  SmallInt minimum ( size_t position, size_t n ) const
+    { return element ( lane_extremum ( position, n, false ) ) ; }
+
+  SmallInt minimum ( ) const
+    { return minimum ( 0, size ( ) ) ; }
+
+  SmallInt maximum ( size_t position, size_t n ) const
+    { return element ( lane_extremum ( position, n, true ) ) ; }
+
+  SmallInt maximum ( ) const
+    { return maximum ( 0, size ( ) ) ; }
+
+  size_t count_less ( size_t position, size_t n, const SmallInt & x ) const ;
+
+  size_t count_less ( const SmallInt & x ) const
+    { return count_less ( 0, size ( ), x ) ; }
+
+  size_t count_equal ( size_t position,
+                       size_t n,
+                       const SmallInt & x ) const ;
+
+  size_t count_equal ( const SmallInt & x ) const
+    { return count_equal ( 0, size ( ), x ) ; }
+
+  friend bool operator == ( const basic_packed_small_int_vector & a,
+                            const basic_packed_small_int_vector & b )
+    { return a.bits_ == b.bits_ ; }
+
+  // lexicographic, elements being ordered by value like by minimum and
+  // maximum, and not by the modular operator < of signed_small_int
+
+  friend bool operator < ( const basic_packed_small_int_vector & a,
+                           const basic_packed_small_int_vector & b )
+    { const Word * ad = a.bits_.data ( ) ;
+      size_t n = min ( a.size ( ), b.size ( ) ),
+             nw = ( n * element_bit_size + word_bit_size_1 )
+                  >> log2_word_bit_size ;
+      size_t i =   (   ( mismatch ( ad, ad + nw, b.bits_.data ( ) ).first - ad )
+                     << log2_word_bit_size )
+                 / element_bit_size ;
+      for ( ; i < n ; ++ i )
+        { Word x = Word ( a [ i ].unsigned_data ( ) ) ^ sign_bit,
+               y = Word ( b [ i ].unsigned_data ( ) ) ^ sign_bit ;
+          if ( x != y )
+            return x < y ; }
+      return a.size ( ) < b.size ( ) ; }
+
+} ;
+
+
+// pre: phase = index of the first bit of the word within its element
+//
+// returns: word of a sequence of elements equal to x
+
+template < class SmallInt, class Word, class Allocator >
+Word basic_packed_small_int_vector < SmallInt, Word, Allocator > ::
+       fill_pattern ( size_t phase, const SmallInt & x ) noexcept
+
+{
+Word v ( x.unsigned_data ( ) ) ;
+
+if ( element_bit_size == word_bit_size )
+  return v ;
+
+Word p ( 0 ) ;
+
+for ( size_t i = 0 ; i < word_bit_size ; i += element_bit_size )
+  p |= v << i ;
+
+return unsigned_shift_right ( v, phase ) | p << ( element_bit_size - phase ) ;
+}
+
+
+//
+
+template < class SmallInt, class Word, class Allocator >
+void basic_packed_small_int_vector < SmallInt, Word, Allocator > ::
+       fill ( size_t position, size_t n, const SmallInt & x )
+
+{
+assert ( position + n <= size ( ) ) ;
+
+if ( n == 0 )
+  return ;
+
+size_t first = position * element_bit_size,
+       last = ( position + n ) * element_bit_size,
+       first_word = first >> log2_word_bit_size,
+       last_word = ( last - 1 ) >> log2_word_bit_size ;
+
+Word * d = bits_.data ( ) ;
+
+for ( size_t i = first_word ; i <= last_word ; ++ i )
+  {
+  Word m ( -1 ) ;
+
+  if ( i == first_word )
+    m &= Word ( -1 ) << ( first & word_bit_size_1 ) ;
+
+  if ( i == last_word )
+    m &= unsigned_shift_right ( Word ( -1 ),
+                                ( - last ) & word_bit_size_1 ) ;
+
+  Word w = fill_pattern ( ( i << log2_word_bit_size ) % element_bit_size,
+                          x ) ;
+
+  d [ i ] = ( d [ i ] & ~ m ) | ( w & m ) ;
+  }
+}
+
+
+//
+
+template < class SmallInt, class Word, class Allocator >
+template < class InputIterator >
+InputIterator basic_packed_small_int_vector < SmallInt, Word, Allocator > ::
+                write_n ( size_t position, InputIterator first, size_t n )
+
+{
+if ( n == 0 )
+  return first ;
+
+size_t bit_offset = position * element_bit_size ;
+
+Word * d = bits_.data ( ) + ( bit_offset >> log2_word_bit_size ) ;
+size_t bit_position = bit_offset & word_bit_size_1 ;
+
+Word w =   bit_position == 0
+         ? Word ( 0 )
+         : * d & unsigned_shift_right ( Word ( -1 ),
+                                        word_bit_size - bit_position ) ;
+
+for ( ; n > 0 ; -- n, ++ first )
+  {
+  Word v ( SmallInt ( * first ).unsigned_data ( ) ) ;
+
+  w |= v << bit_position ;
+  bit_position += element_bit_size ;
+
+  if ( bit_position >= word_bit_size )
+    {
+    * d ++ = w ;
+    bit_position -= word_bit_size ;
+    w =   bit_position == 0
+        ? Word ( 0 )
+        : unsigned_shift_right ( v, element_bit_size - bit_position ) ;
+    }
+  }
+
+if ( bit_position > 0 )
+  * d = w | ( * d & ( Word ( -1 ) << bit_position ) ) ;
+
+return first ;
+}
+
+
+//
+
+template < class SmallInt, class Word, class Allocator >
+template < class OutputIterator >
+OutputIterator basic_packed_small_int_vector < SmallInt, Word, Allocator > ::
+                 unpack ( size_t position,
+                          size_t n,
+                          OutputIterator result ) const
+
+{
+assert ( position + n <= size ( ) ) ;
+
+if ( n == 0 )
+  return result ;
+
+size_t bit_offset = position * element_bit_size ;
+
+const Word * d = bits_.data ( ) + ( bit_offset >> log2_word_bit_size ) ;
+size_t bit_position = bit_offset & word_bit_size_1 ;
+
+for ( ; n > 0 ; -- n, ++ result )
+  {
+  Word v = unsigned_shift_right ( * d, bit_position ) ;
+
+  bit_position += element_bit_size ;
+
+  if ( bit_position >= word_bit_size )
+    {
+    ++ d ;
+    bit_position -= word_bit_size ;
+    if ( bit_position > 0 )
+      v |= * d << ( element_bit_size - bit_position ) ;
+    }
+
+  * result = element ( v & element_mask ) ;
+  }
+
+return result ;
+}
+
+
+// Bit j of the range contributes 2 ^ ( j mod element_bit_size ), negated
+// for the sign bit of signed elements.  The bits of each residue class are
+// counted a word at a time.  The contributions are added as uint, wrapping,
+// since they may overflow when the sum does not, for example for 64 bit
+// signed elements.
+
+template < class SmallInt, class Word, class Allocator >
+sint basic_packed_small_int_vector < SmallInt, Word, Allocator > ::
+       sum ( size_t position, size_t n ) const
+
+{
+assert ( position + n <= size ( ) ) ;
+
+if ( n == 0 )
+  return 0 ;
+
+array < Word, element_bit_size > residue_mask = { } ;
+
+for ( size_t i = 0 ; i < word_bit_size ; ++ i )
+  residue_mask [ i % element_bit_size ] |= Word ( 1 ) << i ;
+
+array < sint, element_bit_size > residue_count = { } ;
+
+size_t first = position * element_bit_size,
+       last = ( position + n ) * element_bit_size,
+       first_word = first >> log2_word_bit_size,
+       last_word = ( last - 1 ) >> log2_word_bit_size ;
+
+const Word * d = bits_.data ( ) ;
+
+for ( size_t i = first_word ; i <= last_word ; ++ i )
+  {
+  Word w = d [ i ] ;
+
+  if ( i == first_word )
+    w &= Word ( -1 ) << ( first & word_bit_size_1 ) ;
+
+  if ( i == last_word )
+    w &= unsigned_shift_right ( Word ( -1 ),
+                                ( - last ) & word_bit_size_1 ) ;
+
+  size_t phase = ( i << log2_word_bit_size ) % element_bit_size ;
+
+  for ( size_t r = 0 ; r < element_bit_size ; ++ r )
+    residue_count [ r ] +=
+      hamming_weight
+        ( w & residue_mask [ ( r + element_bit_size - phase )
+                             % element_bit_size ] ) ;
+  }
+
+uint result = 0 ;
+
+for ( size_t r = 0 ; r < element_bit_size ; ++ r )
+  if (     r == element_bit_size - 1
+       &&  numeric_traits < SmallInt > :: is_signed )
+    result -= uint ( residue_count [ r ] ) << r ;
+  else
+    result += uint ( residue_count [ r ] ) << r ;
+
+return sint ( result ) ;
+}
+
+
+// pre: n > 0
+//
+// returns: unsigned data of the minimum or the maximum of the range
+//
+// Lanes of lane_number elements are compared a word at a time; sign bits
+// of signed elements are flipped to compare them as unsigned.
+
+template < class SmallInt, class Word, class Allocator >
+Word basic_packed_small_int_vector < SmallInt, Word, Allocator > ::
+       lane_extremum ( size_t position, size_t n, bool maximum ) const
+
+{
+assert ( n > 0  &&  position + n <= size ( ) ) ;
+
+auto iter = bits_.begin ( ) + position * element_bit_size ;
+
+Word result = iter.word ( element_bit_size ) ^ sign_bit ;
+
+if ( n >= lane_number )
+  {
+  Word best = iter.word ( lane_bit_size ) ^ sign_bits ;
+
+  for ( ; n >= lane_number ; n -= lane_number )
+    {
+    Word w = iter.word ( lane_bit_size ) ^ sign_bits ;
+    Word m = lane_select_mask
+               ( packed_lane_greater_equal ( w, best, lane_high_bits ) ) ;
+
+    best = maximum ? ( w & m ) | ( best & ~ m ) : ( best & m ) | ( w & ~ m ) ;
+
+    iter += lane_bit_size ;
+    }
+
+  for ( size_t i = 0 ; i < lane_number ; ++ i )
+    {
+    Word v =   unsigned_shift_right ( best, i * element_bit_size )
+             & element_mask ;
+    if ( maximum ? v > result : v < result )
+      result = v ;
+    }
+  }
+
+for ( ; n > 0 ; -- n )
+  {
+  Word v = iter.word ( element_bit_size ) ^ sign_bit ;
+  if ( maximum ? v > result : v < result )
+    result = v ;
+  iter += element_bit_size ;
+  }
+
+return result ^ sign_bit ;
+}
+
+
+//
+
+template < class SmallInt, class Word, class Allocator >
+size_t basic_packed_small_int_vector < SmallInt, Word, Allocator > ::
+         count_less ( size_t position, size_t n, const SmallInt & x ) const
+
+{
+assert ( position + n <= size ( ) ) ;
+
+auto iter = bits_.begin ( ) + position * element_bit_size ;
+
+Word xv = Word ( x.unsigned_data ( ) ) ^ sign_bit ;
+Word xl = lane_low_bits * xv ;
+
+size_t result = 0 ;
+
+for ( ; n >= lane_number ; n -= lane_number )
+  {
+  Word w = iter.word ( lane_bit_size ) ^ sign_bits ;
+  result +=   lane_number
+            - hamming_weight
+                ( packed_lane_greater_equal ( w, xl, lane_high_bits ) ) ;
+  iter += lane_bit_size ;
+  }
+
+for ( ; n > 0 ; -- n )
+  {
+  if ( ( iter.word ( element_bit_size ) ^ sign_bit ) < xv )
+    ++ result ;
+  iter += element_bit_size ;
+  }
+
+return result ;
+}
+
+
+//
+
+template < class SmallInt, class Word, class Allocator >
+size_t basic_packed_small_int_vector < SmallInt, Word, Allocator > ::
+         count_equal ( size_t position, size_t n, const SmallInt & x ) const
+
+{
+assert ( position + n <= size ( ) ) ;
+
+auto iter = bits_.begin ( ) + position * element_bit_size ;
+
+Word xv = Word ( x.unsigned_data ( ) ) ;
+Word xl = lane_low_bits * xv ;
+
+size_t result = 0 ;
+
+for ( ; n >= lane_number ; n -= lane_number )
+  {
+  Word w = iter.word ( lane_bit_size ) ;
+  result += hamming_weight
+              (   packed_lane_greater_equal ( w, xl, lane_high_bits )
+                & packed_lane_greater_equal ( xl, w, lane_high_bits ) ) ;
+  iter += lane_bit_size ;
+  }
+
+for ( ; n > 0 ; -- n )
+  {
+  if ( iter.word ( element_bit_size ) == xv )
+    ++ result ;
+  iter += element_bit_size ;
+  }
+
+return result ;
+}
+
+
+//
+
+template < class SmallInt, class Word, class Allocator >
+inline void
+  swap ( basic_packed_small_int_vector < SmallInt, Word, Allocator > & a,
+         basic_packed_small_int_vector < SmallInt, Word, Allocator > & b )
+  noexcept
+
+{
+a.swap ( b ) ;
+}
+
+
+
+// *** PACKED_SMALL_INT_VECTOR ***
+
+
+template < sint Bits >
+using packed_small_int_vector =
+  basic_packed_small_int_vector < unsigned_small_int < uint, Bits > > ;
+
+template < sint Bits >
+using packed_signed_small_int_vector =
+  basic_packed_small_int_vector < signed_small_int < uint, Bits > > ;
+
+
+
+#endif
@@ -0,0 +1,285 @@
+// Copyright Ivan Stanojevic 2025.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+
+
+
+#ifndef __PRIMESIEVE_H
+
+#define __PRIMESIEVE_H
+
+
+
+#include "cstddef.h"
+#include "cstdint.h"
+#include "vector.h"
+#include "algorithm.h"
+#include "cmath.h"
+#include "future.h"
+
+#include "numbase.h"
+#include "bitvector.h"
+#include "setbits.h"
+#include "threadpool.h"
+
+
+
+// *** PRIME SIEVE ***
+
+
+// Segmented sieve of Eratosthenes over the odd numbers. Bit k of a
+// segment starting at k0 stands for the number 2 * ( k0 + k ) + 1, and is
+// 1 if the number is prime. A segment of prime_sieve_segment_bits bits
+// fits in the L1 cache.
+
+constexpr size_t prime_sieve_segment_bits = 32768 * 8 ;
+
+
+// segments sieved at a time for each thread of the pool
+
+constexpr size_t __prime_sieve_segments_per_thread = 2 ;
+
+
+//
+
+class __prime_sieve
+
+{
+private:
+
+  typedef bit_vector :: word_type word_type ;
+
+  static constexpr size_t word_bit_size = bit_vector :: word_bit_size ;
+
+  // odd primes p with p * p < limit
+
+  vector < uint32_t > base_primes ;
+
+public:
+
+  // pre: limit <= 2 ^ 64 - 2 ^ 33
+
+  explicit __prime_sieve ( uint64_t limit ) ;
+
+  // sieves the odd numbers from 2 * k0 + 1 into x
+
+  void sieve ( uint64_t k0, bit_vector & x ) const ;
+
+} ;
+
+
+//
+
+inline __prime_sieve :: __prime_sieve ( uint64_t limit )
+
+{
+uint64_t root = uint64_t ( sqrt ( double ( limit ) ) ) ;
+
+while ( root * root < limit )
+  ++ root ;
+
+// the odd numbers below root, sieved by the odd numbers up to their
+// square root
+
+bit_vector x ( root / 2, true ) ;
+
+for ( uint64_t k = 1 ; k < x.size ( ) ; ++ k )
+  {
+  uint64_t p = 2 * k + 1 ;
+
+  if ( p * p >= root )
+    break ;
+
+  if ( x [ k ] )
+    for ( uint64_t i = ( p * p ) / 2 ; i < x.size ( ) ; i += p )
+      x [ i ] = false ;
+  }
+
+for_each_set_bit ( x,
+                   [ this ] ( size_t k )
+                   { if ( k > 0 )
+                       base_primes.push_back ( uint32_t ( 2 * k + 1 ) ) ; } ) ;
+}
+
+
+//
+
+inline void __prime_sieve :: sieve ( uint64_t k0, bit_vector & x ) const
+
+{
+const uint64_t size = x.size ( ),
+               first = 2 * k0 + 1,
+               last = 2 * ( k0 + size ) ;
+
+x.assign ( size, true ) ;
+
+word_type * w = x.data ( ) ;
+
+for ( uint64_t p : base_primes )
+  {
+  if ( p * p >= last )
+    break ;
+
+  // the first odd multiple of p at least p * p and first
+
+  uint64_t m = max ( p * p, ( first + p - 1 ) / p * p ) ;
+
+  if ( m % 2 == 0 )
+    m += p ;
+
+  for ( uint64_t i = ( m - 1 ) / 2 - k0 ; i < size ; i += p )
+    w [ i / word_bit_size ] &= ~ ( word_type ( 1 ) << i % word_bit_size ) ;
+  }
+
+// 1 is not prime
+
+if ( k0 == 0  &&  size > 0 )
+  w [ 0 ] &= ~ word_type ( 1 ) ;
+}
+
+
+// Calls f ( k0, x ) for the consecutive segments x, starting at k0, of the
+// odd numbers in [ first, last ), in increasing order. The segments are
+// sieved on the threads of pool, or on the calling thread if pool is
+// nullptr.
+
+template < class F >
+void __for_each_prime_segment ( uint64_t first,
+                                uint64_t last,
+                                F f,
+                                thread_pool * pool )
+
+{
+const uint64_t k_first = first / 2,
+               k_last = last / 2 ;
+
+if ( k_first >= k_last )
+  return ;
+
+const __prime_sieve s ( last ) ;
+
+const size_t tasks =   pool == nullptr
+                     ? 1
+                     : pool -> size ( ) * __prime_sieve_segments_per_thread ;
+
+vector < bit_vector > segments ( tasks ) ;
+vector < uint64_t > starts ( tasks ) ;
+
+for ( uint64_t k = k_first ; k < k_last ; )
+  {
+  // the segments of the batch starting at k
+
+  uint64_t k0 = k ;
+  size_t n = 0 ;
+
+  for ( ; n < tasks  &&  k < k_last ; ++ n )
+    {
+    uint64_t size = min ( k_last - k, uint64_t ( prime_sieve_segment_bits ) ) ;
+
+    segments [ n ].resize ( size ) ;
+    starts [ n ] = k ;
+
+    k += size ;
+    }
+
+  run_tasks ( pool,
+              n,
+              [ & s, & segments, & starts ] ( size_t i )
+              { s.sieve ( starts [ i ], segments [ i ] ) ; } ) ;
+
+  for ( size_t i = 0 ; i < n ; ++ i )
+    {
+    f ( k0, static_cast < const bit_vector & > ( segments [ i ] ) ) ;
+    k0 += segments [ i ].size ( ) ;
+    }
+  }
+}
+
+
+
+// *** FOR_EACH_PRIME ***
+
+
+// Calls f ( p ) for the primes p in [ first, last ), in increasing order.
+// The numbers are sieved on the threads of pool, or on the calling thread
+// if pool is nullptr, and f is called on the calling thread.
+//
+// pre: last <= 2 ^ 64 - 2 ^ 33
+
+template < class F >
+F for_each_prime ( uint64_t first,
+                   uint64_t last,
+                   F f,
+                   thread_pool * pool = nullptr )
+
+{
+if ( first <= 2  &&  last > 2 )
+  f ( uint64_t ( 2 ) ) ;
+
+__for_each_prime_segment
+  ( first, last,
+    [ & f ] ( uint64_t k0, const bit_vector & x )
+    { for_each_set_bit ( x,
+                         [ & f, k0 ] ( size_t k )
+                         { f ( 2 * ( k0 + k ) + 1 ) ; } ) ; },
+    pool ) ;
+
+return f ;
+}
+
+
+
+// *** PRIME_COUNT ***
+
+
+// returns: number of primes in [ first, last ), sieved on the threads of
+//          pool, or on the calling thread if pool is nullptr
+//
+// pre: last <= 2 ^ 64 - 2 ^ 33
+
+inline uint64_t prime_count ( uint64_t first,
+                              uint64_t last,
+                              thread_pool * pool = nullptr )
+
+{
+uint64_t result = first <= 2  &&  last > 2 ? 1 : 0 ;
+
+__for_each_prime_segment ( first, last,
+                           [ & result ] ( uint64_t, const bit_vector & x )
+                           { result += hamming_weight ( x ) ; },
+                           pool ) ;
+
+return result ;
+}
+
+
+
+// *** PRIME_TABLE ***
+
+
+// returns: the primes below n, in increasing order, for example as moduli
+//          of a residue number system or as trial divisors
+
+inline vector < uint32_t > prime_table ( uint32_t n,
+                                         thread_pool * pool = nullptr )
+
+{
+vector < uint32_t > result ;
+
+// pi ( n ) < 1.25506 n / ln n
+
+if ( n > 2 )
+  result.reserve ( size_t ( 1.25506 * n / log ( double ( n ) ) ) + 1 ) ;
+
+for_each_prime ( 0, n,
+                 [ & result ] ( uint64_t p )
+                 { result.push_back ( uint32_t ( p ) ) ; },
+                 pool ) ;
+
+return result ;
+}
+
+
+
+#endif
@@ -0,0 +1,362 @@
+// Copyright Ivan Stanojevic 2025.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+
+
+
+#ifndef __RANKSELECT_H
+
+#define __RANKSELECT_H
+
+
+
+#include "memory.h"
+#include "cstddef.h"
+#include "cstdint.h"
+#include "vector.h"
+#include "cassert.h"
+
+#include "numbase.h"
+#include "bitcount.h"
+#include "bitvector.h"
+
+
+
+// *** WORD SELECT ***
+
+
+// pre: r < hamming_weight ( w )
+//
+// returns: position of the 1 bit of w preceded by exactly r 1 bits
+
+template < class Word >
+inline size_t word_select_1 ( Word w, size_t r )
+
+{
+constexpr size_t word_bit_size = numeric_traits < Word > :: bit_size ;
+
+size_t position = 0 ;
+
+for ( size_t width = word_bit_size / 2 ; width >= 8 ; width /= 2 )
+  {
+  Word low = w & ( ( Word ( 1 ) << width ) - 1 ) ;
+  size_t c = hamming_weight ( low ) ;
+
+  if ( r < c )
+    w = low ;
+  else
+    {
+    r -= c ;
+    w >>= width ;
+    position += width ;
+    }
+  }
+
+for ( ; r > 0 ; -- r )
+  w &= w - 1 ;
+
+return position + trailing_zero_count ( w ) ;
+}
+
+
+
+// *** BASIC_RANK_SELECT_INDEX ***
+
+
+// Succinct rank and select index over an immutable bit vector (D. Zhou,
+// D. G. Andersen, M. Kaminsky, "Space-Efficient, High-Performance Rank &
+// Select Structures on Uncompressed Bit Sequences").
+//
+// The bits are split into superblocks of 2048 bits and basic blocks of
+// 512 bits. For each superblock one 64 bit entry holds, interleaved, the
+// number of 1 bits before it within its group of 2 ^ 31 bits (31 bits)
+// and the numbers of 1 bits before its second, third and fourth basic
+// block (11 bits each), which is 3.125% of the bit vector. Groups of
+// 2 ^ 31 bits have absolute 64 bit counts. The superblock of every
+// 8192-th 1 bit is sampled for select.
+//
+// The index refers to the words of the bit vector, which must outlive it
+// and must not be modified.
+
+template < class Word, class Allocator = allocator < Word > >
+class basic_rank_select_index
+
+{
+public:
+
+  typedef basic_bit_vector < Word, Allocator > bit_vector_type ;
+
+  static constexpr size_t word_bit_size = numeric_traits < Word > :: bit_size ;
+
+  static constexpr size_t log2_block_bit_size = 9,
+                          log2_superblock_bit_size = 11,
+                          log2_group_bit_size = 31,
+                          log2_select_sample = 13 ;
+
+  static_assert ( word_bit_size <= size_t ( 1 ) << log2_block_bit_size,
+                  "Illegal word bit size." ) ;
+
+private:
+
+  static constexpr size_t block_words =
+                            ( size_t ( 1 ) << log2_block_bit_size )
+                            / word_bit_size ;
+
+  static constexpr size_t log2_group_superblocks =
+                            log2_group_bit_size - log2_superblock_bit_size ;
+
+  static constexpr uint64_t count_mask =
+                              ( uint64_t ( 1 ) << log2_group_bit_size ) - 1,
+                            block_count_mask = 0x7ff ;
+
+  const Word * data_ ;
+  size_t size_ ;
+  size_t word_size ;
+  size_t count_ ;
+
+  vector < uint64_t > groups ;
+  vector < uint64_t > superblocks ;
+  vector < uint64_t > samples ;
+
+  // returns: number of 1 bits before superblock s
+
+  size_t superblock_rank ( size_t s ) const
+    { return   groups [ s >> log2_group_superblocks ]
+             + ( superblocks [ s ] & count_mask ) ; }
+
+  // returns: number of 1 bits in the n words from word w, ignoring the
+  //          words after the end
+
+  size_t words_weight ( size_t w, size_t n ) const
+    { return   w < word_size
+             ? words_hamming_weight ( data_ + w, min ( n, word_size - w ) )
+             : 0 ; }
+
+public:
+
+  basic_rank_select_index ( ) :
+    data_ ( nullptr ),
+    size_ ( 0 ),
+    word_size ( 0 ),
+    count_ ( 0 ),
+    groups ( 1, 0 ),
+    superblocks ( 1, 0 ),
+    samples ( 1, 0 )
+    { }
+
+  explicit basic_rank_select_index ( const bit_vector_type & x ) ;
+
+  size_t size ( ) const noexcept
+    { return size_ ; }
+
+  // returns: number of 1 bits
+
+  size_t count ( ) const noexcept
+    { return count_ ; }
+
+  // pre: i <= size ( )
+  //
+  // returns: number of 1 bits before position i
+
+  size_t rank_1 ( size_t i ) const ;
+
+  // pre: i <= size ( )
+  //
+  // returns: number of 0 bits before position i
+
+  size_t rank_0 ( size_t i ) const
+    { return i - rank_1 ( i ) ; }
+
+  // pre: k < count ( )
+  //
+  // returns: position of the 1 bit preceded by exactly k 1 bits
+
+  size_t select_1 ( size_t k ) const ;
+
+  // returns: memory used by the rank counters, in bytes
+
+  size_t rank_memory_usage ( ) const noexcept
+    { return   groups.capacity ( ) * sizeof ( uint64_t )
+             + superblocks.capacity ( ) * sizeof ( uint64_t ) ; }
+
+  // returns: memory used by the select samples, in bytes
+
+  size_t select_memory_usage ( ) const noexcept
+    { return samples.capacity ( ) * sizeof ( uint64_t ) ; }
+
+  // returns: memory used by the index, in bytes
+
+  size_t memory_usage ( ) const noexcept
+    { return   sizeof ( * this )
+             + rank_memory_usage ( )
+             + select_memory_usage ( ) ; }
+
+  // returns: memory used by the index, relative to the memory used by
+  //          the bits
+
+  double memory_overhead ( ) const noexcept
+    { return   double ( rank_memory_usage ( ) + select_memory_usage ( ) )
+             / double ( max ( word_size * sizeof ( Word ), size_t ( 1 ) ) ) ; }
+
+} ;
+
+
+//
+
+template < class Word, class Allocator >
+basic_rank_select_index < Word, Allocator > ::
+  basic_rank_select_index ( const bit_vector_type & x ) :
+  data_ ( x.data ( ) ),
+  size_ ( x.size ( ) ),
+  word_size ( ( x.size ( ) + word_bit_size - 1 ) / word_bit_size ),
+  count_ ( 0 ),
+  groups ( ),
+  superblocks ( ),
+  samples ( )
+
+{
+// one more superblock (and group) for rank_1 ( size ( ) )
+
+size_t superblock_number = ( size_ >> log2_superblock_bit_size ) + 1 ;
+
+superblocks.reserve ( superblock_number ) ;
+groups.reserve ( ( superblock_number >> log2_group_superblocks ) + 1 ) ;
+
+size_t next_sample = 0 ;
+
+for ( size_t s = 0 ; s < superblock_number ; ++ s )
+  {
+  if ( ( s & ( ( size_t ( 1 ) << log2_group_superblocks ) - 1 ) ) == 0 )
+    groups.push_back ( count_ ) ;
+
+  // c0, c1, c2 and c3: numbers of 1 bits in the first one, two, three
+  // and four basic blocks
+
+  size_t w = s * 4 * block_words,
+         c0 = words_weight ( w, block_words ),
+         c1 = c0 + words_weight ( w + block_words, block_words ),
+         c2 = c1 + words_weight ( w + 2 * block_words, block_words ),
+         c3 = c2 + words_weight ( w + 3 * block_words, block_words ) ;
+
+  superblocks.push_back
+    (     uint64_t ( count_ - groups.back ( ) )
+      |   uint64_t ( c0 ) << log2_group_bit_size
+      |   uint64_t ( c1 ) << ( log2_group_bit_size + 11 )
+      |   uint64_t ( c2 ) << ( log2_group_bit_size + 22 ) ) ;
+
+  for ( ; next_sample < count_ + c3 ;
+          next_sample += size_t ( 1 ) << log2_select_sample )
+    samples.push_back ( s ) ;
+
+  count_ += c3 ;
+  }
+
+// sentinel for the binary search in select_1
+
+samples.push_back ( superblock_number - 1 ) ;
+}
+
+
+//
+
+template < class Word, class Allocator >
+size_t basic_rank_select_index < Word, Allocator > ::
+  rank_1 ( size_t i ) const
+
+{
+assert ( i <= size_ ) ;
+
+size_t s = i >> log2_superblock_bit_size ;
+
+uint64_t e = superblocks [ s ] ;
+
+// the counts of the basic blocks of the superblock, with 0 for the
+// first one
+
+uint64_t block_counts = ( e >> log2_group_bit_size ) << 11 ;
+
+size_t result =   groups [ s >> log2_group_superblocks ]
+                + ( e & count_mask )
+                + (   ( block_counts
+                        >> ( 11 * ( ( i >> log2_block_bit_size ) & 3 ) ) )
+                    & block_count_mask ) ;
+
+size_t w = ( i >> log2_block_bit_size ) * block_words,
+       word_end = i / word_bit_size ;
+
+for ( ; w < word_end ; ++ w )
+  result += hamming_weight ( data_ [ w ] ) ;
+
+size_t bit = i % word_bit_size ;
+
+if ( bit != 0 )
+  result += hamming_weight
+              ( Word ( data_ [ w ] & ( ( Word ( 1 ) << bit ) - 1 ) ) ) ;
+
+return result ;
+}
+
+
+//
+
+template < class Word, class Allocator >
+size_t basic_rank_select_index < Word, Allocator > ::
+  select_1 ( size_t k ) const
+
+{
+assert ( k < count_ ) ;
+
+// the last superblock in [ low, high ] with at most k 1 bits before it
+
+size_t j = k >> log2_select_sample,
+       low = samples [ j ],
+       high = samples [ j + 1 ] ;
+
+while ( low < high )
+  {
+  size_t middle = high - ( high - low ) / 2 ;
+
+  if ( superblock_rank ( middle ) <= k )
+    low = middle ;
+  else
+    high = middle - 1 ;
+  }
+
+size_t r = k - superblock_rank ( low ) ;
+
+uint64_t e = superblocks [ low ] >> log2_group_bit_size ;
+
+size_t c1 = e & block_count_mask,
+       c2 = ( e >> 11 ) & block_count_mask,
+       c3 = ( e >> 22 ) & block_count_mask,
+       b = size_t ( r >= c1 ) + size_t ( r >= c2 ) + size_t ( r >= c3 ) ;
+
+if ( b > 0 )
+  r -= b == 1 ? c1 : b == 2 ? c2 : c3 ;
+
+size_t w = ( low * 4 + b ) * block_words ;
+
+for ( ; ; ++ w )
+  {
+  size_t c = hamming_weight ( data_ [ w ] ) ;
+
+  if ( r < c )
+    break ;
+
+  r -= c ;
+  }
+
+return w * word_bit_size + word_select_1 ( data_ [ w ], r ) ;
+}
+
+
+
+// *** RANK_SELECT_INDEX ***
+
+
+typedef basic_rank_select_index < uint > rank_select_index ;
+
+
+
+#endif
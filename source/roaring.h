@@ -0,0 +1,1074 @@
+// Copyright Ivan Stanojevic 2025.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+
+
+
+#ifndef __ROARING_H
+
+#define __ROARING_H
+
+
+
+#include "memory.h"
+#include "cstddef.h"
+#include "cstdint.h"
+#include "vector.h"
+#include "iterator.h"
+#include "algorithm.h"
+#include "utility.h"
+#include "cassert.h"
+
+#include "numbase.h"
+#include "bitcount.h"
+#include "bitvector.h"
+
+
+
+// *** ROARING_CONTAINER ***
+
+
+// A set of 16 bit values, stored as a sorted array of at most
+// array_limit values, as a bitset of 2 ^ 16 bits, or as a sorted array
+// of runs, each one given by its first value and its length - 1
+// (S. Chambi, D. Lemire, O. Kaser, R. Godin, "Better bitmap performance
+// with Roaring bitmaps"). Arrays and runs are kept in values, bitsets in
+// words.
+
+class __roaring_container
+
+{
+public:
+
+  enum kind_t { array_kind, bitset_kind, run_kind } ;
+
+  enum operation_t { and_operation,
+                     or_operation,
+                     xor_operation,
+                     and_not_operation } ;
+
+  static constexpr size_t bitset_words = 1024,
+                          array_limit = 4096 ;
+
+  kind_t kind ;
+  size_t cardinality ;
+
+  vector < uint16_t > values ;
+  vector < uint64_t > words ;
+
+  __roaring_container ( ) :
+    kind ( array_kind ),
+    cardinality ( 0 ),
+    values ( ),
+    words ( )
+    { }
+
+  bool contains ( uint16_t x ) const ;
+
+  void add ( uint16_t x ) ;
+
+  void remove ( uint16_t x ) ;
+
+  void convert_to_array ( ) ;
+
+  void convert_to_bitset ( ) ;
+
+  // post: kind is array_kind if cardinality <= array_limit and
+  //       bitset_kind otherwise
+
+  void normalize ( ) ;
+
+  size_t run_number ( ) const ;
+
+  // post: stored as runs iff that takes less memory than an array or
+  //       a bitset
+
+  void run_optimize ( ) ;
+
+  size_t memory_usage ( ) const
+    { return   values.capacity ( ) * sizeof ( uint16_t )
+             + words.capacity ( ) * sizeof ( uint64_t ) ; }
+
+  // calls f ( x ) for all values x, in increasing order
+
+  template < class F >
+  void for_each ( F f ) const ;
+
+  static __roaring_container combine ( const __roaring_container & a,
+                                       const __roaring_container & b,
+                                       operation_t operation ) ;
+
+private:
+
+  void set_range ( size_t first, size_t last ) ;
+
+  void recount ( )
+    { cardinality = words_hamming_weight ( words.data ( ), bitset_words ) ; }
+
+} ;
+
+
+//
+
+inline bool __roaring_container :: contains ( uint16_t x ) const
+
+{
+switch ( kind )
+  {
+  case array_kind:
+
+    return binary_search ( values.begin ( ), values.end ( ), x ) ;
+
+  case bitset_kind:
+
+    return ( words [ x >> 6 ] >> ( x & 63 ) & 1 ) != 0 ;
+
+  case run_kind:
+
+    {
+    // the last run starting at or before x
+
+    size_t low = 0, high = values.size ( ) / 2 ;
+
+    while ( low < high )
+      {
+      size_t middle = low + ( high - low ) / 2 ;
+
+      if ( values [ 2 * middle ] <= x )
+        low = middle + 1 ;
+      else
+        high = middle ;
+      }
+
+    return     low > 0
+           &&    size_t ( x - values [ 2 * low - 2 ] )
+              <= values [ 2 * low - 1 ] ;
+    }
+  }
+
+return false ;
+}
+
+
+//
+
+inline void __roaring_container :: add ( uint16_t x )
+
+{
+if ( kind == run_kind )
+  normalize ( ) ;
+
+if ( kind == array_kind )
+  {
+  auto iter = lower_bound ( values.begin ( ), values.end ( ), x ) ;
+
+  if ( iter == values.end ( )  ||  * iter != x )
+    {
+    values.insert ( iter, x ) ;
+    ++ cardinality ;
+
+    if ( cardinality > array_limit )
+      convert_to_bitset ( ) ;
+    }
+  }
+else
+  {
+  uint64_t & w = words [ x >> 6 ] ;
+  uint64_t m = uint64_t ( 1 ) << ( x & 63 ) ;
+
+  if ( ( w & m ) == 0 )
+    {
+    w |= m ;
+    ++ cardinality ;
+    }
+  }
+}
+
+
+//
+
+inline void __roaring_container :: remove ( uint16_t x )
+
+{
+if ( kind == run_kind )
+  normalize ( ) ;
+
+if ( kind == array_kind )
+  {
+  auto iter = lower_bound ( values.begin ( ), values.end ( ), x ) ;
+
+  if ( iter != values.end ( )  &&  * iter == x )
+    {
+    values.erase ( iter ) ;
+    -- cardinality ;
+    }
+  }
+else
+  {
+  uint64_t & w = words [ x >> 6 ] ;
+  uint64_t m = uint64_t ( 1 ) << ( x & 63 ) ;
+
+  if ( ( w & m ) != 0 )
+    {
+    w &= ~ m ;
+    -- cardinality ;
+
+    if ( cardinality <= array_limit )
+      convert_to_array ( ) ;
+    }
+  }
+}
+
+
+//
+
+inline void __roaring_container :: convert_to_array ( )
+
+{
+if ( kind == array_kind )
+  return ;
+
+vector < uint16_t > new_values ;
+new_values.reserve ( cardinality ) ;
+
+for_each ( [ & ] ( uint16_t x ) { new_values.push_back ( x ) ; } ) ;
+
+values.swap ( new_values ) ;
+words = vector < uint64_t > ( ) ;
+kind = array_kind ;
+}
+
+
+//
+
+inline void __roaring_container :: convert_to_bitset ( )
+
+{
+if ( kind == bitset_kind )
+  return ;
+
+words.assign ( bitset_words, 0 ) ;
+
+if ( kind == array_kind )
+  for ( uint16_t x : values )
+    words [ x >> 6 ] |= uint64_t ( 1 ) << ( x & 63 ) ;
+else
+  for ( size_t i = 0 ; i < values.size ( ) ; i += 2 )
+    set_range ( values [ i ], size_t ( values [ i ] ) + values [ i + 1 ] ) ;
+
+values = vector < uint16_t > ( ) ;
+kind = bitset_kind ;
+}
+
+
+//
+
+inline void __roaring_container :: normalize ( )
+
+{
+if ( cardinality <= array_limit )
+  convert_to_array ( ) ;
+else
+  convert_to_bitset ( ) ;
+}
+
+
+//
+
+inline size_t __roaring_container :: run_number ( ) const
+
+{
+size_t result = 0 ;
+
+switch ( kind )
+  {
+  case array_kind:
+
+    for ( size_t i = 0 ; i < values.size ( ) ; ++ i )
+      if ( i == 0  ||  values [ i ] != values [ i - 1 ] + 1 )
+        ++ result ;
+
+    break ;
+
+  case bitset_kind:
+
+    {
+    // a run starts at each 1 bit preceded by a 0 bit
+
+    uint64_t previous = 0 ;
+
+    for ( uint64_t w : words )
+      {
+      result += hamming_weight ( w & ~ ( w << 1 | previous >> 63 ) ) ;
+      previous = w ;
+      }
+    }
+
+    break ;
+
+  case run_kind:
+
+    result = values.size ( ) / 2 ;
+    break ;
+  }
+
+return result ;
+}
+
+
+//
+
+inline void __roaring_container :: run_optimize ( )
+
+{
+size_t run_bytes = run_number ( ) * 2 * sizeof ( uint16_t ),
+       bytes =   cardinality <= array_limit
+               ? cardinality * sizeof ( uint16_t )
+               : bitset_words * sizeof ( uint64_t ) ;
+
+if ( run_bytes >= bytes )
+  {
+  normalize ( ) ;
+  return ;
+  }
+
+if ( kind == run_kind )
+  return ;
+
+vector < uint16_t > runs ;
+runs.reserve ( run_bytes / sizeof ( uint16_t ) ) ;
+
+for_each ( [ & ] ( uint16_t x )
+             { if ( ! runs.empty ( )  &&  runs.end ( ) [ -2 ]
+                                          + runs.back ( ) + 1 == x )
+                 ++ runs.back ( ) ;
+               else
+                 {
+                 runs.push_back ( x ) ;
+                 runs.push_back ( 0 ) ;
+                 } } ) ;
+
+values.swap ( runs ) ;
+words = vector < uint64_t > ( ) ;
+kind = run_kind ;
+}
+
+
+//
+
+template < class F >
+void __roaring_container :: for_each ( F f ) const
+
+{
+switch ( kind )
+  {
+  case array_kind:
+
+    for ( uint16_t x : values )
+      f ( x ) ;
+
+    break ;
+
+  case bitset_kind:
+
+    for ( size_t i = 0 ; i < bitset_words ; ++ i )
+      for ( uint64_t w = words [ i ] ; w != 0 ; w &= w - 1 )
+        f ( uint16_t ( i * 64 + trailing_zero_count ( w ) ) ) ;
+
+    break ;
+
+  case run_kind:
+
+    for ( size_t i = 0 ; i < values.size ( ) ; i += 2 )
+      for ( size_t x = values [ i ] ;
+                   x <= size_t ( values [ i ] ) + values [ i + 1 ] ;
+                   ++ x )
+        f ( uint16_t ( x ) ) ;
+
+    break ;
+  }
+}
+
+
+// sets the bits first, ..., last of the bitset
+
+inline void __roaring_container :: set_range ( size_t first, size_t last )
+
+{
+size_t i = first >> 6, j = last >> 6 ;
+
+uint64_t first_mask = ~ uint64_t ( 0 ) << ( first & 63 ),
+         last_mask = ~ uint64_t ( 0 ) >> ( 63 - ( last & 63 ) ) ;
+
+if ( i == j )
+  words [ i ] |= first_mask & last_mask ;
+else
+  {
+  words [ i ] |= first_mask ;
+
+  for ( ++ i ; i < j ; ++ i )
+    words [ i ] = ~ uint64_t ( 0 ) ;
+
+  words [ j ] |= last_mask ;
+  }
+}
+
+
+//
+
+inline __roaring_container
+  __roaring_container :: combine ( const __roaring_container & a,
+                                   const __roaring_container & b,
+                                   operation_t operation )
+
+{
+if ( a.kind == run_kind  ||  b.kind == run_kind )
+  {
+  __roaring_container c ( a ), d ( b ) ;
+
+  c.normalize ( ) ;
+  d.normalize ( ) ;
+
+  return combine ( c, d, operation ) ;
+  }
+
+__roaring_container result ;
+
+if ( a.kind == array_kind  &&  b.kind == array_kind )
+  {
+  auto out = back_inserter ( result.values ) ;
+
+  switch ( operation )
+    {
+    case and_operation:
+
+      set_intersection ( a.values.begin ( ), a.values.end ( ),
+                         b.values.begin ( ), b.values.end ( ), out ) ;
+      break ;
+
+    case or_operation:
+
+      set_union ( a.values.begin ( ), a.values.end ( ),
+                  b.values.begin ( ), b.values.end ( ), out ) ;
+      break ;
+
+    case xor_operation:
+
+      set_symmetric_difference ( a.values.begin ( ), a.values.end ( ),
+                                 b.values.begin ( ), b.values.end ( ), out ) ;
+      break ;
+
+    case and_not_operation:
+
+      set_difference ( a.values.begin ( ), a.values.end ( ),
+                       b.values.begin ( ), b.values.end ( ), out ) ;
+      break ;
+    }
+
+  result.cardinality = result.values.size ( ) ;
+  }
+else if ( a.kind == bitset_kind  &&  b.kind == bitset_kind )
+  {
+  result.kind = bitset_kind ;
+  result.words.resize ( bitset_words ) ;
+
+  for ( size_t i = 0 ; i < bitset_words ; ++ i )
+    switch ( operation )
+      {
+      case and_operation:
+        result.words [ i ] = a.words [ i ] & b.words [ i ] ;
+        break ;
+
+      case or_operation:
+        result.words [ i ] = a.words [ i ] | b.words [ i ] ;
+        break ;
+
+      case xor_operation:
+        result.words [ i ] = a.words [ i ] ^ b.words [ i ] ;
+        break ;
+
+      case and_not_operation:
+        result.words [ i ] = a.words [ i ] & ~ b.words [ i ] ;
+        break ;
+      }
+
+  result.recount ( ) ;
+  }
+else if (    operation == and_operation
+         ||  ( operation == and_not_operation  &&  a.kind == array_kind ) )
+  {
+  // the result is a subset of the array
+
+  const __roaring_container & array = a.kind == array_kind ? a : b ;
+  const __roaring_container & bitset = a.kind == array_kind ? b : a ;
+
+  bool keep = operation == and_operation ;
+
+  for ( uint16_t x : array.values )
+    if ( bitset.contains ( x ) == keep )
+      result.values.push_back ( x ) ;
+
+  result.cardinality = result.values.size ( ) ;
+  }
+else
+  {
+  // a copy of the bitset with the bits of the array set, flipped or
+  // cleared
+
+  const __roaring_container & array = a.kind == array_kind ? a : b ;
+
+  result = a.kind == bitset_kind ? a : b ;
+
+  for ( uint16_t x : array.values )
+    {
+    uint64_t & w = result.words [ x >> 6 ] ;
+    uint64_t m = uint64_t ( 1 ) << ( x & 63 ) ;
+
+    switch ( operation )
+      {
+      case or_operation:
+        w |= m ;
+        break ;
+
+      case xor_operation:
+        w ^= m ;
+        break ;
+
+      default:
+        w &= ~ m ;
+        break ;
+      }
+    }
+
+  result.recount ( ) ;
+  }
+
+result.normalize ( ) ;
+
+return result ;
+}
+
+
+
+// *** ROARING_BITMAP ***
+
+
+// Compressed set of size_t values: the values with the same high bits
+// (all but the lowest 16) share a container, and empty containers are
+// not stored. Operations produce arrays and bitsets; run_optimize
+// converts the containers for which it saves memory to runs.
+//
+// Bitset containers are counted with the word array kernels of
+// bitcount.h.
+
+class roaring_bitmap
+
+{
+private:
+
+  typedef __roaring_container container_type ;
+
+  vector < size_t > keys ;
+  vector < container_type > containers ;
+
+  // returns: index of the container with key k, or of the position where
+  //          it would be inserted
+
+  size_t find ( size_t k ) const
+    { return lower_bound ( keys.begin ( ), keys.end ( ), k )
+             - keys.begin ( ) ; }
+
+  static roaring_bitmap combine ( const roaring_bitmap & a,
+                                  const roaring_bitmap & b,
+                                  container_type :: operation_t operation ) ;
+
+public:
+
+  class const_iterator
+
+  {
+  public:
+
+    typedef forward_iterator_tag iterator_category ;
+    typedef size_t value_type ;
+    typedef ptrdiff_t difference_type ;
+    typedef const size_t * pointer ;
+    typedef size_t reference ;
+
+  private:
+
+    friend class roaring_bitmap ;
+
+    const roaring_bitmap * bitmap ;
+    size_t container ;
+
+    // array element, bitset word or run index
+
+    size_t index ;
+
+    // the remaining 1 bits of the bitset word
+
+    uint64_t word ;
+
+    size_t value ;
+
+    const_iterator ( const roaring_bitmap * i_bitmap, size_t i_container ) :
+      bitmap ( i_bitmap ),
+      container ( i_container ),
+      index ( 0 ),
+      word ( 0 ),
+      value ( 0 )
+      { load ( ) ; }
+
+    void load ( ) ;
+
+    void advance ( ) ;
+
+  public:
+
+    const_iterator ( ) :
+      bitmap ( nullptr ),
+      container ( 0 ),
+      index ( 0 ),
+      word ( 0 ),
+      value ( 0 )
+      { }
+
+    size_t operator * ( ) const
+      { return value ; }
+
+    const_iterator & operator ++ ( )
+      { advance ( ) ;
+        return * this ; }
+
+    const_iterator operator ++ ( int )
+      { const_iterator result ( * this ) ;
+        advance ( ) ;
+        return result ; }
+
+    friend bool operator == ( const const_iterator & a,
+                              const const_iterator & b )
+      { return a.container == b.container  &&  a.value == b.value ; }
+
+    friend bool operator != ( const const_iterator & a,
+                              const const_iterator & b )
+      { return ! ( a == b ) ; }
+
+  } ;
+
+  typedef const_iterator iterator ;
+
+  roaring_bitmap ( ) :
+    keys ( ),
+    containers ( )
+    { }
+
+  template < class Word, class Allocator >
+  explicit roaring_bitmap ( const basic_bit_vector < Word, Allocator > & x ) ;
+
+  // pre: all values are less than n
+
+  template < class Word, class Allocator = allocator < Word > >
+  basic_bit_vector < Word, Allocator > to_bit_vector ( size_t n ) const ;
+
+  const_iterator begin ( ) const
+    { return const_iterator ( this, 0 ) ; }
+
+  const_iterator end ( ) const
+    { return const_iterator ( this, containers.size ( ) ) ; }
+
+  const_iterator cbegin ( ) const
+    { return begin ( ) ; }
+
+  const_iterator cend ( ) const
+    { return end ( ) ; }
+
+  bool empty ( ) const
+    { return containers.empty ( ) ; }
+
+  size_t cardinality ( ) const
+    { size_t result = 0 ;
+      for ( const container_type & c : containers )
+        result += c.cardinality ;
+      return result ; }
+
+  bool contains ( size_t x ) const
+    { size_t i = find ( x >> 16 ) ;
+      return     i < keys.size ( )
+             &&  keys [ i ] == x >> 16
+             &&  containers [ i ].contains ( uint16_t ( x ) ) ; }
+
+  void add ( size_t x )
+    { size_t i = find ( x >> 16 ) ;
+      if ( i == keys.size ( )  ||  keys [ i ] != x >> 16 )
+        {
+        keys.insert ( keys.begin ( ) + i, x >> 16 ) ;
+        containers.insert ( containers.begin ( ) + i, container_type ( ) ) ;
+        }
+      containers [ i ].add ( uint16_t ( x ) ) ; }
+
+  void remove ( size_t x )
+    { size_t i = find ( x >> 16 ) ;
+      if ( i < keys.size ( )  &&  keys [ i ] == x >> 16 )
+        {
+        containers [ i ].remove ( uint16_t ( x ) ) ;
+        if ( containers [ i ].cardinality == 0 )
+          {
+          keys.erase ( keys.begin ( ) + i ) ;
+          containers.erase ( containers.begin ( ) + i ) ;
+          }
+        } }
+
+  void clear ( )
+    { keys.clear ( ) ;
+      containers.clear ( ) ; }
+
+  void run_optimize ( )
+    { for ( container_type & c : containers )
+        c.run_optimize ( ) ; }
+
+  // returns: memory used by the bitmap, in bytes
+
+  size_t memory_usage ( ) const
+    { size_t result =   sizeof ( * this )
+                      + keys.capacity ( ) * sizeof ( size_t )
+                      + containers.capacity ( ) * sizeof ( container_type ) ;
+      for ( const container_type & c : containers )
+        result += c.memory_usage ( ) ;
+      return result ; }
+
+  void swap ( roaring_bitmap & b ) noexcept
+    { keys.swap ( b.keys ) ;
+      containers.swap ( b.containers ) ; }
+
+  roaring_bitmap & operator &= ( const roaring_bitmap & b )
+    { return * this = combine ( * this, b,
+                                container_type :: and_operation ) ; }
+
+  roaring_bitmap & operator |= ( const roaring_bitmap & b )
+    { return * this = combine ( * this, b,
+                                container_type :: or_operation ) ; }
+
+  roaring_bitmap & operator ^= ( const roaring_bitmap & b )
+    { return * this = combine ( * this, b,
+                                container_type :: xor_operation ) ; }
+
+  // removes the values of b
+
+  roaring_bitmap & and_not ( const roaring_bitmap & b )
+    { return * this = combine ( * this, b,
+                                container_type :: and_not_operation ) ; }
+
+  friend roaring_bitmap operator & ( const roaring_bitmap & a,
+                                     const roaring_bitmap & b )
+    { return combine ( a, b, container_type :: and_operation ) ; }
+
+  friend roaring_bitmap operator | ( const roaring_bitmap & a,
+                                     const roaring_bitmap & b )
+    { return combine ( a, b, container_type :: or_operation ) ; }
+
+  friend roaring_bitmap operator ^ ( const roaring_bitmap & a,
+                                     const roaring_bitmap & b )
+    { return combine ( a, b, container_type :: xor_operation ) ; }
+
+  friend roaring_bitmap and_not ( const roaring_bitmap & a,
+                                  const roaring_bitmap & b )
+    { return combine ( a, b, container_type :: and_not_operation ) ; }
+
+  friend bool operator == ( const roaring_bitmap & a,
+                            const roaring_bitmap & b )
+    { return     a.keys == b.keys
+             &&  a.cardinality ( ) == b.cardinality ( )
+             &&  equal ( a.begin ( ), a.end ( ), b.begin ( ) ) ; }
+
+  friend bool operator != ( const roaring_bitmap & a,
+                            const roaring_bitmap & b )
+    { return ! ( a == b ) ; }
+
+} ;
+
+
+//
+
+inline void roaring_bitmap :: const_iterator :: load ( )
+
+{
+if ( container == bitmap -> containers.size ( ) )
+  {
+  value = 0 ;
+  return ;
+  }
+
+const container_type & c = bitmap -> containers [ container ] ;
+size_t base = bitmap -> keys [ container ] << 16 ;
+
+index = 0 ;
+
+switch ( c.kind )
+  {
+  case container_type :: array_kind:
+
+    value = base + c.values [ 0 ] ;
+    break ;
+
+  case container_type :: bitset_kind:
+
+    while ( c.words [ index ] == 0 )
+      ++ index ;
+
+    word = c.words [ index ] ;
+    value = base + index * 64 + trailing_zero_count ( word ) ;
+    break ;
+
+  case container_type :: run_kind:
+
+    value = base + c.values [ 0 ] ;
+    break ;
+  }
+}
+
+
+//
+
+inline void roaring_bitmap :: const_iterator :: advance ( )
+
+{
+const container_type & c = bitmap -> containers [ container ] ;
+size_t base = bitmap -> keys [ container ] << 16 ;
+
+switch ( c.kind )
+  {
+  case container_type :: array_kind:
+
+    if ( ++ index < c.values.size ( ) )
+      {
+      value = base + c.values [ index ] ;
+      return ;
+      }
+
+    break ;
+
+  case container_type :: bitset_kind:
+
+    word &= word - 1 ;
+
+    while ( word == 0  &&  ++ index < container_type :: bitset_words )
+      word = c.words [ index ] ;
+
+    if ( word != 0 )
+      {
+      value = base + index * 64 + trailing_zero_count ( word ) ;
+      return ;
+      }
+
+    break ;
+
+  case container_type :: run_kind:
+
+    if ( value - base < size_t ( c.values [ 2 * index ] )
+                        + c.values [ 2 * index + 1 ] )
+      {
+      ++ value ;
+      return ;
+      }
+
+    if ( ++ index < c.values.size ( ) / 2 )
+      {
+      value = base + c.values [ 2 * index ] ;
+      return ;
+      }
+
+    break ;
+  }
+
+++ container ;
+load ( ) ;
+}
+
+
+//
+
+template < class Word, class Allocator >
+roaring_bitmap :: roaring_bitmap
+                    ( const basic_bit_vector < Word, Allocator > & x ) :
+  keys ( ),
+  containers ( )
+
+{
+constexpr size_t word_bit_size = numeric_traits < Word > :: bit_size,
+                 container_words = ( size_t ( 1 ) << 16 ) / word_bit_size ;
+
+static_assert ( word_bit_size <= 64, "Illegal word bit size." ) ;
+
+const Word * p = x.data ( ) ;
+size_t word_size = ( x.size ( ) + word_bit_size - 1 ) / word_bit_size ;
+
+for ( size_t k = 0 ; k * container_words < word_size ; ++ k )
+  {
+  const Word * q = p + k * container_words ;
+  size_t n = min ( container_words, word_size - k * container_words ),
+         weight = words_hamming_weight ( q, n ) ;
+
+  if ( weight == 0 )
+    continue ;
+
+  container_type c ;
+  c.cardinality = weight ;
+
+  if ( weight > container_type :: array_limit )
+    {
+    c.kind = container_type :: bitset_kind ;
+    c.words.assign ( container_type :: bitset_words, 0 ) ;
+
+    for ( size_t i = 0 ; i < n ; ++ i )
+      c.words [ i * word_bit_size / 64 ]
+        |= uint64_t ( q [ i ] ) << ( i * word_bit_size % 64 ) ;
+    }
+  else
+    {
+    c.values.reserve ( weight ) ;
+
+    for ( size_t i = 0 ; i < n ; ++ i )
+      for ( Word w = q [ i ] ; w != Word ( 0 ) ; w &= w - 1 )
+        c.values.push_back
+          ( uint16_t ( i * word_bit_size + trailing_zero_count ( w ) ) ) ;
+    }
+
+  keys.push_back ( k ) ;
+  containers.push_back ( move ( c ) ) ;
+  }
+}
+
+
+//
+
+template < class Word, class Allocator >
+basic_bit_vector < Word, Allocator >
+  roaring_bitmap :: to_bit_vector ( size_t n ) const
+
+{
+constexpr size_t word_bit_size = numeric_traits < Word > :: bit_size ;
+
+static_assert ( word_bit_size <= 64, "Illegal word bit size." ) ;
+
+basic_bit_vector < Word, Allocator > result ( n ) ;
+Word * p = result.data ( ) ;
+
+for ( size_t i = 0 ; i < keys.size ( ) ; ++ i )
+  {
+  const container_type & c = containers [ i ] ;
+  size_t base = keys [ i ] << 16 ;
+
+  if ( c.kind == container_type :: bitset_kind )
+    for ( size_t j = 0 ; j < container_type :: bitset_words ; ++ j )
+      {
+      uint64_t w = c.words [ j ] ;
+
+      for ( size_t t = 0 ; w != 0 ; ++ t )
+        {
+        Word v = Word ( w ) ;
+
+        if ( v != Word ( 0 ) )
+          {
+          assert ( base + j * 64 + t * word_bit_size < n ) ;
+          p [ ( base + j * 64 ) / word_bit_size + t ] |= v ;
+          }
+
+        w = word_bit_size < 64 ? w >> ( word_bit_size % 64 ) : 0 ;
+        }
+      }
+  else
+    c.for_each ( [ & ] ( uint16_t x )
+                   { size_t y = base + x ;
+                     assert ( y < n ) ;
+                     p [ y / word_bit_size ]
+                       |= Word ( 1 ) << ( y % word_bit_size ) ; } ) ;
+  }
+
+return result ;
+}
+
+
+//
+
+inline roaring_bitmap
+  roaring_bitmap :: combine ( const roaring_bitmap & a,
+                              const roaring_bitmap & b,
+                              container_type :: operation_t operation )
+
+{
+bool keep_a = operation != container_type :: and_operation,
+     keep_b =     operation == container_type :: or_operation
+              ||  operation == container_type :: xor_operation ;
+
+roaring_bitmap result ;
+
+size_t i = 0, j = 0 ;
+
+while ( i < a.keys.size ( )  &&  j < b.keys.size ( ) )
+  if ( a.keys [ i ] < b.keys [ j ] )
+    {
+    if ( keep_a )
+      {
+      result.keys.push_back ( a.keys [ i ] ) ;
+      result.containers.push_back ( a.containers [ i ] ) ;
+      }
+
+    ++ i ;
+    }
+  else if ( b.keys [ j ] < a.keys [ i ] )
+    {
+    if ( keep_b )
+      {
+      result.keys.push_back ( b.keys [ j ] ) ;
+      result.containers.push_back ( b.containers [ j ] ) ;
+      }
+
+    ++ j ;
+    }
+  else
+    {
+    container_type c ( container_type :: combine ( a.containers [ i ],
+                                                   b.containers [ j ],
+                                                   operation ) ) ;
+
+    if ( c.cardinality != 0 )
+      {
+      result.keys.push_back ( a.keys [ i ] ) ;
+      result.containers.push_back ( move ( c ) ) ;
+      }
+
+    ++ i ;
+    ++ j ;
+    }
+
+if ( keep_a )
+  for ( ; i < a.keys.size ( ) ; ++ i )
+    {
+    result.keys.push_back ( a.keys [ i ] ) ;
+    result.containers.push_back ( a.containers [ i ] ) ;
+    }
+
+if ( keep_b )
+  for ( ; j < b.keys.size ( ) ; ++ j )
+    {
+    result.keys.push_back ( b.keys [ j ] ) ;
+    result.containers.push_back ( b.containers [ j ] ) ;
+    }
+
+return result ;
+}
+
+
+//
+
+inline void swap ( roaring_bitmap & a, roaring_bitmap & b ) noexcept
+
+{
+a.swap ( b ) ;
+}
+
+
+
+#endif
@@ -0,0 +1,315 @@
+// Copyright Ivan Stanojevic 2025.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+
+
+
+#ifndef __SETBITS_H
+
+#define __SETBITS_H
+
+
+
+#include "cstddef.h"
+#include "iterator.h"
+#include "algorithm.h"
+#include "cassert.h"
+
+#include "numbase.h"
+#include "bitref.h"
+#include "bitvector.h"
+
+
+
+// *** SET BIT DECODING ***
+
+
+// Writes to indices the positions of the 1 bits of w, increased by base,
+// in increasing order.
+//
+// returns: number of 1 bits of w
+
+template < class Word, class Index >
+inline size_t decode_word_set_bits ( Word w, size_t base, Index * indices )
+
+{
+Index * p = indices ;
+
+for ( ; w != 0 ; w &= w - 1 )
+  {
+  * p = Index ( base + raw_find_bit_1 ( w ) ) ;
+  ++ p ;
+  }
+
+return p - indices ;
+}
+
+
+// Writes to indices the positions of at most n 1 bits of x at or after
+// position, in increasing order, and advances position past the last one
+// written.
+//
+// returns: number of positions written, less than n only if there are no
+//          more 1 bits
+
+template < class Index, class Word, class Allocator >
+size_t decode_set_bits ( const basic_bit_vector < Word, Allocator > & x,
+                         size_t & position,
+                         Index * indices,
+                         size_t n )
+
+{
+constexpr size_t word_bit_size = numeric_traits < Word > :: bit_size ;
+
+const size_t size = x.size ( ) ;
+
+if ( n == 0 )
+  return 0 ;
+
+if ( position >= size )
+  {
+  position = size ;
+  return 0 ;
+  }
+
+const Word * p = x.data ( ) ;
+
+const size_t word_size = ( size + word_bit_size - 1 ) / word_bit_size ;
+
+size_t i = position / word_bit_size,
+       result = 0 ;
+
+Word w = p [ i ] & Word ( Word ( -1 ) << position % word_bit_size ) ;
+
+for ( ; ; )
+  {
+  if ( size_t ( hamming_weight ( w ) ) > n - result )
+    {
+    for ( ; result < n ; ++ result, w &= w - 1 )
+      indices [ result ] = Index ( i * word_bit_size + raw_find_bit_1 ( w ) ) ;
+
+    position = i * word_bit_size + raw_find_bit_1 ( w ) ;
+    return result ;
+    }
+
+  result += decode_word_set_bits ( w, i * word_bit_size, indices + result ) ;
+
+  if ( ++ i == word_size )
+    {
+    position = size ;
+    return result ;
+    }
+
+  w = p [ i ] ;
+  }
+}
+
+
+
+// *** FOR_EACH_SET_BIT ***
+
+
+// Calls f ( n ) for the positions n of the 1 bits of x, in increasing
+// order.
+
+template < class Word, class Allocator, class F >
+F for_each_set_bit ( const basic_bit_vector < Word, Allocator > & x, F f )
+
+{
+constexpr size_t word_bit_size = numeric_traits < Word > :: bit_size ;
+
+const Word * p = x.data ( ) ;
+
+const size_t word_size = ( x.size ( ) + word_bit_size - 1 ) / word_bit_size ;
+
+for ( size_t i = 0, base = 0 ; i < word_size ; ++ i, base += word_bit_size )
+  for ( Word w = p [ i ] ; w != 0 ; w &= w - 1 )
+    f ( base + raw_find_bit_1 ( w ) ) ;
+
+return f ;
+}
+
+
+// Calls f ( n ) for the offsets n from first of the 1 bits of
+// [ first, last ), in increasing order. BitIterator is any of the bit
+// iterator types.
+
+template < class BitIterator, class F >
+F for_each_set_bit ( BitIterator first, BitIterator last, F f )
+
+{
+constexpr size_t word_bit_size =
+  numeric_traits < decltype ( first.word ( ) ) > :: bit_size ;
+
+assert ( valid_bit_iterator_range ( first, last ) ) ;
+
+size_t n = last - first ;
+
+for ( size_t base = 0 ; base < n ; base += word_bit_size )
+  {
+  for ( auto w = first.word ( min ( n - base, word_bit_size ) ) ;
+        w != 0 ;
+        w &= w - 1 )
+    f ( base + raw_find_bit_1 ( w ) ) ;
+
+  if ( n - base > word_bit_size )
+    first += word_bit_size ;
+  }
+
+return f ;
+}
+
+
+// Calls f ( indices, n ) for consecutive batches of the positions of the
+// 1 bits of x, in increasing order, where indices points to n positions,
+// 0 < n <= set_bit_batch_size.
+
+constexpr size_t set_bit_batch_size = 256 ;
+
+template < class Index = size_t, class Word, class Allocator, class F >
+F for_each_set_bit_batch ( const basic_bit_vector < Word, Allocator > & x,
+                           F f )
+
+{
+Index indices [ set_bit_batch_size ] ;
+
+size_t position = 0 ;
+
+for ( ; ; )
+  {
+  size_t n = decode_set_bits ( x, position, indices, set_bit_batch_size ) ;
+
+  if ( n == 0 )
+    break ;
+
+  f ( static_cast < const Index * > ( indices ), n ) ;
+  }
+
+return f ;
+}
+
+
+
+// *** SET_BIT_ITERATOR ***
+
+
+// Forward iterator over the positions of the 1 bits of a bit vector, in
+// increasing order.
+
+template < class Word >
+class set_bit_iterator
+
+{
+private:
+
+  static constexpr size_t word_bit_size = numeric_traits < Word > :: bit_size ;
+
+  const Word * data_ ;
+  const Word * word_position ;
+  const Word * word_end ;
+  Word word ;
+
+  void skip_zero_words ( ) noexcept
+    { while ( word == 0  &&  ++ word_position != word_end )
+        word = * word_position ; }
+
+public:
+
+  typedef ptrdiff_t difference_type ;
+  typedef size_t value_type ;
+  typedef const size_t * pointer ;
+  typedef size_t reference ;
+  typedef forward_iterator_tag iterator_category ;
+
+  set_bit_iterator ( ) noexcept :
+    data_ ( nullptr ),
+    word_position ( nullptr ),
+    word_end ( nullptr ),
+    word ( 0 )
+    { }
+
+  // iterator at the first 1 bit of the n words from p, or at the end if
+  // at_end is true
+
+  set_bit_iterator ( const Word * p, size_t n, bool at_end = false ) noexcept :
+    data_ ( p ),
+    word_position ( at_end ? p + n : p ),
+    word_end ( p + n ),
+    word ( at_end  ||  n == 0 ? Word ( 0 ) : * p )
+    { if ( ! at_end  &&  n > 0 )
+        skip_zero_words ( ) ; }
+
+  size_t operator * ( ) const noexcept
+    { return   size_t ( word_position - data_ ) * word_bit_size
+             + raw_find_bit_1 ( word ) ; }
+
+  set_bit_iterator & operator ++ ( ) noexcept
+    { word &= word - 1 ;
+      skip_zero_words ( ) ;
+      return * this ; }
+
+  set_bit_iterator operator ++ ( int ) noexcept
+    { set_bit_iterator t ( * this ) ;
+      ++ * this ;
+      return t ; }
+
+  friend bool operator == ( const set_bit_iterator & a,
+                            const set_bit_iterator & b ) noexcept
+    { return a.word_position == b.word_position  &&  a.word == b.word ; }
+
+  friend bool operator != ( const set_bit_iterator & a,
+                            const set_bit_iterator & b ) noexcept
+    { return ! ( a == b ) ; }
+
+} ;
+
+
+// The positions of the 1 bits of a bit vector, as a range for range-based
+// for loops. The bit vector must outlive the range and must not be
+// modified.
+
+template < class Word >
+class set_bit_range
+
+{
+private:
+
+  const Word * data_ ;
+  size_t word_size ;
+
+public:
+
+  typedef set_bit_iterator < Word > iterator ;
+  typedef set_bit_iterator < Word > const_iterator ;
+
+  set_bit_range ( const Word * i_data, size_t i_word_size ) noexcept :
+    data_ ( i_data ),
+    word_size ( i_word_size )
+    { }
+
+  iterator begin ( ) const noexcept
+    { return iterator ( data_, word_size ) ; }
+
+  iterator end ( ) const noexcept
+    { return iterator ( data_, word_size, true ) ; }
+
+} ;
+
+
+//
+
+template < class Word, class Allocator >
+inline set_bit_range < Word >
+         set_bits ( const basic_bit_vector < Word, Allocator > & x )
+
+{
+constexpr size_t word_bit_size = numeric_traits < Word > :: bit_size ;
+
+return set_bit_range < Word >
+         ( x.data ( ), ( x.size ( ) + word_bit_size - 1 ) / word_bit_size ) ;
+}
+
+
+
+#endif
@@ -93,48 +93,48 @@ bool operator < ( const signed_small_int < T, Bits > & a,
                   const signed_small_int < T, Bits > & b ) ;
 
 template < class T, sint Bits >
-bool is_negative ( const signed_small_int < T, Bits > & x ) ;
+constexpr bool is_negative ( const signed_small_int < T, Bits > & x ) ;
 
 template < class T, sint Bits >
-bool is_high_bit_set ( const signed_small_int < T, Bits > & x ) ;
+constexpr bool is_high_bit_set ( const signed_small_int < T, Bits > & x ) ;
 
 template < class T, sint Bits >
 sint hamming_weight ( const signed_small_int < T, Bits > & x ) ;
 
 template < class T, sint Bits >
-signed_small_int < T, Bits >
+constexpr signed_small_int < T, Bits >
   signed_shift_right ( const signed_small_int < T, Bits > & x, sint n ) ;
 
 template < class T, sint Bits >
-signed_small_int < T, Bits >
+constexpr signed_small_int < T, Bits >
   unsigned_shift_right ( const signed_small_int < T, Bits > & x, sint n ) ;
 
 template < class T, sint Bits >
-signed_small_int < T, Bits >
+constexpr signed_small_int < T, Bits >
   low_half ( const signed_small_int < T, Bits > & x ) ;
 
 template < class T, sint Bits >
-signed_small_int < T, Bits >
+constexpr signed_small_int < T, Bits >
   low_half_high ( const signed_small_int < T, Bits > & x ) ;
 
 template < class T, sint Bits >
-signed_small_int < T, Bits >
+constexpr signed_small_int < T, Bits >
   high_half ( const signed_small_int < T, Bits > & x ) ;
 
 template < class T, sint Bits >
-sint exponent ( const signed_small_int < T, Bits > & x ) ;
+constexpr sint exponent ( const signed_small_int < T, Bits > & x ) ;
 
 template < class T, sint Bits >
-void normalize_gcd ( signed_small_int < T, Bits > & gcd ) ;
+constexpr void normalize_gcd ( signed_small_int < T, Bits > & gcd ) ;
 
 template < class T, sint Bits >
-void normalize_gcd_ext ( signed_small_int < T, Bits > & c,
-                         signed_small_int < T, Bits > & d,
-                         signed_small_int < T, Bits > & gcd ) ;
+constexpr void normalize_gcd_ext ( signed_small_int < T, Bits > & c,
+                                   signed_small_int < T, Bits > & d,
+                                   signed_small_int < T, Bits > & gcd ) ;
 
 template < class T, sint Bits >
-void normalize_fraction ( signed_small_int < T, Bits > & a,
-                          signed_small_int < T, Bits > & b ) ;
+constexpr void normalize_fraction ( signed_small_int < T, Bits > & a,
+                                    signed_small_int < T, Bits > & b ) ;
 
 
 //
@@ -194,36 +194,36 @@ bool operator < ( const unsigned_small_int < T, Bits > & a,
                   const unsigned_small_int < T, Bits > & b ) ;
 
 template < class T, sint Bits >
-bool is_negative ( const unsigned_small_int < T, Bits > & x ) ;
+constexpr bool is_negative ( const unsigned_small_int < T, Bits > & x ) ;
 
 template < class T, sint Bits >
-bool is_high_bit_set ( const unsigned_small_int < T, Bits > & x ) ;
+constexpr bool is_high_bit_set ( const unsigned_small_int < T, Bits > & x ) ;
 
 template < class T, sint Bits >
 sint hamming_weight ( const unsigned_small_int < T, Bits > & x ) ;
 
 template < class T, sint Bits >
-unsigned_small_int < T, Bits >
+constexpr unsigned_small_int < T, Bits >
   signed_shift_right ( const unsigned_small_int < T, Bits > & x, sint n ) ;
 
 template < class T, sint Bits >
-unsigned_small_int < T, Bits >
+constexpr unsigned_small_int < T, Bits >
   unsigned_shift_right ( const unsigned_small_int < T, Bits > & x, sint n ) ;
 
 template < class T, sint Bits >
-unsigned_small_int < T, Bits >
+constexpr unsigned_small_int < T, Bits >
   low_half ( const unsigned_small_int < T, Bits > & x ) ;
 
 template < class T, sint Bits >
-unsigned_small_int < T, Bits >
+constexpr unsigned_small_int < T, Bits >
   low_half_high ( const unsigned_small_int < T, Bits > & x ) ;
 
 template < class T, sint Bits >
-unsigned_small_int < T, Bits >
+constexpr unsigned_small_int < T, Bits >
   high_half ( const unsigned_small_int < T, Bits > & x ) ;
 
 template < class T, sint Bits >
-sint exponent ( const unsigned_small_int < T, Bits > & x ) ;
+constexpr sint exponent ( const unsigned_small_int < T, Bits > & x ) ;
 
 
 
@@ -269,81 +269,17 @@ private:
 
 protected:
 
-  static const unsigned_value_type high_bit_mask ;
-  static const unsigned_value_type low_bits_mask ;
-  static const unsigned_value_type mask ;
-
-} ;
-
-
-//
+  static constexpr unsigned_value_type
+    high_bit_mask = unsigned_value_type ( 1 ) << ( bit_size - 1 ) ;
 
-template < class T, sint Bits >
-const typename small_int_base < T, Bits > :: unsigned_value_type
-  small_int_base < T, Bits > :: high_bit_mask =
-    unsigned_value_type ( 1 ) << ( bit_size - 1 ) ;
+  static constexpr unsigned_value_type
+    low_bits_mask = high_bit_mask - unsigned_value_type ( 1 ) ;
 
+  static constexpr unsigned_value_type
+    mask = high_bit_mask + low_bits_mask ;
 
-//
-
-template < class T, sint Bits >
-const typename small_int_base < T, Bits > :: unsigned_value_type
-  small_int_base < T, Bits > :: low_bits_mask =
-    high_bit_mask - unsigned_value_type ( 1 ) ;
-
-
-//
-
-template < class T, sint Bits >
-const typename small_int_base < T, Bits > :: unsigned_value_type
-  small_int_base < T, Bits > :: mask =
-    high_bit_mask + low_bits_mask ;
-
-
-
-//
-
-#ifdef NDEBUG
-
-#define __DEFINE_SMALL_INT_BASE(Type)                                     \
-                                                                          \
-template < sint Bits >                                                    \
-class small_int_base < Type, Bits >                                       \
-                                                                          \
-{                                                                         \
-public:                                                                   \
-                                                                          \
-  typedef numeric_traits < Type > :: signed_type signed_value_type ;      \
-  typedef numeric_traits < Type > :: unsigned_type unsigned_value_type ;  \
-                                                                          \
-  static constexpr sint bit_size = Bits ;                                 \
-                                                                          \
-private:                                                                  \
-                                                                          \
-  static_assert                                                           \
-    (     bit_size > 0                                                    \
-      &&  bit_size <= numeric_traits < unsigned_value_type > :: bit_size, \
-      "Illegal bit size." )  ;                                            \
-                                                                          \
-protected:                                                                \
-                                                                          \
-  static constexpr unsigned_value_type                                    \
-    high_bit_mask = unsigned_value_type ( 1 ) << ( bit_size - 1 ) ;       \
-                                                                          \
-  static constexpr unsigned_value_type                                    \
-    low_bits_mask = high_bit_mask - unsigned_value_type ( 1 ) ;           \
-                                                                          \
-  static constexpr unsigned_value_type                                    \
-    mask = high_bit_mask + low_bits_mask ;                                \
-                                                                          \
 } ;
 
-FOR_BUILTIN_INTEGRAL_TYPES(__DEFINE_SMALL_INT_BASE)
-
-#undef __DEFINE_SMALL_INT_BASE
-
-#endif
-
 
 
 // *** SIGNED_SMALL_INT ***
@@ -369,180 +305,180 @@ private:
 
 public:
 
-  signed_small_int ( ) :
+  constexpr signed_small_int ( ) :
     data ( 0 )
     { }
 
-  signed_small_int ( const signed_value_type & x ) :
+  constexpr signed_small_int ( const signed_value_type & x ) :
     data ( x & mask )
     { }
 
-  signed_small_int ( const unsigned_value_type & x ) :
+  constexpr signed_small_int ( const unsigned_value_type & x ) :
     data ( x & mask )
     { }
 
   template < sint XBits >
-  signed_small_int ( const signed_small_int < T, XBits > & x ) :
+  constexpr signed_small_int ( const signed_small_int < T, XBits > & x ) :
     data ( x.signed_data ( ) & mask )
     { }
 
   template < class S >
-  signed_small_int ( S x,
-                     typename implicit_conversion_test
-                                < S, unsigned_value_type > :: result =
-                       implicit_conversion_allowed ) :
+  constexpr signed_small_int ( S x,
+                               typename implicit_conversion_test
+                                 < S, unsigned_value_type > :: result =
+                                 implicit_conversion_allowed ) :
     data ( unsigned_value_type ( x ) & mask )
     { }
 
-  static signed_small_int min ( )
+  static constexpr signed_small_int min ( )
     { return signed_small_int ( high_bit_mask ) ; }
 
-  static signed_small_int max ( )
+  static constexpr signed_small_int max ( )
     { return signed_small_int ( low_bits_mask ) ; }
 
-  signed_value_type signed_data ( ) const
+  constexpr signed_value_type signed_data ( ) const
     { return convert_to < signed_value_type >
                ( data - ( ( data & high_bit_mask ) << 1 ) ) ; }
 
-  unsigned_value_type unsigned_data ( ) const
+  constexpr unsigned_value_type unsigned_data ( ) const
     { return data ; }
 
-  bool is_high_bit_set ( ) const
+  constexpr bool is_high_bit_set ( ) const
     { return ( data & high_bit_mask ) != unsigned_value_type ( 0 ) ; }
 
   sint hamming_weight ( ) const
     { return :: hamming_weight ( data ) ; }
 
-  const signed_small_int & operator + ( ) const
+  constexpr const signed_small_int & operator + ( ) const
     { return * this ; }
 
-  signed_small_int operator - ( ) const
+  constexpr signed_small_int operator - ( ) const
     { return signed_small_int ( - data ) ; }
 
-  friend signed_small_int operator + ( const signed_small_int & a,
-                                       const signed_small_int & b )
+  friend constexpr signed_small_int operator + ( const signed_small_int & a,
+                                                 const signed_small_int & b )
     { return signed_small_int ( a.data + b.data ) ; }
 
-  friend signed_small_int operator - ( const signed_small_int & a,
-                                       const signed_small_int & b )
+  friend constexpr signed_small_int operator - ( const signed_small_int & a,
+                                                 const signed_small_int & b )
     { return signed_small_int ( a.data - b.data ) ; }
 
-  friend signed_small_int operator * ( const signed_small_int & a,
-                                       const signed_small_int & b )
+  friend constexpr signed_small_int operator * ( const signed_small_int & a,
+                                                 const signed_small_int & b )
     { return signed_small_int ( a.data * b.data ) ; }
 
-  friend void divmod ( signed_small_int a, signed_small_int b,
-                       signed_small_int & q, signed_small_int & r )
+  friend constexpr void divmod ( signed_small_int a, signed_small_int b,
+                                 signed_small_int & q, signed_small_int & r )
     { q = a / b ;
       r = a % b ; }
 
-  friend signed_small_int operator / ( const signed_small_int & a,
-                                       const signed_small_int & b )
+  friend constexpr signed_small_int operator / ( const signed_small_int & a,
+                                                 const signed_small_int & b )
     { return signed_small_int ( a.signed_data ( ) / b.signed_data ( ) ) ; }
 
-  friend signed_small_int operator % ( const signed_small_int & a,
-                                       const signed_small_int & b )
+  friend constexpr signed_small_int operator % ( const signed_small_int & a,
+                                                 const signed_small_int & b )
     { return signed_small_int ( a.signed_data ( ) % b.signed_data ( ) ) ; }
 
-  signed_small_int & operator += ( const signed_small_int & b )
+  constexpr signed_small_int & operator += ( const signed_small_int & b )
     { data = ( data + b.data ) & mask ;
       return * this ; }
 
-  signed_small_int & operator -= ( const signed_small_int & b )
+  constexpr signed_small_int & operator -= ( const signed_small_int & b )
     { data = ( data - b.data ) & mask ;
       return * this ; }
 
-  signed_small_int & operator *= ( const signed_small_int & b )
+  constexpr signed_small_int & operator *= ( const signed_small_int & b )
     { data = ( data * b.data ) & mask ;
       return * this ; }
 
-  signed_small_int & operator /= ( const signed_small_int & b )
+  constexpr signed_small_int & operator /= ( const signed_small_int & b )
     { data = ( signed_data ( ) / b.signed_data ( ) ) & mask ;
       return * this ; }
 
-  signed_small_int & operator %= ( const signed_small_int & b )
+  constexpr signed_small_int & operator %= ( const signed_small_int & b )
     { data = ( signed_data ( ) % b.signed_data ( ) ) & mask ;
       return * this ; }
 
-  signed_small_int & operator ++ ( )
+  constexpr signed_small_int & operator ++ ( )
     { ++ data ;
       data &= mask ;
       return * this ; }
 
-  signed_small_int operator ++ ( int )
+  constexpr signed_small_int operator ++ ( int )
     { unsigned_value_type t ( data ) ;
       ++ * this ;
       return t ; }
 
-  signed_small_int & operator -- ( )
+  constexpr signed_small_int & operator -- ( )
     { -- data ;
       data &= mask ;
       return * this ; }
 
-  signed_small_int operator -- ( int )
+  constexpr signed_small_int operator -- ( int )
     { unsigned_value_type t ( data ) ;
       -- * this ;
       return t ; }
 
-  signed_small_int operator ~ ( ) const
+  constexpr signed_small_int operator ~ ( ) const
     { return signed_small_int ( ~ data ) ; }
 
-  friend signed_small_int operator & ( const signed_small_int & a,
-                                       const signed_small_int & b )
+  friend constexpr signed_small_int operator & ( const signed_small_int & a,
+                                                 const signed_small_int & b )
     { return signed_small_int ( a.data & b.data ) ; }
 
-  friend signed_small_int operator | ( const signed_small_int & a,
-                                       const signed_small_int & b )
+  friend constexpr signed_small_int operator | ( const signed_small_int & a,
+                                                 const signed_small_int & b )
     { return signed_small_int ( a.data | b.data ) ; }
 
-  friend signed_small_int operator ^ ( const signed_small_int & a,
-                                       const signed_small_int & b )
+  friend constexpr signed_small_int operator ^ ( const signed_small_int & a,
+                                                 const signed_small_int & b )
     { return signed_small_int ( a.data ^ b.data ) ; }
 
-  signed_small_int & operator &= ( const signed_small_int & b )
+  constexpr signed_small_int & operator &= ( const signed_small_int & b )
     { data &= b.data ;
       return * this ; }
 
-  signed_small_int & operator |= ( const signed_small_int & b )
+  constexpr signed_small_int & operator |= ( const signed_small_int & b )
     { data |= b.data ;
       return * this ; }
 
-  signed_small_int & operator ^= ( const signed_small_int & b )
+  constexpr signed_small_int & operator ^= ( const signed_small_int & b )
     { data ^= b.data ;
       return * this ; }
 
-  signed_small_int signed_shift_right ( sint n ) const
+  constexpr signed_small_int signed_shift_right ( sint n ) const
     { assert ( n >= 0  &&  n < bit_size ) ;
       return signed_small_int ( signed_data ( ) >> n ) ; }
 
-  signed_small_int unsigned_shift_right ( sint n ) const
+  constexpr signed_small_int unsigned_shift_right ( sint n ) const
     { assert ( n >= 0  &&  n < bit_size ) ;
       return signed_small_int ( data >> n ) ; }
 
-  signed_small_int operator << ( sint n ) const
+  constexpr signed_small_int operator << ( sint n ) const
     { assert ( n >= 0  &&  n < bit_size ) ;
       return signed_small_int ( data << n ) ; }
 
-  signed_small_int operator >> ( sint n ) const
+  constexpr signed_small_int operator >> ( sint n ) const
     { assert ( n >= 0  &&  n < bit_size ) ;
       return signed_shift_right ( n ) ; }
 
-  signed_small_int & operator <<= ( sint n )
+  constexpr signed_small_int & operator <<= ( sint n )
     { assert ( n >= 0  &&  n < bit_size ) ;
       data = ( data << n ) & mask ;
       return * this ; }
 
-  signed_small_int & operator >>= ( sint n )
+  constexpr signed_small_int & operator >>= ( sint n )
     { assert ( n >= 0  &&  n < bit_size ) ;
       data = ( signed_data ( ) >> n ) & mask ;
       return * this ; }
 
-  friend bool operator == ( const signed_small_int & a,
-                            const signed_small_int & b )
+  friend constexpr bool operator == ( const signed_small_int & a,
+                                      const signed_small_int & b )
     { return a.data == b.data ; }
 
-  friend bool operator < ( const signed_small_int & a,
-                           const signed_small_int & b )
+  friend constexpr bool operator < ( const signed_small_int & a,
+                                     const signed_small_int & b )
     { return ( ( a.data - b.data ) & high_bit_mask ) != 0 ; }
 
   template < class CharT, class CharTraits >
@@ -589,10 +525,10 @@ public:
                           void >
     double_size_type ;
 
-  static signed_small_int < T, Bits > min ( )
+  static constexpr signed_small_int < T, Bits > min ( )
     { return signed_small_int < T, Bits > :: min ( ) ; }
 
-  static signed_small_int < T, Bits > max ( )
+  static constexpr signed_small_int < T, Bits > max ( )
     { return signed_small_int < T, Bits > :: max ( ) ; }
 
 } ;
@@ -630,7 +566,7 @@ class range_rnd_static_generator < signed_small_int < T, Bits > > :
 //
 
 template < class T, sint Bits >
-inline bool is_negative ( const signed_small_int < T, Bits > & x )
+constexpr bool is_negative ( const signed_small_int < T, Bits > & x )
 
 {
 return x.is_high_bit_set ( ) ;
@@ -640,7 +576,7 @@ return x.is_high_bit_set ( ) ;
 //
 
 template < class T, sint Bits >
-inline bool is_high_bit_set ( const signed_small_int < T, Bits > & x )
+constexpr bool is_high_bit_set ( const signed_small_int < T, Bits > & x )
 
 {
 return x.is_high_bit_set ( ) ;
@@ -660,7 +596,7 @@ return x.hamming_weight ( ) ;
 //
 
 template < class T, sint Bits >
-inline
+constexpr
   signed_small_int < T, Bits >
     signed_shift_right ( const signed_small_int < T, Bits > & x, sint n )
 
@@ -672,7 +608,7 @@ return x.signed_shift_right ( n ) ;
 //
 
 template < class T, sint Bits >
-inline
+constexpr
   signed_small_int < T, Bits >
     unsigned_shift_right ( const signed_small_int < T, Bits > & x, sint n )
 
@@ -684,8 +620,8 @@ return x.unsigned_shift_right ( n ) ;
 //
 
 template < class T, sint Bits >
-inline signed_small_int < T, Bits >
-         low_half ( const signed_small_int < T, Bits > & x )
+constexpr signed_small_int < T, Bits >
+            low_half ( const signed_small_int < T, Bits > & x )
 
 {
 return generic_low_half ( x ) ;
@@ -695,8 +631,8 @@ return generic_low_half ( x ) ;
 //
 
 template < class T, sint Bits >
-inline signed_small_int < T, Bits >
-         low_half_high ( const signed_small_int < T, Bits > & x )
+constexpr signed_small_int < T, Bits >
+            low_half_high ( const signed_small_int < T, Bits > & x )
 
 {
 return generic_low_half_high ( x ) ;
@@ -706,8 +642,8 @@ return generic_low_half_high ( x ) ;
 //
 
 template < class T, sint Bits >
-inline signed_small_int < T, Bits >
-         high_half ( const signed_small_int < T, Bits > & x )
+constexpr signed_small_int < T, Bits >
+            high_half ( const signed_small_int < T, Bits > & x )
 
 {
 return generic_high_half ( x ) ;
@@ -717,7 +653,7 @@ return generic_high_half ( x ) ;
 //
 
 template < class T, sint Bits >
-inline sint exponent ( const signed_small_int < T, Bits > & x )
+constexpr sint exponent ( const signed_small_int < T, Bits > & x )
 
 {
 return exponent ( x.signed_data ( ) ) ;
@@ -727,7 +663,7 @@ return exponent ( x.signed_data ( ) ) ;
 //
 
 template < class T, sint Bits >
-inline void normalize_gcd ( signed_small_int < T, Bits > & gcd )
+constexpr void normalize_gcd ( signed_small_int < T, Bits > & gcd )
 
 {
 if ( is_negative ( gcd ) )
@@ -738,9 +674,9 @@ if ( is_negative ( gcd ) )
 //
 
 template < class T, sint Bits >
-inline void normalize_gcd_ext ( signed_small_int < T, Bits > & c,
-                                signed_small_int < T, Bits > & d,
-                                signed_small_int < T, Bits > & gcd )
+constexpr void normalize_gcd_ext ( signed_small_int < T, Bits > & c,
+                                   signed_small_int < T, Bits > & d,
+                                   signed_small_int < T, Bits > & gcd )
 
 {
 if ( is_negative ( gcd ) )
@@ -755,8 +691,8 @@ if ( is_negative ( gcd ) )
 //
 
 template < class T, sint Bits >
-inline void normalize_fraction ( signed_small_int < T, Bits > & a,
-                                 signed_small_int < T, Bits > & b )
+constexpr void normalize_fraction ( signed_small_int < T, Bits > & a,
+                                    signed_small_int < T, Bits > & b )
 
 {
 if ( is_negative ( b ) )
@@ -841,185 +777,194 @@ private:
 
 public:
 
-  unsigned_small_int ( ) :
+  constexpr unsigned_small_int ( ) :
     data ( 0 )
     { }
 
-  unsigned_small_int ( const signed_value_type & x ) :
+  constexpr unsigned_small_int ( const signed_value_type & x ) :
     data ( x & mask )
     { }
 
-  unsigned_small_int ( const unsigned_value_type & x ) :
+  constexpr unsigned_small_int ( const unsigned_value_type & x ) :
     data ( x & mask )
     { }
 
   template < sint XBits >
-  unsigned_small_int ( const signed_small_int < T, XBits > & x ) :
+  constexpr unsigned_small_int ( const signed_small_int < T, XBits > & x ) :
     data ( x.signed_data ( ) & mask )
     { }
 
   template < sint XBits >
-  unsigned_small_int ( const unsigned_small_int < T, XBits > & x ) :
+  constexpr unsigned_small_int ( const unsigned_small_int < T, XBits > & x ) :
     data ( x.unsigned_data ( ) & mask )
     { }
 
   template < class S >
-  unsigned_small_int ( S x,
-                       typename implicit_conversion_test
-                                  < S, unsigned_value_type > :: result =
-                         implicit_conversion_allowed ) :
+  constexpr unsigned_small_int ( S x,
+                                 typename implicit_conversion_test
+                                   < S, unsigned_value_type > :: result =
+                                   implicit_conversion_allowed ) :
     data ( unsigned_value_type ( x ) & mask )
     { }
 
-  static unsigned_small_int min ( )
+  static constexpr unsigned_small_int min ( )
     { return unsigned_small_int ( 0 ) ; }
 
-  static unsigned_small_int max ( )
+  static constexpr unsigned_small_int max ( )
     { return unsigned_small_int ( mask ) ; }
 
-  signed_value_type signed_data ( ) const
+  constexpr signed_value_type signed_data ( ) const
     { return convert_to < signed_value_type >
                ( data - ( ( data & high_bit_mask ) << 1 ) ) ; }
 
-  unsigned_value_type unsigned_data ( ) const
+  constexpr unsigned_value_type unsigned_data ( ) const
     { return data ; }
 
-  bool is_high_bit_set ( ) const
+  constexpr bool is_high_bit_set ( ) const
     { return ( data & high_bit_mask ) != unsigned_value_type ( 0 ) ; }
 
   sint hamming_weight ( ) const
     { return :: hamming_weight ( data ) ; }
 
-  const unsigned_small_int & operator + ( ) const
+  constexpr const unsigned_small_int & operator + ( ) const
     { return * this ; }
 
-  unsigned_small_int operator - ( ) const
+  constexpr unsigned_small_int operator - ( ) const
     { return unsigned_small_int ( - data ) ; }
 
-  friend unsigned_small_int operator + ( const unsigned_small_int & a,
-                                         const unsigned_small_int & b )
+  friend constexpr unsigned_small_int
+    operator + ( const unsigned_small_int & a,
+                 const unsigned_small_int & b )
     { return unsigned_small_int ( a.data + b.data ) ; }
 
-  friend unsigned_small_int operator - ( const unsigned_small_int & a,
-                                         const unsigned_small_int & b )
+  friend constexpr unsigned_small_int
+    operator - ( const unsigned_small_int & a,
+                 const unsigned_small_int & b )
     { return unsigned_small_int ( a.data - b.data ) ; }
 
-  friend unsigned_small_int operator * ( const unsigned_small_int & a,
-                                         const unsigned_small_int & b )
+  friend constexpr unsigned_small_int
+    operator * ( const unsigned_small_int & a,
+                 const unsigned_small_int & b )
     { return unsigned_small_int ( a.data * b.data ) ; }
 
-  friend void divmod ( unsigned_small_int a, unsigned_small_int b,
-                       unsigned_small_int & q, unsigned_small_int & r )
+  friend constexpr void
+    divmod ( unsigned_small_int a, unsigned_small_int b,
+             unsigned_small_int & q, unsigned_small_int & r )
     { q = a / b ;
       r = a % b ; }
 
-  friend unsigned_small_int operator / ( const unsigned_small_int & a,
-                                         const unsigned_small_int & b )
+  friend constexpr unsigned_small_int
+    operator / ( const unsigned_small_int & a,
+                 const unsigned_small_int & b )
     { return unsigned_small_int ( a.data / b.data ) ; }
 
-  friend unsigned_small_int operator % ( const unsigned_small_int & a,
-                                         const unsigned_small_int & b )
+  friend constexpr unsigned_small_int
+    operator % ( const unsigned_small_int & a,
+                 const unsigned_small_int & b )
     { return unsigned_small_int ( a.data % b.data ) ; }
 
-  unsigned_small_int & operator += ( const unsigned_small_int & b )
+  constexpr unsigned_small_int & operator += ( const unsigned_small_int & b )
     { data = ( data + b.data ) & mask ;
       return * this ; }
 
-  unsigned_small_int & operator -= ( const unsigned_small_int & b )
+  constexpr unsigned_small_int & operator -= ( const unsigned_small_int & b )
     { data = ( data - b.data ) & mask ;
       return * this ; }
 
-  unsigned_small_int & operator *= ( const unsigned_small_int & b )
+  constexpr unsigned_small_int & operator *= ( const unsigned_small_int & b )
     { data = ( data * b.data ) & mask ;
       return * this ; }
 
-  unsigned_small_int & operator /= ( const unsigned_small_int & b )
+  constexpr unsigned_small_int & operator /= ( const unsigned_small_int & b )
     { data /= b.data ;
       return * this ; }
 
-  unsigned_small_int & operator %= ( const unsigned_small_int & b )
+  constexpr unsigned_small_int & operator %= ( const unsigned_small_int & b )
     { data %= b.data ;
       return * this ; }
 
-  unsigned_small_int & operator ++ ( )
+  constexpr unsigned_small_int & operator ++ ( )
     { ++ data ;
       data &= mask ;
       return * this ; }
 
-  unsigned_small_int operator ++ ( int )
+  constexpr unsigned_small_int operator ++ ( int )
     { unsigned_value_type t ( data ) ;
       ++ * this ;
       return t ; }
 
-  unsigned_small_int & operator -- ( )
+  constexpr unsigned_small_int & operator -- ( )
     { -- data ;
       data &= mask ;
       return * this ; }
 
-  unsigned_small_int operator -- ( int )
+  constexpr unsigned_small_int operator -- ( int )
     { unsigned_value_type t ( data ) ;
       -- * this ;
       return t ; }
 
-  unsigned_small_int operator ~ ( ) const
+  constexpr unsigned_small_int operator ~ ( ) const
     { return unsigned_small_int ( ~ data ) ; }
 
-  friend unsigned_small_int operator & ( const unsigned_small_int & a,
-                                         const unsigned_small_int & b )
+  friend constexpr unsigned_small_int
+    operator & ( const unsigned_small_int & a,
+                 const unsigned_small_int & b )
     { return unsigned_small_int ( a.data & b.data ) ; }
 
-  friend unsigned_small_int operator | ( const unsigned_small_int & a,
-                                         const unsigned_small_int & b )
+  friend constexpr unsigned_small_int
+    operator | ( const unsigned_small_int & a,
+                 const unsigned_small_int & b )
     { return unsigned_small_int ( a.data | b.data ) ; }
 
-  friend unsigned_small_int operator ^ ( const unsigned_small_int & a,
-                                         const unsigned_small_int & b )
+  friend constexpr unsigned_small_int
+    operator ^ ( const unsigned_small_int & a,
+                 const unsigned_small_int & b )
     { return unsigned_small_int ( a.data ^ b.data ) ; }
 
-  unsigned_small_int & operator &= ( const unsigned_small_int & b )
+  constexpr unsigned_small_int & operator &= ( const unsigned_small_int & b )
     { data &= b.data ;
       return * this ; }
 
-  unsigned_small_int & operator |= ( const unsigned_small_int & b )
+  constexpr unsigned_small_int & operator |= ( const unsigned_small_int & b )
     { data |= b.data ;
       return * this ; }
 
-  unsigned_small_int & operator ^= ( const unsigned_small_int & b )
+  constexpr unsigned_small_int & operator ^= ( const unsigned_small_int & b )
     { data ^= b.data ;
       return * this ; }
 
-  unsigned_small_int signed_shift_right ( sint n ) const
+  constexpr unsigned_small_int signed_shift_right ( sint n ) const
     { assert ( n >= 0  &&  n < bit_size ) ;
       return unsigned_small_int ( signed_data ( ) >> n ) ; }
 
-  unsigned_small_int unsigned_shift_right ( sint n ) const
+  constexpr unsigned_small_int unsigned_shift_right ( sint n ) const
     { assert ( n >= 0  &&  n < bit_size ) ;
       return unsigned_small_int ( data >> n ) ; }
 
-  unsigned_small_int operator << ( sint n ) const
+  constexpr unsigned_small_int operator << ( sint n ) const
     { assert ( n >= 0  &&  n < bit_size ) ;
       return unsigned_small_int ( data << n ) ; }
 
-  unsigned_small_int operator >> ( sint n ) const
+  constexpr unsigned_small_int operator >> ( sint n ) const
     { assert ( n >= 0  &&  n < bit_size ) ;
       return unsigned_shift_right ( n ) ; }
 
-  unsigned_small_int & operator <<= ( sint n )
+  constexpr unsigned_small_int & operator <<= ( sint n )
     { assert ( n >= 0  &&  n < bit_size ) ;
       data = ( data << n ) & mask ;
       return * this ; }
 
-  unsigned_small_int & operator >>= ( sint n )
+  constexpr unsigned_small_int & operator >>= ( sint n )
     { assert ( n >= 0  &&  n < bit_size ) ;
       data >>= n ;
       return * this ; }
 
-  friend bool operator == ( const unsigned_small_int & a,
-                            const unsigned_small_int & b )
+  friend constexpr bool operator == ( const unsigned_small_int & a,
+                                      const unsigned_small_int & b )
     { return a.data == b.data ; }
 
-  friend bool operator < ( const unsigned_small_int & a,
-                           const unsigned_small_int & b )
+  friend constexpr bool operator < ( const unsigned_small_int & a,
+                                     const unsigned_small_int & b )
     { return a.data < b.data ; }
 
   template < class CharT, class CharTraits >
@@ -1066,10 +1011,10 @@ public:
                           void >
     double_size_type ;
 
-  static unsigned_small_int < T, Bits > min ( )
+  static constexpr unsigned_small_int < T, Bits > min ( )
     { return unsigned_small_int < T, Bits > :: min ( ) ; }
 
-  static unsigned_small_int < T, Bits > max ( )
+  static constexpr unsigned_small_int < T, Bits > max ( )
     { return unsigned_small_int < T, Bits > :: max ( ) ; }
 
 } ;
@@ -1107,7 +1052,7 @@ class range_rnd_static_generator < unsigned_small_int < T, Bits > > :
 //
 
 template < class T, sint Bits >
-inline bool is_negative ( const unsigned_small_int < T, Bits > & x )
+constexpr bool is_negative ( const unsigned_small_int < T, Bits > & x )
 
 {
 return false ;
@@ -1117,7 +1062,7 @@ return false ;
 //
 
 template < class T, sint Bits >
-inline bool is_high_bit_set ( const unsigned_small_int < T, Bits > & x )
+constexpr bool is_high_bit_set ( const unsigned_small_int < T, Bits > & x )
 
 {
 return x.is_high_bit_set ( ) ;
@@ -1137,7 +1082,7 @@ return x.hamming_weight ( ) ;
 //
 
 template < class T, sint Bits >
-inline
+constexpr
   unsigned_small_int < T, Bits >
     signed_shift_right ( const unsigned_small_int < T, Bits > & x, sint n )
 
@@ -1149,7 +1094,7 @@ return x.signed_shift_right ( n ) ;
 //
 
 template < class T, sint Bits >
-inline
+constexpr
   unsigned_small_int < T, Bits >
     unsigned_shift_right ( const unsigned_small_int < T, Bits > & x, sint n )
 
@@ -1161,8 +1106,8 @@ return x.unsigned_shift_right ( n ) ;
 //
 
 template < class T, sint Bits >
-inline unsigned_small_int < T, Bits >
-         low_half ( const unsigned_small_int < T, Bits > & x )
+constexpr unsigned_small_int < T, Bits >
+            low_half ( const unsigned_small_int < T, Bits > & x )
 
 {
 return generic_low_half ( x ) ;
@@ -1172,8 +1117,8 @@ return generic_low_half ( x ) ;
 //
 
 template < class T, sint Bits >
-inline unsigned_small_int < T, Bits >
-         low_half_high ( const unsigned_small_int < T, Bits > & x )
+constexpr unsigned_small_int < T, Bits >
+            low_half_high ( const unsigned_small_int < T, Bits > & x )
 
 {
 return generic_low_half_high ( x ) ;
@@ -1183,8 +1128,8 @@ return generic_low_half_high ( x ) ;
 //
 
 template < class T, sint Bits >
-inline unsigned_small_int < T, Bits >
-         high_half ( const unsigned_small_int < T, Bits > & x )
+constexpr unsigned_small_int < T, Bits >
+            high_half ( const unsigned_small_int < T, Bits > & x )
 
 {
 return generic_high_half ( x ) ;
@@ -1194,7 +1139,7 @@ return generic_high_half ( x ) ;
 //
 
 template < class T, sint Bits >
-inline sint exponent ( const unsigned_small_int < T, Bits > & x )
+constexpr sint exponent ( const unsigned_small_int < T, Bits > & x )
 
 {
 return exponent ( x.unsigned_data ( ) ) ;
@@ -1266,6 +1211,38 @@ class implicit_conversion_test < S, unsigned_small_int < T, Bits > > :
 // *** TYPE CONVERSION ***
 
 
+//
+
+template < class T, sint Bits >
+class type_converter < signed_small_int < T, Bits >,
+                       signed_small_int < T, Bits > >
+
+{
+public:
+
+  static constexpr signed_small_int < T, Bits >
+    operate ( const signed_small_int < T, Bits > & x )
+    { return x ; }
+
+} ;
+
+
+//
+
+template < class T, sint Bits >
+class type_converter < unsigned_small_int < T, Bits >,
+                       unsigned_small_int < T, Bits > >
+
+{
+public:
+
+  static constexpr unsigned_small_int < T, Bits >
+    operate ( const unsigned_small_int < T, Bits > & x )
+    { return x ; }
+
+} ;
+
+
 //
 
 template < class T, sint Bits >
@@ -1275,7 +1252,7 @@ class type_converter < unsigned_small_int < T, Bits >,
 {
 public:
 
-  static signed_small_int < T, Bits >
+  static constexpr signed_small_int < T, Bits >
     operate ( const unsigned_small_int < T, Bits > & x )
     { return signed_small_int < T, Bits > ( x.unsigned_data ( ) ) ; }
 
@@ -1292,8 +1269,9 @@ class type_converter
 {
 public:
 
-  static typename signed_small_int < T, Bits > :: signed_value_type
-    operate ( const signed_small_int < T, Bits > & x )
+  static constexpr
+    typename signed_small_int < T, Bits > :: signed_value_type
+      operate ( const signed_small_int < T, Bits > & x )
     { return x.signed_data ( ) ; }
 
 } ;
@@ -1307,7 +1285,7 @@ class type_converter < signed_small_int < T, Bits >, U >
 {
 public:
 
-  static U operate ( const signed_small_int < T, Bits > & x )
+  static constexpr U operate ( const signed_small_int < T, Bits > & x )
     { return convert_to < U > ( x.signed_data ( ) ) ; }
 
 } ;
@@ -1323,8 +1301,9 @@ class type_converter
 {
 public:
 
-  static typename unsigned_small_int < T, Bits > :: unsigned_value_type
-    operate ( const unsigned_small_int < T, Bits > & x )
+  static constexpr
+    typename unsigned_small_int < T, Bits > :: unsigned_value_type
+      operate ( const unsigned_small_int < T, Bits > & x )
     { return x.unsigned_data ( ) ; }
 
 } ;
@@ -1338,7 +1317,7 @@ class type_converter < unsigned_small_int < T, Bits >, U >
 {
 public:
 
-  static U operate ( const unsigned_small_int < T, Bits > & x )
+  static constexpr U operate ( const unsigned_small_int < T, Bits > & x )
     { return convert_to < U > ( x.unsigned_data ( ) ) ; }
 
 } ;
@@ -14,6 +14,7 @@
 #include "compspec.h"
 
 #include "cstddef.h"
+#include "algorithm.h"
 #include "functional.h"
 #include "mutex.h"
 #include "condition_variable.h"
@@ -239,10 +240,10 @@ public:
         pdh.clear ( ) ; }
 
     template < class F, class ... Args >
-    future < invoke_result_t < decay_t < F > ( decay_t < Args > ... ) > >
+    future < invoke_result_t < decay_t < F >, decay_t < Args > ... > >
       run_monitored ( F && f, Args && ... args )
       { assert ( valid ( ) ) ;
-        typedef invoke_result_t < decay_t < F > ( decay_t < Args > ... ) >
+        typedef invoke_result_t < decay_t < F >, decay_t < Args > ... >
           result_type ;
         monitored_task < result_type >
           mt ( bind ( forward < F > ( f ),
@@ -253,12 +254,12 @@ public:
         return ft ; }
 
     template < class F, class ... Args >
-    future < invoke_result_t < decay_t < F > ( decay_t < Args > ... ,
-                                               size_t ) > >
+    future < invoke_result_t < decay_t < F >, decay_t < Args > ... ,
+                               size_t > >
       run_monitored_with_index ( F && f, Args && ... args )
       { assert ( valid ( ) ) ;
-        typedef invoke_result_t < decay_t < F > ( decay_t < Args > ... ,
-                                                  size_t ) >
+        typedef invoke_result_t < decay_t < F >, decay_t < Args > ... ,
+                                  size_t >
           result_type ;
         monitored_task < result_type >
           mt ( bind ( forward < F > ( f ),
@@ -314,14 +315,14 @@ public:
                                     forward < Args > ( args ) ... ) ; }
 
   template < class F, class ... Args >
-  future < invoke_result_t < decay_t < F > ( decay_t < Args > ... ) > >
+  future < invoke_result_t < decay_t < F >, decay_t < Args > ... > >
     run_monitored ( F && f, Args && ... args )
     { return get_slot ( ).run_monitored ( forward < F > ( f ),
                                           forward < Args > ( args ) ... ) ; }
 
   template < class F, class ... Args >
-  future < invoke_result_t < decay_t < F > ( decay_t < Args > ... ,
-                                             size_t ) > >
+  future < invoke_result_t < decay_t < F >, decay_t < Args > ... ,
+                             size_t > >
     run_monitored_with_index ( F && f, Args && ... args )
     { return get_slot ( ).run_monitored_with_index
                             ( forward < F > ( f ),
@@ -331,4 +332,58 @@ public:
 
 
 
+// *** PARALLEL TASKS ***
+
+
+// Calls f ( i ) for 0 <= i < tasks, on the threads of pool, or one after
+// the other on the calling thread if pool is nullptr or tasks <= 1.
+//
+// All tasks finish before an exception of one of them is rethrown, so
+// that f and the data it refers to outlive them.
+
+template < class F >
+void run_tasks ( thread_pool * pool, size_t tasks, F f )
+
+{
+if ( pool == nullptr  ||  tasks <= 1 )
+  {
+  for ( size_t i = 0 ; i < tasks ; ++ i )
+    f ( i ) ;
+
+  return ;
+  }
+
+vector < future < void > > futures ;
+futures.reserve ( tasks ) ;
+
+for ( size_t i = 0 ; i < tasks ; ++ i )
+  futures.push_back
+    ( pool -> run_monitored ( [ & f, i ] ( ) { f ( i ) ; } ) ) ;
+
+for ( future < void > & x : futures )
+  x.wait ( ) ;
+
+for ( future < void > & x : futures )
+  x.get ( ) ;
+}
+
+
+// Splits [ 0, n ) into max ( tasks, 1 ) ranges [ first, last ) of nearly
+// equal sizes, and calls f ( i, first, last ) for the range i like
+// run_tasks.
+
+template < class F >
+void run_range_tasks ( thread_pool * pool, size_t n, size_t tasks, F f )
+
+{
+tasks = max ( tasks, size_t ( 1 ) ) ;
+
+run_tasks ( pool,
+            tasks,
+            [ & f, n, tasks ] ( size_t i )
+            { f ( i, n * i / tasks, n * ( i + 1 ) / tasks ) ; } ) ;
+}
+
+
+
 #endif
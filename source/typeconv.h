@@ -26,7 +26,7 @@ class type_converter
 {
 public:
 
-  static Destination operate ( const Source & x )
+  static constexpr Destination operate ( const Source & x )
     { return Destination ( x ) ; }
 
 } ;
@@ -40,7 +40,7 @@ class type_converter < T, T >
 {
 public:
 
-  static T operate ( T x )
+  static constexpr T operate ( T x )
     { return x ; }
 
 } ;
@@ -56,7 +56,7 @@ class type_converter < Source, Destination >          \
 {                                                     \
 public:                                               \
                                                       \
-  static Destination operate ( Source x )             \
+  static constexpr Destination operate ( Source x )   \
     { return static_cast < Destination > ( x ) ; }    \
                                                       \
 } ;
@@ -77,7 +77,7 @@ FOR_BUILTIN_NUMBER_TYPES(__DEFINE_TYPE_CONVERTER)
 //
 
 template < class Destination, class Source >
-inline Destination convert_to ( const Source & x )
+constexpr Destination convert_to ( const Source & x )
 
 {
 return type_converter < Source, Destination > :: operate ( x ) ;
@@ -89,7 +89,7 @@ return type_converter < Source, Destination > :: operate ( x ) ;
 #define __DEFINE_CONVERT_TO(Source)                              \
                                                                  \
 template < class Destination >                                   \
-inline Destination convert_to ( Source x )                       \
+constexpr Destination convert_to ( Source x )                    \
                                                                  \
 {                                                                \
 return type_converter < Source, Destination > :: operate ( x ) ; \
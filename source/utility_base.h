@@ -106,7 +106,7 @@ public:
 //
 
 template < class T1, class T2 >
-inline bool operator != ( const T1 & a, const T2 & b )
+constexpr bool operator != ( const T1 & a, const T2 & b )
 
 {
 return ! ( a == b ) ;
@@ -116,7 +116,7 @@ return ! ( a == b ) ;
 //
 
 template < class T1, class T2 >
-inline bool operator > ( const T1 & a, const T2 & b )
+constexpr bool operator > ( const T1 & a, const T2 & b )
 
 {
 return b < a ;
@@ -126,7 +126,7 @@ return b < a ;
 //
 
 template < class T1, class T2 >
-inline bool operator <= ( const T1 & a, const T2 & b )
+constexpr bool operator <= ( const T1 & a, const T2 & b )
 
 {
 return ! ( b < a ) ;
@@ -136,7 +136,7 @@ return ! ( b < a ) ;
 //
 
 template < class T1, class T2 >
-inline bool operator >= ( const T1 & a, const T2 & b )
+constexpr bool operator >= ( const T1 & a, const T2 & b )
 
 {
 return ! ( a < b ) ;